@@ -20,7 +20,40 @@
 
 
 
-#include "agop.h"
+#include "adtest.h"
+#include "distrib_pareto2.h"
+
+
+/* log(1-exp(-x[i]/mean)) weighted by 2i+1 */
+struct __exp_test_term {
+   const double* x;
+   double mean_inv;
+   __exp_test_term(const double* _x, double _mean_inv) : x(_x), mean_inv(_mean_inv) { }
+   inline double operator()(R_len_t i) const {
+      return (2.0*i+1.0)*log(-expm1(-x[i]*mean_inv)); // accurate for small x[i]
+   }
+};
+
+
+double __exp_test_statistic(const double* xd, R_len_t n, summation_mode mode)
+{
+   // W = -n - 1/n * sum_i (2i+1)*(log(1-exp(-x[i]/mean))-x[n-i-1]/mean),
+   // where sum_i (2i+1)*x[n-i-1] = sum_i (2n-1-2i)*x[i];
+   // hence, the second term only needs sum(x) and sum(i*x[i]),
+   // which are accumulated in a single pass
+   if (xd[0] <= 0.0) return R_PosInf; // x is sorted
+
+   double2 s = sum_terms2(summation_term2_x_ix(xd), n, mode);
+   double sx = s.v1, six = s.v2;
+
+   double dn = (double)n;
+   double mean_inv = dn/sx;
+
+   double w1 = sum_terms(__exp_test_term(xd, mean_inv), n, mode);
+   double w2 = ((2.0*dn-1.0)*sx-2.0*six)*mean_inv;
+
+   return -dn-(w1-w2)/dn;
+}
 
 
 /** Compute the test statistics for AD exponentiality test
@@ -39,22 +72,166 @@ SEXP exp_test_statistic(SEXP x)
       return Rf_ScalarReal(NA_REAL);
    }
 
-   double* xd = REAL(x);
+   double ret = __exp_test_statistic(REAL(x), n, summation_mode_get());
+   UNPROTECT(1);
+   return Rf_ScalarReal(ret);
+}
 
-   double mean = 0.0;
-   for (int i=0; i<n; i++) {
-      if (xd[i] <= 0.0) {
-         UNPROTECT(1);
-         return Rf_ScalarReal(1.0/0.0);
+
+/** Monotone Hermite slopes for the tabulated c.d.f.s
+ *
+ * Computed once, on first use, exactly like in R's
+ * splinefun(method="monoH.FC").
+ *
+ * @return pointer to an array of size (nmax-nmin+1)*k
+ */
+static const double* __exp_test_ad_cdf_m()
+{
+   static vector<double> buf;
+   if (!buf.empty()) return buf.data();
+
+   const R_len_t k = EXP_TEST_AD_CDF_K;
+   const R_len_t nrows = EXP_TEST_AD_CDF_NMAX-EXP_TEST_AD_CDF_NMIN+1;
+   buf.resize(nrows*k);
+   const double* x = __exp_test_ad_cdf_x;
+   vector<double> Sx(k-1);
+   for (R_len_t r=0; r<nrows; ++r) {
+      const double* y = __exp_test_ad_cdf_y[r];
+      double* mr = buf.data()+r*k;
+
+      for (R_len_t j=0; j<k-1; ++j)
+         Sx[j] = (y[j+1]-y[j])/(x[j+1]-x[j]);
+      mr[0] = Sx[0];
+      for (R_len_t j=1; j<k-1; ++j)
+         mr[j] = 0.5*(Sx[j]+Sx[j-1]);
+      mr[k-1] = Sx[k-2];
+
+      // Fritsch-Carlson: make the interpolant monotone
+      for (R_len_t j=0; j<k-1; ++j) {
+         double Sj = Sx[j];
+         if (Sj == 0.0) {
+            mr[j] = mr[j+1] = 0.0;
+         }
+         else {
+            double alpha = mr[j]/Sj, beta = mr[j+1]/Sj, a2b3, ab23;
+            if ((a2b3 = 2.0*alpha+beta-3.0) > 0.0 &&
+                (ab23 = alpha+2.0*beta-3.0) > 0.0 &&
+                alpha*(a2b3+ab23) < a2b3*a2b3) {
+               double tauS = 3.0*Sj/sqrt(alpha*alpha+beta*beta);
+               mr[j] = tauS*alpha;
+               mr[j+1] = tauS*beta;
+            }
+         }
       }
-      mean += xd[i];
    }
-   mean /= (double)n;
 
-   double w_pom = 0.0;
-   for (int i=0; i<n; i++)
-      w_pom += (2.0*i+1.0)*(log(1.0-exp(-xd[i]/mean))-xd[n-i-1]/mean);
+   return buf.data();
+}
+
 
-   UNPROTECT(1);
-   return Rf_ScalarReal(-(double)n-w_pom/(double)n);
+double __exp_test_ad_pvalue(double W, R_len_t n)
+{
+   const R_len_t k = EXP_TEST_AD_CDF_K;
+   const double* x = __exp_test_ad_cdf_x;
+   if (ISNAN(W)) return NA_REAL;
+   if (W > x[k-1]) return 1e-16;
+
+   R_len_t r = min(n, (R_len_t)EXP_TEST_AD_CDF_NMAX)-EXP_TEST_AD_CDF_NMIN;
+   const double* y = __exp_test_ad_cdf_y[r];
+   const double* m = __exp_test_ad_cdf_m()+r*k;
+
+   // findInterval(): x[i] <= W < x[i+1]; O(log k)
+   R_len_t i = (R_len_t)(std::upper_bound(x, x+k, W)-x)-1;
+   double F;
+   if (i < 0)            // linear extrapolation
+      F = y[0]+m[0]*(W-x[0]);
+   else if (i >= k-1)
+      F = y[k-1]+m[k-1]*(W-x[k-1]);
+   else {
+      double h = x[i+1]-x[i];
+      double t = (W-x[i])/h;
+      double t1 = t-1.0;
+      double h01 = t*t*(3.0-2.0*t);
+      double h00 = 1.0-h01;
+      double tt1 = t*t1;
+      double h10 = tt1*t1;
+      double h11 = tt1*t;
+      F = y[i]*h00+h*m[i]*h10+y[i+1]*h01+h*m[i+1]*h11;
+   }
+   return 1.0-F;
+}
+
+
+/** Perform the AD exponentiality (or Pareto2) test on many samples
+ *
+ * Missing values are removed from each sample.
+ * If s is not NULL, each x is transformed with log(1+x/s) first.
+ *
+ * @param x numeric vector, list of numeric vectors, or numeric vector
+ *    split at offsets
+ * @param s NULL or single numeric value
+ * @param offsets NULL or integer vector, see pareto2_prepare_samples()
+ * @return if x is a single sample, a numeric vector
+ *    c(statistic, p.value); a 2-column matrix otherwise
+ */
+SEXP exp_test_ad(SEXP x, SEXP s, SEXP offsets)
+{
+   pareto2_samples samples;
+   x = PROTECT(pareto2_prepare_samples(x, offsets, &samples));
+   bool transform = !Rf_isNull(s);
+   double s_val = 1.0;
+   if (transform) {
+      s = PROTECT(prepare_arg_double_1(s, "s"));
+      s_val = REAL(s)[0];
+      UNPROTECT(1);
+      if (!(s_val > 0.0)) Rf_error(MSG__ARG_NOT_GT_A, "s", 0.0);
+   }
+
+   R_len_t nmax = 0;
+   for (R_len_t i=0; i<samples.count; ++i)
+      nmax = max(nmax, samples.n[i]);
+   double* buf = (double*)R_alloc(nmax, sizeof(double));
+
+   SEXP ret;
+   if (!samples.batch) {
+      PROTECT(ret = Rf_allocVector(REALSXP, 2));
+   }
+   else {
+      PROTECT(ret = Rf_allocMatrix(REALSXP, samples.count, 2));
+      SEXP dimnames;
+      PROTECT(dimnames = Rf_allocVector(VECSXP, 2));
+      SEXP colnames = Rf_allocVector(STRSXP, 2);
+      SET_VECTOR_ELT(dimnames, 1, colnames);
+      SET_STRING_ELT(colnames, 0, Rf_mkChar("statistic"));
+      SET_STRING_ELT(colnames, 1, Rf_mkChar("p.value"));
+      SET_VECTOR_ELT(dimnames, 0, samples.names);
+      Rf_setAttrib(ret, R_DimNamesSymbol, dimnames);
+      UNPROTECT(1);
+   }
+   double* pW = REAL(ret);
+   double* pp = REAL(ret)+samples.count;
+
+   summation_mode mode = summation_mode_get();
+   for (R_len_t i=0; i<samples.count; ++i) {
+      const double* xi = samples.x[i];
+      R_len_t ni = 0;
+      for (R_len_t j=0; j<samples.n[i]; ++j) {
+         if (ISNAN(xi[j])) continue;
+         buf[ni++] = (transform) ? log1p(xi[j]/s_val) : xi[j];
+      }
+
+      if (ni < EXP_TEST_AD_CDF_NMIN) {
+         if (!samples.batch) Rf_error("Sample size too small");
+         pW[i] = NA_REAL;
+         pp[i] = NA_REAL;
+         continue;
+      }
+
+      if (!std::is_sorted(buf, buf+ni)) std::sort(buf, buf+ni);
+      pW[i] = __exp_test_statistic(buf, ni, mode);
+      pp[i] = __exp_test_ad_pvalue(pW[i], ni);
+   }
+
+   UNPROTECT(2);
+   return ret;
 }
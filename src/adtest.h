@@ -0,0 +1,61 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+#ifndef __adtest_h
+#define __adtest_h
+
+#include "agop.h"
+#include "summation.h"
+
+
+/* Monte Carlo estimates of the c.d.f.s of the AD exponentiality test
+ * statistic for sample sizes NMIN, ..., NMAX (larger samples use the
+ * last row), evaluated at K points; see adtest_cdf.cpp */
+#define EXP_TEST_AD_CDF_NMIN 3
+#define EXP_TEST_AD_CDF_NMAX 75
+#define EXP_TEST_AD_CDF_K 235
+extern const double __exp_test_ad_cdf_x[EXP_TEST_AD_CDF_K];
+extern const double __exp_test_ad_cdf_y[EXP_TEST_AD_CDF_NMAX-EXP_TEST_AD_CDF_NMIN+1][EXP_TEST_AD_CDF_K];
+
+
+/** Compute the AD exponentiality test statistic
+ *
+ * @param x sample, sorted increasingly
+ * @param n sample size, >= 3
+ * @param mode summation mode, see summation.h
+ * @return statistic
+ */
+double __exp_test_statistic(const double* x, R_len_t n, summation_mode mode);
+
+
+/** Compute the p-value of the AD exponentiality test
+ *
+ * Monotone (Fritsch-Carlson) cubic Hermite interpolation
+ * of the tabulated c.d.f., the same as splinefun(method="monoH.FC").
+ *
+ * @param W test statistic
+ * @param n sample size, >= 3
+ * @return p-value
+ */
+double __exp_test_ad_pvalue(double W, R_len_t n);
+
+#endif
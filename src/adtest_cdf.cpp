@@ -0,0 +1,2884 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+/* This file has been generated by .devel/test-ad/exp_test_ad_cdf-tocpp.R
+ * from the data in .devel/test-ad/exp_test_ad_cdf.rds; do not edit by hand.
+ */
+
+
+#include "adtest.h"
+
+
+#if EXP_TEST_AD_CDF_NMIN != 3 || EXP_TEST_AD_CDF_NMAX != 75 || EXP_TEST_AD_CDF_K != 235
+#error "adtest.h is out of sync with this table"
+#endif
+
+
+const double __exp_test_ad_cdf_x[EXP_TEST_AD_CDF_K] = {
+   0, 0.125, 0.25, 0.375, 0.5, 0.625, 0.75, 0.76, 0.77, 0.78, 0.79, 0.8,
+   0.81, 0.8200000000000001, 0.83, 0.84, 0.85, 0.86, 0.87, 0.88, 0.89, 0.9,
+   0.91, 0.92, 0.9299999999999999, 0.94, 0.95, 0.96, 0.97, 0.98, 0.99, 1,
+   1.01, 1.02, 1.03, 1.04, 1.05, 1.06, 1.07, 1.08, 1.09, 1.1,
+   1.1099999999999999, 1.12, 1.13, 1.1400000000000001, 1.15,
+   1.1600000000000001, 1.17, 1.18, 1.19, 1.2, 1.21, 1.22, 1.23, 1.24, 1.25,
+   1.26, 1.27, 1.28, 1.29, 1.3, 1.31, 1.32, 1.33, 1.3399999999999999, 1.35,
+   1.3599999999999999, 1.37, 1.38, 1.3900000000000001, 1.4,
+   1.4100000000000001, 1.42, 1.4300000000000002, 1.44, 1.4500000000000002,
+   1.46, 1.47, 1.48, 1.49, 1.5, 1.51, 1.52, 1.53, 1.54, 1.55, 1.56, 1.57,
+   1.58, 1.5899999999999999, 1.6, 1.6099999999999999, 1.62, 1.63,
+   1.6400000000000001, 1.65, 1.6600000000000001, 1.67, 1.6800000000000002,
+   1.69, 1.7000000000000002, 1.71, 1.72, 1.73, 1.74, 1.75, 1.76, 1.77, 1.78,
+   1.79, 1.8, 1.81, 1.82, 1.83, 1.84, 1.85, 1.86, 1.87, 1.8800000000000001,
+   1.8900000000000001, 1.9000000000000001, 1.91, 1.92, 1.93, 1.94, 1.95,
+   1.96, 1.97, 1.98, 1.99, 2, 2.01, 2.02, 2.0300000000000002, 2.04, 2.05,
+   2.06, 2.0700000000000003, 2.08, 2.09, 2.1, 2.1100000000000003, 2.12, 2.13,
+   2.14, 2.1500000000000004, 2.16, 2.17, 2.1799999999999997, 2.19, 2.2, 2.21,
+   2.2199999999999998, 2.23, 2.24, 2.25, 2.26, 2.27, 2.2800000000000002,
+   2.29, 2.3, 2.31, 2.3200000000000003, 2.33, 2.34, 2.35, 2.3600000000000003,
+   2.37, 2.38, 2.39, 2.4000000000000004, 2.41, 2.42, 2.4299999999999997,
+   2.44, 2.45, 2.46, 2.4699999999999998, 2.48, 2.49, 2.5, 2.51, 2.52,
+   2.5300000000000002, 2.54, 2.55, 2.56, 2.5700000000000003, 2.58, 2.59, 2.6,
+   2.6100000000000003, 2.62, 2.63, 2.64, 2.6500000000000004, 2.66, 2.67,
+   2.6799999999999997, 2.69, 2.7, 2.71, 2.7199999999999998, 2.73, 2.74, 2.75,
+   2.7600000000000002, 2.77, 2.7800000000000002, 2.79, 2.8, 2.81, 2.82, 2.83,
+   2.84, 2.85, 2.86, 2.87, 2.88, 2.89, 2.9, 2.91, 2.92, 2.93, 2.94, 2.95,
+   2.96, 2.97, 2.98, 2.99, 3, 3.5, 4, 10
+};
+
+
+const double __exp_test_ad_cdf_y[EXP_TEST_AD_CDF_NMAX-EXP_TEST_AD_CDF_NMIN+1][EXP_TEST_AD_CDF_K] = {
+   { // n=3
+      0, 0, 0.0881436, 0.3283944, 0.5615016, 0.7168412, 0.8129136, 0.8190712,
+      0.825058, 0.8309044, 0.8365632, 0.8420628, 0.8473876, 0.8525292,
+      0.8575852, 0.8624044, 0.8671396, 0.8717296, 0.8762732, 0.880656,
+      0.8848552, 0.8889512, 0.8929264, 0.8967608, 0.9004816, 0.9040628,
+      0.9075104, 0.9110132, 0.9143952, 0.9176068, 0.9207464, 0.9237396,
+      0.9266544, 0.9294424, 0.9321428, 0.9348248, 0.9374192, 0.939896,
+      0.9422868, 0.9445236, 0.9467316, 0.9488752, 0.9509356, 0.952924, 0.95483,
+      0.956626, 0.9583916, 0.9601004, 0.9617056, 0.96328, 0.9647912, 0.9662184,
+      0.967576, 0.9688128, 0.9700328, 0.9712024, 0.9722912, 0.9733152,
+      0.9742744, 0.9751592, 0.9760424, 0.9768668, 0.9776596, 0.978374,
+      0.9790036, 0.979626, 0.9801884, 0.9806712, 0.9810872, 0.9815116,
+      0.9818788, 0.9822676, 0.9826264, 0.9829784, 0.9833196, 0.9836668,
+      0.9840152, 0.9843256, 0.9846416, 0.9849312, 0.9852396, 0.985522,
+      0.9858056, 0.9860748, 0.9863688, 0.9866388, 0.986902, 0.9871592,
+      0.9874096, 0.9876764, 0.9879256, 0.9881552, 0.9883828, 0.9886248,
+      0.9888512, 0.9890672, 0.9892788, 0.9894904, 0.9897092, 0.9899036,
+      0.9901072, 0.9903024, 0.9905, 0.9906844, 0.9908788, 0.9910432, 0.991226,
+      0.9913812, 0.9915412, 0.9917028, 0.9918688, 0.9920132, 0.99217, 0.9923304,
+      0.992464, 0.9925972, 0.9927336, 0.992872, 0.9930144, 0.9931392, 0.9932572,
+      0.993376, 0.9935092, 0.9936272, 0.993748, 0.993862, 0.99397, 0.9940788,
+      0.994184, 0.994294, 0.9943916, 0.994498, 0.9945972, 0.994692, 0.994788,
+      0.99489, 0.9949872, 0.9950716, 0.9951544, 0.9952416, 0.9953172, 0.9954004,
+      0.9954808, 0.995558, 0.9956512, 0.9957312, 0.9958044, 0.9958736,
+      0.9959432, 0.996014, 0.9960752, 0.9961488, 0.9962152, 0.9962764, 0.996342,
+      0.996406, 0.9964664, 0.9965276, 0.9965972, 0.9966588, 0.9967144,
+      0.9967788, 0.9968288, 0.9968856, 0.9969456, 0.996998, 0.9970496,
+      0.9970964, 0.997146, 0.997196, 0.997248, 0.9972992, 0.9973428, 0.9973948,
+      0.9974408, 0.99749, 0.997538, 0.9975864, 0.9976272, 0.9976668, 0.9977044,
+      0.9977484, 0.9977872, 0.997824, 0.99786, 0.997906, 0.997936, 0.9979728,
+      0.998006, 0.9980448, 0.998078, 0.9981116, 0.9981532, 0.9981832, 0.9982124,
+      0.998242, 0.9982668, 0.998296, 0.9983236, 0.9983572, 0.9983948, 0.99842,
+      0.9984448, 0.9984692, 0.9984972, 0.9985192, 0.9985428, 0.9985704,
+      0.9985948, 0.9986188, 0.9986388, 0.9986596, 0.998684, 0.9987052,
+      0.9987272, 0.9987456, 0.9987704, 0.998794, 0.9988152, 0.9988352,
+      0.9988556, 0.998874, 0.9988912, 0.9989104, 0.9989304, 0.9989492,
+      0.9989656, 0.9989852, 0.9989996, 0.9990148, 0.9990292, 0.9990468,
+      0.9995752, 0.9998068, 1
+   },
+   { // n=4
+      0, 0, 0.09007, 0.33006, 0.5461648, 0.6971, 0.8005084, 0.8070404,
+      0.8134204, 0.8195832, 0.8255036, 0.8312048, 0.8368032, 0.8421776,
+      0.8472048, 0.8521972, 0.8570048, 0.8616488, 0.8660656, 0.8704032,
+      0.8746004, 0.8785712, 0.882442, 0.8861696, 0.8897568, 0.89325, 0.896664,
+      0.8999304, 0.9030796, 0.9062308, 0.9092496, 0.9121624, 0.9150212,
+      0.9177676, 0.9203768, 0.9229276, 0.9253944, 0.9277536, 0.9300692,
+      0.9323168, 0.9344708, 0.9365764, 0.9386472, 0.9406464, 0.942558,
+      0.9444168, 0.9462012, 0.94794, 0.9496296, 0.951242, 0.9527724, 0.9543244,
+      0.9557876, 0.9572392, 0.9585892, 0.9598964, 0.9611456, 0.962392,
+      0.9635992, 0.964734, 0.9658288, 0.9669348, 0.9679652, 0.9689804,
+      0.9699052, 0.9708496, 0.971768, 0.972642, 0.9735016, 0.9743248, 0.9750744,
+      0.9758084, 0.9765024, 0.9771688, 0.9778316, 0.9784788, 0.979098,
+      0.9797024, 0.9802848, 0.980838, 0.981376, 0.9818832, 0.9823804, 0.9828736,
+      0.9833472, 0.98378, 0.98422, 0.9846376, 0.985032, 0.9854188, 0.9857888,
+      0.9861388, 0.9864796, 0.9867984, 0.987118, 0.9874284, 0.9877232,
+      0.9880024, 0.9882736, 0.9885288, 0.9887868, 0.9890204, 0.9892496,
+      0.9894932, 0.9897164, 0.9899272, 0.9901208, 0.9903244, 0.9905236,
+      0.9907056, 0.990872, 0.9910552, 0.9912288, 0.9913924, 0.9915476,
+      0.9917044, 0.991852, 0.9920012, 0.9921472, 0.9922888, 0.9924324,
+      0.9925692, 0.9926856, 0.9928052, 0.992932, 0.9930548, 0.9931668, 0.99329,
+      0.9934076, 0.9935308, 0.9936556, 0.99378, 0.9938836, 0.9939916, 0.9940988,
+      0.9942028, 0.9943132, 0.9944168, 0.9945184, 0.9946128, 0.9947032,
+      0.9948032, 0.9948964, 0.9949844, 0.9950716, 0.995166, 0.9952468,
+      0.9953304, 0.9954108, 0.9954876, 0.995562, 0.9956376, 0.9957036,
+      0.9957792, 0.995852, 0.9959212, 0.995996, 0.99607, 0.9961392, 0.9962044,
+      0.9962652, 0.996332, 0.9963912, 0.9964612, 0.9965172, 0.9965808,
+      0.9966404, 0.9966908, 0.996748, 0.9968012, 0.9968628, 0.9969152,
+      0.9969568, 0.9970072, 0.997058, 0.997108, 0.9971616, 0.9972132, 0.9972652,
+      0.9973088, 0.9973476, 0.99739, 0.9974392, 0.997478, 0.997518, 0.9975564,
+      0.9975996, 0.9976408, 0.9976816, 0.997724, 0.9977568, 0.9978004,
+      0.9978428, 0.9978788, 0.9979148, 0.9979468, 0.9979884, 0.9980204, 0.99805,
+      0.9980788, 0.9981148, 0.9981504, 0.998182, 0.998204, 0.9982304, 0.9982656,
+      0.9982916, 0.9983112, 0.9983404, 0.9983716, 0.9984012, 0.9984292,
+      0.9984504, 0.998476, 0.9985024, 0.9985244, 0.998548, 0.9985672, 0.9985932,
+      0.9986136, 0.9986372, 0.9986596, 0.99868, 0.9986996, 0.9987204, 0.9987392,
+      0.9987608, 0.998778, 0.998794, 0.9988132, 0.9988268, 0.998844, 0.9994868,
+      0.9997672, 1
+   },
+   { // n=5
+      0, 0, 0.091992, 0.3267116, 0.5373536, 0.6892428, 0.7914276, 0.7980028,
+      0.80434, 0.810468, 0.8164244, 0.8221548, 0.8276524, 0.8330428, 0.8381548,
+      0.8432816, 0.8482444, 0.8529844, 0.8575788, 0.8620776, 0.8663712,
+      0.870554, 0.8746076, 0.8785376, 0.8822804, 0.885968, 0.889592, 0.89303,
+      0.89638, 0.8996228, 0.9027768, 0.9058004, 0.9087516, 0.9115744, 0.9143692,
+      0.9170228, 0.9196096, 0.9220464, 0.9244288, 0.9267628, 0.9290228,
+      0.931214, 0.9332596, 0.935324, 0.9372768, 0.9391512, 0.9410028, 0.9428256,
+      0.9445464, 0.946232, 0.9478552, 0.9494268, 0.9509588, 0.952388, 0.9537904,
+      0.955162, 0.9565428, 0.9578348, 0.9590748, 0.9602956, 0.961466, 0.9625684,
+      0.9636456, 0.9646868, 0.9656936, 0.9666616, 0.9675972, 0.9685112,
+      0.9694292, 0.9702968, 0.9711268, 0.97195, 0.9727476, 0.9735036, 0.974266,
+      0.9749784, 0.975686, 0.9763468, 0.9769792, 0.9776216, 0.9782116, 0.97882,
+      0.9794056, 0.9799716, 0.980502, 0.9810108, 0.981504, 0.9819848, 0.9824608,
+      0.9829084, 0.9833488, 0.9837788, 0.9842024, 0.9846128, 0.9850044,
+      0.985382, 0.9857488, 0.9861076, 0.9864516, 0.9867788, 0.987094, 0.9874072,
+      0.987706, 0.9879764, 0.9882628, 0.9885412, 0.9888224, 0.9890656, 0.989314,
+      0.9895528, 0.98979, 0.990008, 0.9902224, 0.990438, 0.9906488, 0.9908344,
+      0.9910256, 0.9912252, 0.9913904, 0.9915616, 0.9917296, 0.9918948,
+      0.9920592, 0.9922184, 0.992362, 0.9925284, 0.9926768, 0.992818, 0.9929528,
+      0.9930932, 0.9932268, 0.9933636, 0.9934992, 0.9936172, 0.9937356,
+      0.9938556, 0.9939616, 0.9940636, 0.994174, 0.9942852, 0.9943876,
+      0.9944864, 0.9945928, 0.994686, 0.9947804, 0.9948772, 0.9949672, 0.995056,
+      0.9951496, 0.9952452, 0.9953264, 0.9954164, 0.9954928, 0.9955808,
+      0.995662, 0.995736, 0.9958128, 0.9958916, 0.9959616, 0.996028, 0.996098,
+      0.9961772, 0.9962316, 0.9962972, 0.9963648, 0.9964312, 0.9964908,
+      0.996548, 0.99662, 0.9966788, 0.996742, 0.9967904, 0.9968432, 0.9968964,
+      0.99695, 0.997006, 0.9970604, 0.9971224, 0.9971728, 0.9972212, 0.997272,
+      0.9973172, 0.9973636, 0.9974052, 0.9974472, 0.9974888, 0.9975328,
+      0.9975756, 0.9976132, 0.9976536, 0.9976856, 0.99773, 0.997768, 0.9978032,
+      0.9978376, 0.9978784, 0.9979208, 0.9979524, 0.9979892, 0.9980204,
+      0.9980576, 0.9980944, 0.9981264, 0.9981536, 0.998186, 0.9982204,
+      0.9982504, 0.9982764, 0.9983068, 0.99834, 0.9983664, 0.9983976, 0.9984288,
+      0.9984576, 0.9984792, 0.998512, 0.9985424, 0.9985652, 0.9985896, 0.998618,
+      0.9986412, 0.9986648, 0.9986884, 0.9987096, 0.9987364, 0.9987564,
+      0.9987728, 0.998796, 0.998812, 0.9988288, 0.9988456, 0.9988644, 0.9994844,
+      0.9997568, 0.9999996
+   },
+   { // n=6
+      0, 3.28e-05, 0.0937704, 0.3239816, 0.5326848, 0.6839404, 0.7865148,
+      0.7931256, 0.7994212, 0.8055868, 0.8116204, 0.8173676, 0.8229412,
+      0.828328, 0.8335576, 0.8386856, 0.8436348, 0.848492, 0.8530716, 0.857526,
+      0.8618696, 0.8661136, 0.870204, 0.8741476, 0.8779, 0.8815992, 0.8852108,
+      0.888666, 0.8920612, 0.8952172, 0.8983948, 0.9013972, 0.9043944, 0.90722,
+      0.9099692, 0.9126916, 0.9152984, 0.9178172, 0.9201968, 0.9226088,
+      0.9249216, 0.9271352, 0.9293, 0.9314024, 0.9334868, 0.93548, 0.9373636,
+      0.9392056, 0.941006, 0.9427408, 0.944424, 0.9460432, 0.9475868, 0.9491316,
+      0.9505788, 0.951984, 0.9533588, 0.9546884, 0.9559972, 0.957238, 0.9584404,
+      0.9596788, 0.960816, 0.9619284, 0.963, 0.9640436, 0.965026, 0.9660336,
+      0.9669424, 0.9678736, 0.968752, 0.9696168, 0.9704212, 0.971262, 0.972042,
+      0.9728048, 0.9735584, 0.9742424, 0.974922, 0.9755752, 0.976236, 0.9768668,
+      0.9774796, 0.9780376, 0.9786448, 0.9792236, 0.9797504, 0.9802608,
+      0.9807572, 0.9812292, 0.9817232, 0.9822144, 0.9826716, 0.9831048,
+      0.9835284, 0.9839216, 0.9843452, 0.9847204, 0.985102, 0.9854808,
+      0.9858524, 0.986206, 0.9865496, 0.9868916, 0.9872224, 0.9875152,
+      0.9878148, 0.9881068, 0.9883824, 0.9886444, 0.9889108, 0.9891676,
+      0.989412, 0.9896552, 0.9898836, 0.9901204, 0.9903296, 0.9905376,
+      0.9907488, 0.9909648, 0.9911592, 0.9913356, 0.9915448, 0.9917256,
+      0.9919044, 0.9920672, 0.9922268, 0.9924052, 0.9925784, 0.9927388,
+      0.9928984, 0.9930448, 0.9931908, 0.9933292, 0.9934684, 0.9936052,
+      0.9937396, 0.99387, 0.9939892, 0.9941048, 0.994216, 0.9943388, 0.9944536,
+      0.9945588, 0.9946744, 0.9947696, 0.9948632, 0.99496, 0.9950536, 0.9951428,
+      0.9952308, 0.9953236, 0.9954084, 0.9954992, 0.9955788, 0.9956564,
+      0.995734, 0.9958192, 0.9959084, 0.995982, 0.9960576, 0.996124, 0.9961944,
+      0.996258, 0.9963276, 0.9963932, 0.9964556, 0.9965236, 0.9965848,
+      0.9966464, 0.9967128, 0.996776, 0.9968336, 0.9968936, 0.9969472,
+      0.9969948, 0.9970492, 0.9971068, 0.997156, 0.9972068, 0.9972524,
+      0.9972948, 0.99734, 0.9973876, 0.99743, 0.997472, 0.9975172, 0.9975572,
+      0.9975952, 0.9976376, 0.9976752, 0.9977208, 0.997762, 0.9978, 0.9978344,
+      0.9978716, 0.9979088, 0.9979484, 0.9979816, 0.998016, 0.9980584, 0.998084,
+      0.9981148, 0.9981472, 0.9981768, 0.9982032, 0.9982376, 0.99827, 0.9983004,
+      0.9983284, 0.998358, 0.9983808, 0.9984064, 0.9984324, 0.9984552,
+      0.9984796, 0.9985056, 0.9985272, 0.9985536, 0.998576, 0.9985968,
+      0.9986224, 0.9986456, 0.9986652, 0.9986888, 0.9987092, 0.9987288,
+      0.9987468, 0.9987684, 0.998786, 0.998804, 0.9988248, 0.9994636, 0.99975,
+      1
+   },
+   { // n=7
+      0, 0.0002884, 0.0954092, 0.322246, 0.5294736, 0.6797952, 0.7826328,
+      0.7892076, 0.7955988, 0.8017928, 0.8077804, 0.813662, 0.81927, 0.824756,
+      0.8300296, 0.8352188, 0.8402356, 0.8450408, 0.8497196, 0.8541776,
+      0.858528, 0.8628016, 0.8669396, 0.87093, 0.87474, 0.8785272, 0.8821584,
+      0.8856504, 0.8891264, 0.892422, 0.895588, 0.8986576, 0.9016224, 0.9045224,
+      0.907398, 0.9101172, 0.9128072, 0.9154104, 0.9179332, 0.920276, 0.9226356,
+      0.9248772, 0.9270712, 0.92918, 0.9311964, 0.9331896, 0.9351672, 0.9370424,
+      0.9388656, 0.9405656, 0.9422704, 0.9439064, 0.9454896, 0.9470116, 0.94852,
+      0.949946, 0.9514012, 0.952778, 0.9541388, 0.955462, 0.9567256, 0.9579596,
+      0.9590996, 0.9602392, 0.9613472, 0.9624108, 0.9634324, 0.9644244,
+      0.9653892, 0.9663368, 0.9672572, 0.9681512, 0.9690248, 0.9698672,
+      0.9706664, 0.9714432, 0.9722, 0.9729236, 0.9736516, 0.9743468, 0.9749964,
+      0.9756496, 0.97628, 0.9768844, 0.9774724, 0.9780728, 0.9786292, 0.9791584,
+      0.9797024, 0.9802468, 0.9807512, 0.9812472, 0.9817144, 0.9821876,
+      0.9826096, 0.9830504, 0.983472, 0.9838864, 0.984288, 0.9846796, 0.9850312,
+      0.98541, 0.9857864, 0.9861332, 0.9864592, 0.9867948, 0.9871264, 0.987428,
+      0.9877036, 0.9880124, 0.9882832, 0.9885508, 0.9888064, 0.9890724,
+      0.9893256, 0.9895724, 0.9898096, 0.9900308, 0.9902748, 0.9904928,
+      0.9907192, 0.9909232, 0.9911264, 0.9913156, 0.9914964, 0.9916832, 0.99186,
+      0.9920284, 0.992202, 0.9923692, 0.9925424, 0.99271, 0.9928784, 0.993022,
+      0.9931752, 0.993332, 0.9934724, 0.9936056, 0.9937432, 0.993874, 0.993988,
+      0.9941196, 0.9942388, 0.99437, 0.9944764, 0.9945804, 0.9946904, 0.9947988,
+      0.9948972, 0.9949996, 0.9950928, 0.9951872, 0.9952816, 0.9953704,
+      0.9954628, 0.9955448, 0.9956364, 0.9957184, 0.9957924, 0.9958764,
+      0.995948, 0.9960256, 0.9960912, 0.9961588, 0.996222, 0.9962944, 0.9963648,
+      0.9964396, 0.9965044, 0.9965724, 0.9966288, 0.9966932, 0.996752, 0.996806,
+      0.996874, 0.9969328, 0.996998, 0.9970464, 0.9971104, 0.997162, 0.9972204,
+      0.9972736, 0.9973252, 0.9973712, 0.9974136, 0.9974632, 0.997502,
+      0.9975448, 0.9975884, 0.997628, 0.9976712, 0.9977096, 0.9977512, 0.997784,
+      0.9978196, 0.9978516, 0.9978864, 0.9979148, 0.9979492, 0.9979856,
+      0.9980236, 0.9980556, 0.9980872, 0.9981188, 0.9981488, 0.9981804,
+      0.9982116, 0.9982452, 0.9982744, 0.9983048, 0.9983332, 0.9983552,
+      0.9983768, 0.9984076, 0.9984308, 0.998458, 0.998486, 0.998512, 0.9985364,
+      0.9985604, 0.9985836, 0.9986124, 0.9986348, 0.9986576, 0.9986788,
+      0.9986992, 0.998722, 0.9987488, 0.9987644, 0.9987836, 0.9988076,
+      0.9988244, 0.9994936, 0.9997752, 1
+   },
+   { // n=8
+      0, 0.0004752, 0.0962124, 0.3205036, 0.5265572, 0.6766068, 0.7799108,
+      0.786572, 0.7930396, 0.799324, 0.8052744, 0.81107, 0.8166464, 0.8221332,
+      0.8274552, 0.8325716, 0.8374844, 0.8423476, 0.8471072, 0.8515512,
+      0.8559464, 0.8602204, 0.864266, 0.8682908, 0.8721424, 0.875902, 0.8795972,
+      0.88313, 0.8865428, 0.8898652, 0.8931272, 0.8962704, 0.8992284, 0.902154,
+      0.9050376, 0.9078444, 0.9105156, 0.9130744, 0.915584, 0.9179804,
+      0.9203588, 0.922666, 0.9248812, 0.9269864, 0.9290424, 0.9311016,
+      0.9331004, 0.9349864, 0.9368492, 0.9385792, 0.940318, 0.9420452,
+      0.9436424, 0.9452104, 0.9467464, 0.9482232, 0.949682, 0.9510532,
+      0.9523492, 0.9536336, 0.9549168, 0.9561852, 0.9574068, 0.9585824,
+      0.9597096, 0.96082, 0.9618804, 0.962948, 0.9639492, 0.9649184, 0.9658696,
+      0.966784, 0.9676672, 0.9685344, 0.9693768, 0.9701696, 0.9709864,
+      0.9717632, 0.9725156, 0.973254, 0.9739608, 0.9746584, 0.9753124,
+      0.9759536, 0.976576, 0.9771848, 0.977764, 0.9783484, 0.9789012, 0.9794584,
+      0.979998, 0.9805188, 0.9809956, 0.9815084, 0.9819752, 0.982434, 0.9828792,
+      0.9832896, 0.98369, 0.98409, 0.9844672, 0.9848364, 0.9851996, 0.9855624,
+      0.9858976, 0.9862664, 0.9866052, 0.9869064, 0.9872076, 0.9875232,
+      0.9878196, 0.9881148, 0.9884048, 0.9886736, 0.9889384, 0.989196,
+      0.9894448, 0.9896812, 0.9899228, 0.9901436, 0.9903612, 0.990586, 0.990802,
+      0.9910056, 0.9912172, 0.99141, 0.9916248, 0.9918288, 0.9920084, 0.9922012,
+      0.9923736, 0.9925328, 0.9927, 0.9928604, 0.9930208, 0.9931644, 0.993318,
+      0.993456, 0.9936036, 0.9937408, 0.993876, 0.9939956, 0.9941276, 0.9942388,
+      0.9943604, 0.994482, 0.994598, 0.9947004, 0.9948068, 0.9949152, 0.995026,
+      0.9951284, 0.9952264, 0.9953316, 0.9954208, 0.995508, 0.9955976, 0.995682,
+      0.9957648, 0.9958504, 0.9959272, 0.9960092, 0.9960868, 0.996154,
+      0.9962308, 0.9963028, 0.9963764, 0.9964528, 0.9965252, 0.9965936,
+      0.9966564, 0.9967252, 0.996788, 0.9968496, 0.9969096, 0.9969648,
+      0.9970184, 0.9970708, 0.9971256, 0.9971836, 0.9972356, 0.9972868,
+      0.9973372, 0.9973896, 0.9974384, 0.9974772, 0.9975208, 0.9975688,
+      0.9976168, 0.9976628, 0.9977028, 0.9977496, 0.9977868, 0.9978276,
+      0.9978676, 0.9979096, 0.9979468, 0.9979956, 0.9980356, 0.9980648,
+      0.9981044, 0.9981344, 0.9981664, 0.9982, 0.9982308, 0.998262, 0.9982896,
+      0.9983216, 0.99835, 0.9983796, 0.998408, 0.9984316, 0.9984628, 0.9984868,
+      0.9985164, 0.998546, 0.998578, 0.9986032, 0.9986252, 0.9986488, 0.998674,
+      0.9986948, 0.998712, 0.9987356, 0.998758, 0.9987816, 0.9988048, 0.9988236,
+      0.9988416, 0.9988592, 0.99888, 0.998898, 0.999526, 0.9997772, 1
+   },
+   { // n=9
+      0, 0.0006224, 0.0961224, 0.3189944, 0.5247968, 0.6746752, 0.777902,
+      0.7844644, 0.790876, 0.7970508, 0.8030652, 0.8089088, 0.814636, 0.8201572,
+      0.8254668, 0.8306732, 0.8355956, 0.840436, 0.845162, 0.8497056, 0.8541956,
+      0.8584652, 0.8625796, 0.8666448, 0.8705608, 0.8743364, 0.8780228,
+      0.881568, 0.88502, 0.8883788, 0.8916684, 0.8947992, 0.8977992, 0.9008012,
+      0.9036252, 0.906358, 0.9090412, 0.9115972, 0.9141084, 0.9165708, 0.918992,
+      0.9213156, 0.92352, 0.9256744, 0.927768, 0.9297972, 0.9317784, 0.9336832,
+      0.9355512, 0.937352, 0.9391152, 0.9407648, 0.9424296, 0.9439816,
+      0.9454864, 0.947032, 0.9484576, 0.9498628, 0.95122, 0.9525448, 0.953836,
+      0.955068, 0.956242, 0.957414, 0.95856, 0.9596656, 0.960744, 0.9617972,
+      0.9628528, 0.9638388, 0.9648152, 0.96575, 0.966654, 0.9675268, 0.9683772,
+      0.9691944, 0.9700172, 0.9708004, 0.9715572, 0.9722852, 0.9729824,
+      0.9737088, 0.9743924, 0.9750344, 0.9756852, 0.9763036, 0.976904,
+      0.9774808, 0.9780472, 0.9785916, 0.9791744, 0.9796968, 0.9802388,
+      0.9807476, 0.981226, 0.981686, 0.9821324, 0.9825688, 0.9829928, 0.983422,
+      0.9838448, 0.9842356, 0.9846292, 0.985006, 0.985356, 0.9856884, 0.9860588,
+      0.9863792, 0.9866896, 0.9870224, 0.9873324, 0.9876464, 0.987966, 0.988266,
+      0.988536, 0.9888008, 0.9890648, 0.9893216, 0.9895844, 0.9898204,
+      0.9900696, 0.990302, 0.9905336, 0.990744, 0.9909632, 0.9911592, 0.9913464,
+      0.9915368, 0.991724, 0.9919136, 0.9921048, 0.9922704, 0.9924464,
+      0.9926104, 0.992774, 0.9929304, 0.993088, 0.9932388, 0.9933948, 0.9935428,
+      0.9936796, 0.9938156, 0.993952, 0.9940888, 0.9942224, 0.9943432,
+      0.9944604, 0.9945736, 0.9946936, 0.9948172, 0.9949256, 0.9950264,
+      0.9951348, 0.9952328, 0.9953288, 0.995422, 0.9955252, 0.9956176, 0.995704,
+      0.9957952, 0.995896, 0.9959884, 0.996072, 0.9961596, 0.9962392, 0.9963212,
+      0.9963896, 0.996464, 0.9965344, 0.9965944, 0.9966668, 0.9967244, 0.996786,
+      0.9968492, 0.9969124, 0.9969776, 0.9970356, 0.9970924, 0.9971436,
+      0.9971928, 0.9972372, 0.99729, 0.9973368, 0.9973888, 0.9974352, 0.9974768,
+      0.9975224, 0.9975676, 0.9976064, 0.9976524, 0.9976964, 0.9977384, 0.99778,
+      0.9978176, 0.9978492, 0.9978872, 0.997928, 0.9979656, 0.9980004,
+      0.9980368, 0.998078, 0.998114, 0.9981392, 0.9981732, 0.998198, 0.998232,
+      0.9982596, 0.99829, 0.9983172, 0.9983508, 0.9983784, 0.9984016, 0.9984264,
+      0.998456, 0.9984804, 0.9985084, 0.9985336, 0.9985564, 0.9985844,
+      0.9986068, 0.9986236, 0.9986516, 0.9986784, 0.998698, 0.9987172, 0.998746,
+      0.9987664, 0.99879, 0.9988132, 0.9988364, 0.9988572, 0.9988824, 0.9995264,
+      0.9997948, 1
+   },
+   { // n=10
+      0, 0.0007764, 0.096252, 0.3174024, 0.5221616, 0.672008, 0.7755448,
+      0.7821764, 0.788632, 0.7948812, 0.8009892, 0.806848, 0.8125832, 0.8180684,
+      0.8234772, 0.8286532, 0.8336208, 0.8385292, 0.843236, 0.8477728,
+      0.8521688, 0.8564908, 0.8606576, 0.8647856, 0.8687528, 0.8725536,
+      0.876232, 0.8797584, 0.883194, 0.88654, 0.8897784, 0.8928644, 0.8959064,
+      0.8988788, 0.9017692, 0.9045668, 0.9072648, 0.9098496, 0.9123544,
+      0.914866, 0.9172936, 0.91967, 0.9219184, 0.9240428, 0.9261412, 0.9281868,
+      0.9302064, 0.9321532, 0.934024, 0.935816, 0.9376068, 0.9393064, 0.9409616,
+      0.9426084, 0.9441616, 0.945712, 0.9472364, 0.9487176, 0.9500748,
+      0.9514268, 0.952788, 0.9540532, 0.9552908, 0.9564992, 0.957614, 0.9587608,
+      0.9598824, 0.960962, 0.961986, 0.9630068, 0.9639772, 0.9649268, 0.9658492,
+      0.9667548, 0.9676352, 0.9685584, 0.9694064, 0.9701972, 0.970972,
+      0.9716912, 0.9724188, 0.9731328, 0.9738272, 0.9745236, 0.9751748,
+      0.9758236, 0.9764744, 0.977082, 0.9776812, 0.9782732, 0.9788124, 0.979334,
+      0.9798576, 0.9803424, 0.9808532, 0.9813428, 0.9817836, 0.9822668,
+      0.9826828, 0.9831168, 0.9835244, 0.9839544, 0.984348, 0.9847508, 0.985102,
+      0.9854664, 0.9858052, 0.986154, 0.98651, 0.9868472, 0.9871472, 0.9874504,
+      0.9877368, 0.9880248, 0.9883068, 0.9885808, 0.9888556, 0.989124, 0.989384,
+      0.9896232, 0.989876, 0.9901036, 0.9903352, 0.9905552, 0.9907772, 0.990996,
+      0.9911876, 0.9913864, 0.9915856, 0.991772, 0.9919548, 0.9921332, 0.992316,
+      0.9924968, 0.9926692, 0.9928288, 0.992988, 0.9931548, 0.9933052,
+      0.9934452, 0.99358, 0.9937336, 0.9938796, 0.9940156, 0.9941368, 0.9942584,
+      0.9943852, 0.9945024, 0.994606, 0.994714, 0.9948232, 0.9949396, 0.9950412,
+      0.9951512, 0.9952632, 0.9953592, 0.9954544, 0.9955472, 0.9956408,
+      0.995732, 0.9958132, 0.9959, 0.9959768, 0.9960572, 0.9961452, 0.9962256,
+      0.9962976, 0.9963776, 0.9964568, 0.9965348, 0.9966132, 0.9966748,
+      0.9967432, 0.9968124, 0.996878, 0.9969364, 0.9969976, 0.9970512, 0.997108,
+      0.9971652, 0.9972184, 0.9972756, 0.997332, 0.9973776, 0.9974304, 0.997488,
+      0.9975304, 0.9975768, 0.99762, 0.9976536, 0.9976908, 0.9977332, 0.9977688,
+      0.9978128, 0.9978492, 0.9978928, 0.9979352, 0.9979736, 0.9980076,
+      0.9980396, 0.998074, 0.998108, 0.9981492, 0.9981824, 0.9982132, 0.9982432,
+      0.9982736, 0.998302, 0.9983308, 0.998358, 0.9983852, 0.9984184, 0.9984484,
+      0.9984756, 0.9985088, 0.9985368, 0.9985632, 0.9985892, 0.998614,
+      0.9986444, 0.9986712, 0.9986928, 0.9987184, 0.9987392, 0.9987588,
+      0.998786, 0.9988088, 0.9988276, 0.9988492, 0.9988728, 0.9988916,
+      0.9989044, 0.9995336, 0.999796, 1
+   },
+   { // n=11
+      0, 0.000872, 0.0966304, 0.3170972, 0.521238, 0.671042, 0.7741752,
+      0.7809152, 0.7873736, 0.793686, 0.7997304, 0.8056016, 0.8112708,
+      0.8168304, 0.822184, 0.82739, 0.8324704, 0.8373564, 0.8420712, 0.8466268,
+      0.851136, 0.8555012, 0.8597352, 0.8637664, 0.8677172, 0.8715272,
+      0.8752116, 0.8788416, 0.882278, 0.8855828, 0.888832, 0.8919508, 0.8950768,
+      0.8980332, 0.9008888, 0.9037252, 0.9064452, 0.9090592, 0.9115812,
+      0.9140644, 0.9165216, 0.9188696, 0.9211516, 0.9233256, 0.9254936,
+      0.9275604, 0.9295812, 0.9315296, 0.9334268, 0.9352264, 0.9370588,
+      0.9388048, 0.9405044, 0.9421084, 0.9436524, 0.9451768, 0.9466816,
+      0.948168, 0.9496008, 0.9509468, 0.952268, 0.9535976, 0.9548884, 0.9561304,
+      0.9573212, 0.9584832, 0.9595864, 0.960664, 0.9617212, 0.9627284,
+      0.9637164, 0.9646784, 0.9656112, 0.9665296, 0.967428, 0.9683092,
+      0.9691652, 0.9699784, 0.9707456, 0.9714956, 0.972214, 0.9729528,
+      0.9736472, 0.9743288, 0.9749872, 0.9756136, 0.9762216, 0.9768124,
+      0.9773852, 0.9779724, 0.9785264, 0.9790444, 0.979594, 0.9800972,
+      0.9806084, 0.9810724, 0.9815204, 0.981986, 0.982402, 0.9828264, 0.9832468,
+      0.9836584, 0.9840624, 0.9844664, 0.984846, 0.9852244, 0.9855824,
+      0.9859352, 0.9862732, 0.9866144, 0.98694, 0.9872576, 0.9875688, 0.9878772,
+      0.9881572, 0.9884244, 0.9886916, 0.9889452, 0.9892128, 0.9894624,
+      0.9897084, 0.9899288, 0.9901432, 0.990388, 0.9906216, 0.9908364,
+      0.9910504, 0.9912544, 0.9914488, 0.9916504, 0.9918256, 0.9920132,
+      0.9921988, 0.9923732, 0.9925576, 0.992726, 0.9928924, 0.9930556, 0.993218,
+      0.9933744, 0.9935272, 0.9936736, 0.9938036, 0.9939388, 0.9940696, 0.99419,
+      0.994314, 0.9944368, 0.99457, 0.9946884, 0.994808, 0.9949224, 0.9950372,
+      0.995146, 0.9952412, 0.9953436, 0.995452, 0.9955388, 0.9956312, 0.9957224,
+      0.9958144, 0.9959008, 0.9959828, 0.9960656, 0.9961488, 0.9962196,
+      0.9963012, 0.99638, 0.9964604, 0.9965312, 0.9965956, 0.996666, 0.9967224,
+      0.996784, 0.9968472, 0.9969044, 0.9969764, 0.9970344, 0.9970932, 0.997144,
+      0.9972044, 0.9972704, 0.9973188, 0.9973708, 0.997418, 0.997466, 0.9975192,
+      0.997566, 0.997608, 0.997648, 0.9976948, 0.9977424, 0.9977828, 0.997824,
+      0.9978564, 0.9978932, 0.9979268, 0.997962, 0.9980028, 0.9980396,
+      0.9980792, 0.9981144, 0.998148, 0.998186, 0.9982236, 0.9982548, 0.9982888,
+      0.9983224, 0.9983552, 0.9983876, 0.998416, 0.9984468, 0.9984836, 0.998508,
+      0.9985404, 0.9985708, 0.9985972, 0.9986236, 0.9986524, 0.9986732,
+      0.9986988, 0.998718, 0.9987384, 0.9987604, 0.9987868, 0.99881, 0.9988308,
+      0.9988544, 0.9988764, 0.9988956, 0.998916, 0.9989332, 0.9995444,
+      0.9997996, 0.9999996
+   },
+   { // n=12
+      0, 0.0009744, 0.0965496, 0.3160936, 0.5196468, 0.66987, 0.7732516,
+      0.77993, 0.786362, 0.7926532, 0.798758, 0.804652, 0.81037, 0.8159448,
+      0.8212704, 0.82644, 0.831524, 0.8364368, 0.8411624, 0.845744, 0.8501396,
+      0.8544728, 0.8586852, 0.8627716, 0.8667304, 0.8706052, 0.8742448,
+      0.8778052, 0.8812872, 0.8846996, 0.8879844, 0.8911448, 0.8942808,
+      0.8972892, 0.9002168, 0.9030384, 0.9057556, 0.908404, 0.910954, 0.9134828,
+      0.915946, 0.9182792, 0.9205408, 0.9227324, 0.924844, 0.9269436, 0.9289112,
+      0.9308624, 0.9327728, 0.9346576, 0.9364864, 0.938214, 0.9399416,
+      0.9415632, 0.9431512, 0.9446956, 0.9461836, 0.947618, 0.9490872,
+      0.9504184, 0.9517548, 0.9530432, 0.9543128, 0.9555264, 0.9567208,
+      0.9578248, 0.9589196, 0.960008, 0.961048, 0.9620548, 0.96305, 0.9640008,
+      0.9649696, 0.965902, 0.9667788, 0.967642, 0.9684792, 0.9693036, 0.9701308,
+      0.9708952, 0.9716344, 0.9723684, 0.9730792, 0.9737784, 0.9744464,
+      0.9750936, 0.975734, 0.97632, 0.9769364, 0.9775444, 0.9781068, 0.9786688,
+      0.9792448, 0.9797692, 0.9802656, 0.9807552, 0.9812376, 0.9817188,
+      0.982192, 0.982654, 0.9830588, 0.9834972, 0.9839052, 0.984308, 0.984676,
+      0.9850608, 0.9854508, 0.9858028, 0.9861388, 0.9864604, 0.9867776,
+      0.9870992, 0.9874184, 0.9877216, 0.9880268, 0.9883132, 0.9885964,
+      0.9888516, 0.9891112, 0.9893628, 0.9896076, 0.9898564, 0.9901108,
+      0.9903432, 0.9905468, 0.9907696, 0.9909708, 0.9911812, 0.9913744,
+      0.9915696, 0.991754, 0.991942, 0.9921232, 0.992298, 0.992466, 0.9926364,
+      0.9927932, 0.992938, 0.9930936, 0.9932608, 0.9934188, 0.993554, 0.9936944,
+      0.9938252, 0.9939632, 0.9940916, 0.9942112, 0.9943424, 0.9944592,
+      0.9945644, 0.9946752, 0.9947988, 0.9949076, 0.995014, 0.9951236,
+      0.9952232, 0.9953308, 0.995422, 0.9955268, 0.9956252, 0.9957268,
+      0.9958196, 0.9959012, 0.9959864, 0.9960856, 0.9961688, 0.9962536,
+      0.9963472, 0.9964264, 0.9965052, 0.9965824, 0.9966536, 0.99672, 0.996794,
+      0.9968568, 0.9969164, 0.9969792, 0.9970364, 0.9971032, 0.9971548,
+      0.9972176, 0.9972684, 0.997336, 0.9973816, 0.9974384, 0.99748, 0.9975284,
+      0.9975776, 0.9976168, 0.997668, 0.997714, 0.9977672, 0.9978128, 0.997858,
+      0.9978984, 0.997932, 0.9979744, 0.9980132, 0.9980464, 0.9980852,
+      0.9981256, 0.9981584, 0.9981928, 0.9982292, 0.9982624, 0.9982972,
+      0.998336, 0.9983724, 0.9984044, 0.9984356, 0.9984632, 0.9984964, 0.998522,
+      0.9985536, 0.998578, 0.9986028, 0.9986336, 0.9986572, 0.9986816, 0.998708,
+      0.9987308, 0.9987552, 0.9987724, 0.9987896, 0.998816, 0.9988336,
+      0.9988524, 0.998872, 0.9988948, 0.9989148, 0.9989352, 0.998952, 0.9995692,
+      0.9998176, 1
+   },
+   { // n=13
+      0, 0.0010092, 0.0969712, 0.3156584, 0.5187532, 0.6687956, 0.7721972,
+      0.7789264, 0.7853636, 0.7917168, 0.7977264, 0.8036944, 0.809362,
+      0.8148248, 0.8201484, 0.8254192, 0.8304436, 0.835274, 0.8399592,
+      0.8446072, 0.8490916, 0.8534376, 0.8576396, 0.8617048, 0.8657048,
+      0.8695016, 0.8731856, 0.8767832, 0.8802412, 0.8836288, 0.8869728,
+      0.8901496, 0.893248, 0.8962548, 0.89921, 0.9020056, 0.9047676, 0.9074248,
+      0.9100264, 0.9125688, 0.9149924, 0.917382, 0.9197068, 0.9219492,
+      0.9241224, 0.9262104, 0.9282836, 0.9302528, 0.9321108, 0.9340128,
+      0.9358252, 0.9376004, 0.9393812, 0.9410464, 0.9426516, 0.9441952,
+      0.945688, 0.947164, 0.9485748, 0.9499088, 0.9512296, 0.9525388, 0.9538256,
+      0.955066, 0.9562752, 0.9574708, 0.9586216, 0.959694, 0.960778, 0.9617752,
+      0.9628052, 0.9638016, 0.9647488, 0.9656548, 0.9665648, 0.9674504,
+      0.9682916, 0.9690896, 0.9698972, 0.9706836, 0.971414, 0.9721632, 0.972872,
+      0.973588, 0.9742472, 0.974906, 0.9755296, 0.9761688, 0.9767624, 0.9773408,
+      0.977932, 0.9784956, 0.9790492, 0.9795632, 0.9800752, 0.9805612, 0.981038,
+      0.981502, 0.9819792, 0.9824376, 0.9828624, 0.9832828, 0.9836844,
+      0.9840756, 0.9844756, 0.984836, 0.9852044, 0.9855756, 0.985926, 0.9862792,
+      0.9866068, 0.9869292, 0.987258, 0.987532, 0.9878272, 0.9881028, 0.9883876,
+      0.9886512, 0.9889188, 0.9891768, 0.9894412, 0.989688, 0.98991, 0.9901484,
+      0.990378, 0.9906132, 0.9908372, 0.99105, 0.9912464, 0.9914528, 0.99165,
+      0.9918372, 0.9920344, 0.9922272, 0.9924104, 0.992574, 0.9927368,
+      0.9928972, 0.99305, 0.9932224, 0.993372, 0.9935236, 0.9936704, 0.9938116,
+      0.9939516, 0.9940832, 0.994212, 0.994336, 0.994464, 0.9945904, 0.9946944,
+      0.9948112, 0.9949224, 0.9950324, 0.9951408, 0.9952468, 0.9953484,
+      0.9954752, 0.9955812, 0.995676, 0.9957692, 0.9958656, 0.9959576,
+      0.9960444, 0.9961304, 0.9962128, 0.9963024, 0.9963748, 0.9964504,
+      0.9965244, 0.9965948, 0.9966716, 0.9967396, 0.9968044, 0.9968644,
+      0.996928, 0.9969948, 0.9970476, 0.997108, 0.9971648, 0.9972248, 0.9972824,
+      0.9973324, 0.9973868, 0.9974432, 0.9974896, 0.9975336, 0.997584,
+      0.9976276, 0.997668, 0.9977132, 0.9977596, 0.9978008, 0.9978432, 0.99788,
+      0.9979232, 0.9979616, 0.9980064, 0.9980376, 0.9980712, 0.9981136,
+      0.9981464, 0.9981788, 0.998214, 0.9982408, 0.9982728, 0.9983088,
+      0.9983436, 0.998374, 0.9984032, 0.9984288, 0.998454, 0.9984776, 0.99851,
+      0.9985444, 0.998574, 0.9986004, 0.9986232, 0.998648, 0.9986696, 0.998694,
+      0.9987184, 0.9987476, 0.9987664, 0.9987924, 0.9988148, 0.9988376,
+      0.9988648, 0.9988868, 0.9989072, 0.9989256, 0.9989448, 0.999574,
+      0.9998148, 1
+   },
+   { // n=14
+      0, 0.0010884, 0.0966452, 0.3142448, 0.517612, 0.6676148, 0.7713068,
+      0.7779016, 0.7844008, 0.79064, 0.7967808, 0.80275, 0.8085024, 0.8140016,
+      0.8194516, 0.8247316, 0.829848, 0.8348236, 0.839658, 0.8442924, 0.848664,
+      0.8530068, 0.8571844, 0.8612304, 0.8652076, 0.8690348, 0.8727676,
+      0.8763472, 0.8799356, 0.8833932, 0.886744, 0.8899328, 0.8930276, 0.896062,
+      0.8990164, 0.9019408, 0.9046864, 0.9073532, 0.9099436, 0.912436,
+      0.9148668, 0.9172432, 0.9194924, 0.9216952, 0.9238184, 0.9259432,
+      0.9280048, 0.9299436, 0.9319044, 0.9337104, 0.9355064, 0.9372448,
+      0.938948, 0.9406036, 0.9422152, 0.9438072, 0.9453192, 0.9467812,
+      0.9482104, 0.949584, 0.9509532, 0.9522664, 0.9535352, 0.954786, 0.9560108,
+      0.9572, 0.9582972, 0.9594224, 0.9604652, 0.9615168, 0.9625444, 0.9634776,
+      0.964462, 0.9653556, 0.9662544, 0.9671592, 0.9679776, 0.9688168,
+      0.9696332, 0.970424, 0.971158, 0.9719232, 0.9726624, 0.9733536, 0.9740436,
+      0.9747236, 0.9753688, 0.975994, 0.9766284, 0.9772036, 0.9777652,
+      0.9783192, 0.9788692, 0.9794132, 0.9799392, 0.9804544, 0.9809584,
+      0.9814192, 0.9818516, 0.9822896, 0.9827164, 0.9831308, 0.9835272,
+      0.9839268, 0.9843108, 0.9846988, 0.9850912, 0.985464, 0.9858052,
+      0.9861368, 0.9864636, 0.9867876, 0.9871216, 0.9874244, 0.9877324,
+      0.9880296, 0.9883136, 0.9885924, 0.9888464, 0.989098, 0.9893496,
+      0.9896124, 0.989872, 0.9901212, 0.9903368, 0.9905688, 0.990812, 0.9910328,
+      0.9912304, 0.991446, 0.991638, 0.9918448, 0.9920376, 0.992222, 0.9923832,
+      0.9925592, 0.9927396, 0.9929032, 0.9930616, 0.9932264, 0.9933688,
+      0.9935124, 0.99366, 0.9937968, 0.9939456, 0.9940924, 0.9942304, 0.9943608,
+      0.9944832, 0.9946008, 0.9947204, 0.9948264, 0.9949392, 0.9950408,
+      0.995152, 0.9952612, 0.9953628, 0.9954584, 0.9955452, 0.995654, 0.9957576,
+      0.9958524, 0.9959456, 0.9960324, 0.9961184, 0.9962052, 0.9962864,
+      0.9963644, 0.9964528, 0.9965192, 0.9965836, 0.9966572, 0.9967384,
+      0.9968048, 0.9968772, 0.9969408, 0.997006, 0.997074, 0.9971396, 0.997204,
+      0.9972584, 0.9973092, 0.9973668, 0.9974172, 0.997472, 0.9975224, 0.99758,
+      0.9976232, 0.9976676, 0.9977112, 0.9977592, 0.9978052, 0.9978532,
+      0.9978988, 0.9979456, 0.9979836, 0.9980216, 0.9980664, 0.9981092,
+      0.9981484, 0.9981768, 0.9982112, 0.9982412, 0.9982768, 0.9983108,
+      0.998342, 0.9983732, 0.9984048, 0.9984432, 0.9984712, 0.9984968,
+      0.9985224, 0.9985476, 0.9985804, 0.9986076, 0.99864, 0.998666, 0.9986888,
+      0.9987076, 0.9987312, 0.9987612, 0.9987788, 0.9988, 0.9988252, 0.9988468,
+      0.9988648, 0.998886, 0.9989104, 0.9989284, 0.9989464, 0.9989596,
+      0.9989804, 0.9995728, 0.9998224, 1
+   },
+   { // n=15
+      0, 0.0011472, 0.0966472, 0.3142668, 0.5169816, 0.6667324, 0.7706068,
+      0.7774072, 0.7838828, 0.7900768, 0.7960784, 0.8020476, 0.807726,
+      0.8132396, 0.8185824, 0.82382, 0.828886, 0.8338312, 0.8386028, 0.843214,
+      0.84772, 0.8520732, 0.8563168, 0.8604188, 0.8643712, 0.8682348, 0.8720176,
+      0.8756296, 0.8791944, 0.8826224, 0.8859492, 0.8890796, 0.892318,
+      0.8953276, 0.8983088, 0.9011612, 0.9039532, 0.9066052, 0.909224,
+      0.9117368, 0.914192, 0.9165044, 0.918766, 0.9210244, 0.9231848, 0.925288,
+      0.927336, 0.9293232, 0.9312956, 0.9331604, 0.934982, 0.9367976, 0.9385132,
+      0.9401928, 0.9417864, 0.943352, 0.944884, 0.9463932, 0.9478484, 0.9492124,
+      0.9505592, 0.9518544, 0.953138, 0.9543916, 0.9556156, 0.956812, 0.9579596,
+      0.9590568, 0.9601244, 0.9611924, 0.9622476, 0.963272, 0.9641988,
+      0.9651276, 0.9660284, 0.9668828, 0.96777, 0.96862, 0.9694096, 0.9701884,
+      0.9709872, 0.9717204, 0.9724596, 0.9731656, 0.9738372, 0.9745084,
+      0.9751236, 0.975774, 0.9763748, 0.9769872, 0.9775572, 0.978134, 0.9786876,
+      0.9792216, 0.9797424, 0.980242, 0.9807332, 0.9812076, 0.9816672,
+      0.9821192, 0.982552, 0.9829616, 0.9833828, 0.983788, 0.9841908, 0.9845944,
+      0.9849772, 0.9853496, 0.9857092, 0.9860544, 0.9863924, 0.9867408,
+      0.987046, 0.9873704, 0.9876624, 0.9879528, 0.988244, 0.9885188, 0.988778,
+      0.9890464, 0.9893216, 0.9895848, 0.9898336, 0.9900828, 0.990306,
+      0.9905476, 0.9907748, 0.990988, 0.9911976, 0.991426, 0.9916396, 0.9918472,
+      0.9920272, 0.9922236, 0.9924064, 0.992578, 0.992758, 0.99292, 0.9930804,
+      0.9932476, 0.9933972, 0.9935388, 0.9936748, 0.9938228, 0.9939632,
+      0.9941016, 0.9942344, 0.9943596, 0.9944948, 0.994604, 0.9947264,
+      0.9948444, 0.9949656, 0.9950752, 0.99518, 0.9952844, 0.99539, 0.9954876,
+      0.9955856, 0.9956796, 0.9957736, 0.9958648, 0.9959564, 0.9960552,
+      0.9961416, 0.9962224, 0.9963012, 0.996378, 0.9964496, 0.9965208, 0.99659,
+      0.9966676, 0.9967336, 0.9968128, 0.9968808, 0.9969452, 0.9970076,
+      0.9970648, 0.9971284, 0.9971824, 0.9972456, 0.9972984, 0.9973588,
+      0.9974136, 0.9974612, 0.997512, 0.9975584, 0.99761, 0.9976612, 0.9977056,
+      0.9977616, 0.9978084, 0.997856, 0.9979008, 0.9979416, 0.9979904,
+      0.9980232, 0.9980656, 0.998106, 0.9981444, 0.9981812, 0.9982188,
+      0.9982536, 0.9982908, 0.9983228, 0.9983604, 0.9983904, 0.9984216,
+      0.9984576, 0.9984872, 0.9985156, 0.9985468, 0.9985788, 0.9986076,
+      0.998634, 0.998654, 0.9986776, 0.9987048, 0.998728, 0.998752, 0.9987776,
+      0.9987996, 0.9988232, 0.9988476, 0.9988696, 0.998888, 0.99891, 0.9989324,
+      0.9989576, 0.9989768, 0.9989912, 0.9990124, 0.9996124, 0.999838, 1
+   },
+   { // n=16
+      0, 0.0011832, 0.0969364, 0.3135428, 0.5157748, 0.6657872, 0.7692776,
+      0.7759628, 0.7825, 0.7888736, 0.794998, 0.8008632, 0.8066708, 0.812274,
+      0.8176832, 0.8229648, 0.8280528, 0.8329828, 0.837722, 0.8423244, 0.846816,
+      0.851192, 0.8554244, 0.8595368, 0.8635128, 0.86736, 0.8711352, 0.8747556,
+      0.8783184, 0.8817768, 0.8851136, 0.8883532, 0.8914488, 0.8944844,
+      0.897456, 0.900364, 0.9031228, 0.9058264, 0.9084312, 0.9109132, 0.91336,
+      0.9157356, 0.9180604, 0.9203208, 0.922508, 0.9246148, 0.9267004, 0.928668,
+      0.9306016, 0.9325024, 0.93435, 0.9361284, 0.9378536, 0.9395316, 0.9411816,
+      0.942774, 0.9443028, 0.9458164, 0.9472332, 0.9486436, 0.9500348,
+      0.9514016, 0.9526988, 0.9539536, 0.9551772, 0.9563744, 0.9575136,
+      0.9586612, 0.9597468, 0.9608164, 0.9618256, 0.9628244, 0.9638016, 0.96473,
+      0.9656756, 0.966566, 0.9674456, 0.9682788, 0.9690716, 0.9699108,
+      0.9706868, 0.971436, 0.9721748, 0.9728884, 0.9735824, 0.9742536,
+      0.9749172, 0.9755604, 0.9761856, 0.9767724, 0.9773532, 0.9779476,
+      0.9785116, 0.9790632, 0.9795764, 0.9800816, 0.980596, 0.9810916,
+      0.9815676, 0.9820284, 0.9824608, 0.9828964, 0.9833304, 0.9837632,
+      0.9841652, 0.9845628, 0.9849584, 0.985322, 0.985674, 0.9860236, 0.9863596,
+      0.9866928, 0.9870068, 0.9873164, 0.9876048, 0.9879044, 0.9882008,
+      0.9884856, 0.9887592, 0.9890088, 0.9892792, 0.9895452, 0.989802,
+      0.9900432, 0.9902768, 0.9905048, 0.9907288, 0.990932, 0.9911452,
+      0.9913696, 0.9915712, 0.991768, 0.991972, 0.9921672, 0.9923556, 0.9925276,
+      0.9926956, 0.9928652, 0.9930316, 0.99319, 0.9933468, 0.9934952, 0.9936372,
+      0.9937764, 0.9939196, 0.9940544, 0.9941768, 0.9942988, 0.99442, 0.994548,
+      0.9946612, 0.9947776, 0.9948976, 0.9950112, 0.9951256, 0.995236,
+      0.9953416, 0.995432, 0.9955364, 0.9956368, 0.9957252, 0.9958172,
+      0.9959032, 0.9960016, 0.9960968, 0.9961832, 0.9962652, 0.9963504,
+      0.9964248, 0.9965004, 0.996574, 0.9966416, 0.996712, 0.9967724, 0.9968456,
+      0.9969196, 0.9969844, 0.99704, 0.9970984, 0.9971632, 0.99723, 0.9972888,
+      0.9973436, 0.997402, 0.9974496, 0.9975008, 0.9975492, 0.9975984,
+      0.9976452, 0.9976924, 0.9977404, 0.9977872, 0.997832, 0.9978728,
+      0.9979136, 0.9979604, 0.9979968, 0.9980372, 0.9980744, 0.9981116,
+      0.9981512, 0.9981852, 0.9982232, 0.9982588, 0.9982948, 0.9983364,
+      0.9983688, 0.9984, 0.9984292, 0.9984604, 0.9984916, 0.9985268, 0.9985604,
+      0.9985876, 0.9986172, 0.9986484, 0.9986744, 0.9986976, 0.99872, 0.9987492,
+      0.998776, 0.998802, 0.998832, 0.9988532, 0.998874, 0.9988972, 0.9989128,
+      0.9989328, 0.9989512, 0.998972, 0.9989948, 0.9990184, 0.9995972,
+      0.9998312, 1
+   },
+   { // n=17
+      0, 0.0011884, 0.096884, 0.31312, 0.5154296, 0.665488, 0.7692692, 0.77604,
+      0.7826024, 0.7889772, 0.7951312, 0.801018, 0.8067972, 0.8123232,
+      0.8177944, 0.82304, 0.8281548, 0.833144, 0.8378744, 0.8424672, 0.8469664,
+      0.8513804, 0.8556132, 0.8597084, 0.8636632, 0.867484, 0.8712556,
+      0.8749112, 0.8784088, 0.8818272, 0.8851576, 0.8883684, 0.8914908,
+      0.8945132, 0.8974412, 0.9002688, 0.9030784, 0.90577, 0.9083976, 0.91092,
+      0.913376, 0.9157696, 0.9181344, 0.9204024, 0.9225868, 0.924704, 0.9267456,
+      0.928696, 0.9306196, 0.9325304, 0.9343196, 0.9361128, 0.9378304, 0.939494,
+      0.9410816, 0.9426652, 0.9441828, 0.9456756, 0.9471416, 0.9485184,
+      0.9499544, 0.9512604, 0.952568, 0.9538208, 0.9550152, 0.9561868,
+      0.9573708, 0.9584532, 0.9595328, 0.9605756, 0.9616184, 0.9625944,
+      0.9635832, 0.964554, 0.9654668, 0.9663552, 0.9672444, 0.9680884,
+      0.9689016, 0.9696608, 0.9704436, 0.971162, 0.9718932, 0.9726404,
+      0.9733712, 0.9740432, 0.9747096, 0.9753376, 0.9759624, 0.97658, 0.9771728,
+      0.9777328, 0.9782944, 0.9788384, 0.979368, 0.9798652, 0.9803712,
+      0.9808696, 0.9813528, 0.9818304, 0.9822628, 0.9827072, 0.9831248,
+      0.9835476, 0.98395, 0.9843524, 0.984734, 0.9851008, 0.9854912, 0.9858548,
+      0.9861816, 0.9865136, 0.9868504, 0.9871656, 0.987482, 0.9877852, 0.988072,
+      0.9883592, 0.98863, 0.9889048, 0.9891696, 0.9894228, 0.9896648, 0.9898968,
+      0.9901364, 0.99038, 0.99061, 0.9908276, 0.9910548, 0.99127, 0.991466,
+      0.9916556, 0.9918416, 0.9920332, 0.9922204, 0.992404, 0.9925776,
+      0.9927484, 0.9929076, 0.9930692, 0.9932336, 0.9934008, 0.9935652,
+      0.9936964, 0.993856, 0.9940056, 0.9941484, 0.9942764, 0.99441, 0.9945304,
+      0.9946408, 0.994748, 0.9948536, 0.994964, 0.9950772, 0.9951804, 0.9952812,
+      0.9953916, 0.9954924, 0.9956004, 0.9957036, 0.9958076, 0.995894,
+      0.9959796, 0.99606, 0.9961448, 0.9962236, 0.9963064, 0.996382, 0.9964648,
+      0.9965428, 0.9966144, 0.9966808, 0.9967512, 0.9968172, 0.99688, 0.9969464,
+      0.9970104, 0.9970792, 0.9971364, 0.9971996, 0.9972528, 0.9973072,
+      0.9973648, 0.9974116, 0.9974596, 0.9975128, 0.9975628, 0.997604,
+      0.9976572, 0.9977088, 0.9977576, 0.9978052, 0.9978516, 0.997888,
+      0.9979352, 0.997976, 0.9980176, 0.998058, 0.9980988, 0.9981396, 0.9981732,
+      0.998208, 0.998252, 0.99829, 0.99832, 0.9983516, 0.9983856, 0.99842,
+      0.998452, 0.9984832, 0.998518, 0.9985428, 0.9985688, 0.9985996, 0.9986292,
+      0.9986544, 0.9986784, 0.9987004, 0.9987284, 0.9987552, 0.9987748,
+      0.9987996, 0.9988204, 0.9988392, 0.9988632, 0.9988812, 0.9989032,
+      0.9989216, 0.9989448, 0.9989636, 0.9989848, 0.999586, 0.9998364,
+      0.9999996
+   },
+   { // n=18
+      0, 0.0012424, 0.0969764, 0.3132684, 0.5154364, 0.6654096, 0.7690384,
+      0.77569, 0.7821436, 0.7883484, 0.7945044, 0.8003948, 0.806138, 0.81174,
+      0.8171256, 0.82239, 0.8274568, 0.8323328, 0.8370948, 0.8417412, 0.8461752,
+      0.8506004, 0.8548136, 0.8589456, 0.8628744, 0.866702, 0.8704476,
+      0.8740204, 0.8775388, 0.8809196, 0.8842252, 0.8874172, 0.8906, 0.8936884,
+      0.8966976, 0.899588, 0.9023424, 0.9050456, 0.9076924, 0.9101828,
+      0.9126228, 0.91503, 0.9173364, 0.9196272, 0.9218392, 0.9240104, 0.9260432,
+      0.9280412, 0.9300008, 0.9319336, 0.9337908, 0.9355592, 0.9373152,
+      0.9389984, 0.9406856, 0.9422608, 0.9438268, 0.9453396, 0.9468176,
+      0.9482068, 0.9495876, 0.9508908, 0.9521948, 0.9534568, 0.9546724,
+      0.955864, 0.9570352, 0.9581564, 0.959214, 0.960326, 0.9613388, 0.9623244,
+      0.9633224, 0.9642656, 0.9652084, 0.9661428, 0.9670308, 0.9678912,
+      0.9687136, 0.969508, 0.9702964, 0.9710916, 0.9718352, 0.9725356, 0.973244,
+      0.9739288, 0.974632, 0.9752764, 0.9758988, 0.9765052, 0.9770948, 0.977672,
+      0.9782456, 0.9787904, 0.9793252, 0.979864, 0.9803812, 0.9808484,
+      0.9813124, 0.9817744, 0.9822128, 0.982646, 0.9830748, 0.983478, 0.9838928,
+      0.9842828, 0.984678, 0.985068, 0.9854176, 0.9857832, 0.9861076, 0.9864448,
+      0.9867704, 0.9870804, 0.9873856, 0.9876772, 0.987958, 0.9882572,
+      0.9885236, 0.9888008, 0.9890828, 0.989344, 0.9895948, 0.9898316,
+      0.9900872, 0.9903148, 0.9905476, 0.9907632, 0.9909976, 0.991204, 0.991414,
+      0.991624, 0.9918304, 0.9920272, 0.99221, 0.9923976, 0.9925756, 0.992732,
+      0.992906, 0.99307, 0.9932312, 0.9933912, 0.993542, 0.993696, 0.9938368,
+      0.993968, 0.994116, 0.9942532, 0.9943768, 0.9944948, 0.9946064, 0.994726,
+      0.994862, 0.9949756, 0.9950928, 0.9951972, 0.995314, 0.9954092, 0.9955072,
+      0.9955992, 0.995704, 0.9958044, 0.9958956, 0.9959912, 0.9960792,
+      0.9961644, 0.9962448, 0.996326, 0.9964096, 0.9964868, 0.9965624,
+      0.9966368, 0.9967084, 0.99678, 0.9968484, 0.9969112, 0.9969784, 0.997056,
+      0.9971176, 0.9971912, 0.9972472, 0.9973016, 0.9973616, 0.997412,
+      0.9974648, 0.9975284, 0.9975844, 0.9976356, 0.9976864, 0.9977308,
+      0.9977828, 0.997826, 0.9978696, 0.9979136, 0.9979596, 0.998002, 0.9980456,
+      0.998086, 0.9981244, 0.9981652, 0.9982004, 0.9982364, 0.9982788,
+      0.9983152, 0.9983436, 0.9983752, 0.998406, 0.9984388, 0.9984672, 0.998494,
+      0.998522, 0.9985568, 0.9985892, 0.9986172, 0.9986412, 0.998668, 0.9986956,
+      0.9987176, 0.9987416, 0.9987636, 0.9987868, 0.9988084, 0.9988364,
+      0.998854, 0.9988708, 0.9988948, 0.9989148, 0.9989332, 0.9989512,
+      0.9989704, 0.9989896, 0.9990072, 0.9996264, 0.999846, 0.9999996
+   },
+   { // n=19
+      0, 0.001242, 0.0966552, 0.3126748, 0.5144212, 0.664278, 0.7683492,
+      0.7750052, 0.7815104, 0.7877376, 0.7938528, 0.7998128, 0.805552, 0.811032,
+      0.8164664, 0.8217348, 0.826772, 0.8316688, 0.8364844, 0.8411296, 0.84564,
+      0.8500704, 0.8542916, 0.858408, 0.8623892, 0.8663108, 0.8701636,
+      0.8738332, 0.8774296, 0.8808248, 0.8841652, 0.8873808, 0.890524,
+      0.8934736, 0.8964152, 0.8993292, 0.9020196, 0.9047132, 0.9073192,
+      0.9098728, 0.912332, 0.9146696, 0.9170328, 0.9192884, 0.9214828,
+      0.9236096, 0.9257188, 0.9276932, 0.9296628, 0.9315664, 0.9334228,
+      0.935228, 0.9369376, 0.9386028, 0.9402688, 0.9418908, 0.9434404,
+      0.9449624, 0.9464224, 0.9478584, 0.9492308, 0.9505732, 0.9519316,
+      0.9531916, 0.9544432, 0.9556248, 0.9567852, 0.9579412, 0.9590448,
+      0.9600876, 0.9611276, 0.9621472, 0.9631288, 0.964066, 0.9649828,
+      0.9658828, 0.9667572, 0.967624, 0.9684432, 0.969264, 0.970074, 0.9708416,
+      0.9716208, 0.9723164, 0.973006, 0.9737216, 0.9744072, 0.975038, 0.9756644,
+      0.9762876, 0.9768828, 0.9774476, 0.9780032, 0.978546, 0.9790876, 0.9796,
+      0.9801016, 0.980614, 0.9811056, 0.9815604, 0.9820324, 0.982474, 0.982912,
+      0.9833504, 0.9837472, 0.9841608, 0.9845532, 0.9849248, 0.98528, 0.98563,
+      0.9859812, 0.98632, 0.9866616, 0.9869952, 0.9873044, 0.9876032, 0.9879064,
+      0.988196, 0.9884584, 0.9887448, 0.989016, 0.9892772, 0.9895312, 0.9897704,
+      0.9900028, 0.9902304, 0.990456, 0.9906848, 0.9909112, 0.9911084,
+      0.9913308, 0.991526, 0.9917252, 0.991904, 0.9920816, 0.992266, 0.9924392,
+      0.9926124, 0.9927788, 0.992932, 0.9930912, 0.9932476, 0.9934016,
+      0.9935452, 0.993688, 0.9938296, 0.993972, 0.9940956, 0.9942244, 0.994344,
+      0.9944732, 0.9946064, 0.9947348, 0.9948524, 0.9949664, 0.995088, 0.995196,
+      0.9953104, 0.995404, 0.9955088, 0.9956108, 0.995714, 0.9958016, 0.9958892,
+      0.9959796, 0.9960596, 0.9961368, 0.996224, 0.9963032, 0.996382, 0.996464,
+      0.9965304, 0.9966088, 0.9966792, 0.9967464, 0.9968144, 0.9968784,
+      0.996946, 0.9970084, 0.9970768, 0.9971444, 0.9971992, 0.9972508,
+      0.9973132, 0.9973704, 0.99743, 0.9974812, 0.9975324, 0.9975848, 0.9976372,
+      0.9976832, 0.9977328, 0.9977752, 0.9978252, 0.9978668, 0.997906, 0.99795,
+      0.9979912, 0.9980332, 0.998078, 0.998108, 0.9981444, 0.9981792, 0.99821,
+      0.9982524, 0.9982888, 0.998324, 0.9983552, 0.9983868, 0.9984204,
+      0.9984496, 0.9984864, 0.9985212, 0.998552, 0.9985764, 0.9985992,
+      0.9986284, 0.9986532, 0.9986768, 0.9986972, 0.9987276, 0.998752,
+      0.9987788, 0.998792, 0.998814, 0.9988328, 0.998854, 0.9988856, 0.9989088,
+      0.9989324, 0.9989564, 0.9989736, 0.9996024, 0.9998408, 1
+   },
+   { // n=20
+      0, 0.0012488, 0.0965244, 0.3118604, 0.5141048, 0.6639284, 0.7675224,
+      0.7742804, 0.7808404, 0.787078, 0.7931804, 0.7991004, 0.8049416,
+      0.8106064, 0.8160416, 0.8213088, 0.8264368, 0.8314184, 0.836216, 0.840884,
+      0.8453532, 0.8497948, 0.8541248, 0.858234, 0.8622368, 0.8661164,
+      0.8697916, 0.873502, 0.877072, 0.880468, 0.8838116, 0.887094, 0.890248,
+      0.8932872, 0.8961984, 0.8991408, 0.901958, 0.904672, 0.907282, 0.9098644,
+      0.9123104, 0.9147216, 0.917074, 0.9193336, 0.9215444, 0.9237336,
+      0.9258044, 0.9278848, 0.9297952, 0.9317384, 0.9335344, 0.9353016,
+      0.9370524, 0.9387492, 0.9403872, 0.9420164, 0.9435696, 0.9450748,
+      0.9464908, 0.947938, 0.949304, 0.9506464, 0.9519556, 0.9532224, 0.9544716,
+      0.9556712, 0.9568288, 0.9579616, 0.95908, 0.9601416, 0.9611744, 0.9621992,
+      0.9632012, 0.9641716, 0.9651284, 0.9660312, 0.9669228, 0.9677436,
+      0.9685844, 0.9694276, 0.9702156, 0.9709736, 0.971704, 0.9724276,
+      0.9731164, 0.973774, 0.974456, 0.9751076, 0.9757116, 0.9763232, 0.9769052,
+      0.977476, 0.9780336, 0.9785832, 0.979124, 0.9796492, 0.9801472, 0.980648,
+      0.9810956, 0.9815504, 0.9820168, 0.982462, 0.9828824, 0.9832936, 0.983704,
+      0.984104, 0.9844872, 0.9848652, 0.9852416, 0.9856056, 0.9859568,
+      0.9862996, 0.9866168, 0.9869596, 0.9872688, 0.9875728, 0.9878804,
+      0.9881832, 0.9884764, 0.9887484, 0.9890064, 0.9892852, 0.9895568,
+      0.9898176, 0.9900488, 0.9902908, 0.9904972, 0.9907252, 0.9909356, 0.99114,
+      0.9913472, 0.9915456, 0.9917384, 0.991916, 0.9921128, 0.9923096, 0.99249,
+      0.9926808, 0.9928368, 0.9930004, 0.9931532, 0.9933044, 0.9934616,
+      0.9936108, 0.9937612, 0.993898, 0.9940348, 0.9941696, 0.9943156,
+      0.9944568, 0.9945848, 0.9947036, 0.994822, 0.9949264, 0.9950444,
+      0.9951524, 0.995266, 0.9953752, 0.9954808, 0.9955868, 0.9956852,
+      0.9957764, 0.9958748, 0.9959672, 0.9960592, 0.9961476, 0.9962252,
+      0.9963112, 0.9963884, 0.9964728, 0.9965556, 0.9966284, 0.996702,
+      0.9967824, 0.9968548, 0.9969188, 0.996984, 0.9970476, 0.9971108,
+      0.9971652, 0.9972256, 0.997292, 0.997342, 0.997398, 0.9974532, 0.9975116,
+      0.9975744, 0.99763, 0.99769, 0.9977452, 0.99779, 0.9978428, 0.9978872,
+      0.9979288, 0.99797, 0.9980152, 0.9980588, 0.9980996, 0.99813, 0.9981708,
+      0.9982148, 0.9982512, 0.9982928, 0.9983252, 0.99836, 0.998394, 0.998428,
+      0.9984556, 0.9984884, 0.9985196, 0.9985504, 0.9985808, 0.9986052,
+      0.9986348, 0.9986648, 0.9986932, 0.9987164, 0.9987428, 0.9987684,
+      0.9987936, 0.9988152, 0.9988392, 0.9988572, 0.9988864, 0.9989148,
+      0.9989328, 0.9989568, 0.9989788, 0.9989992, 0.999018, 0.999036, 0.9990524,
+      0.999644, 0.9998496, 1
+   },
+   { // n=21
+      0, 0.0013244, 0.0968444, 0.3123072, 0.5139876, 0.6637192, 0.767538,
+      0.774286, 0.780844, 0.7872308, 0.7933244, 0.799242, 0.804988, 0.8105016,
+      0.8160204, 0.8213532, 0.8264172, 0.8313224, 0.8361488, 0.8407484,
+      0.8452812, 0.8497116, 0.853968, 0.8580448, 0.8620436, 0.8659836,
+      0.8697696, 0.873428, 0.8769772, 0.8803936, 0.883674, 0.8868892, 0.8900664,
+      0.893094, 0.8960116, 0.8989436, 0.9017668, 0.9044524, 0.9071012, 0.909694,
+      0.9121316, 0.9145336, 0.9168616, 0.9191448, 0.9213528, 0.9234516,
+      0.925538, 0.9275304, 0.929508, 0.9314668, 0.9333064, 0.9351148, 0.9368076,
+      0.9384756, 0.9401632, 0.9417948, 0.943338, 0.9448708, 0.946346, 0.9477744,
+      0.9491584, 0.9505208, 0.9518268, 0.9531352, 0.9543572, 0.9555684,
+      0.9567272, 0.9578756, 0.9589624, 0.960034, 0.9610956, 0.962118, 0.96311,
+      0.9640764, 0.965032, 0.9659656, 0.9668256, 0.9677028, 0.9685364,
+      0.9693544, 0.9701312, 0.9709012, 0.971624, 0.9723492, 0.9730784,
+      0.9737676, 0.9744668, 0.975102, 0.975712, 0.9763436, 0.9769388, 0.9775368,
+      0.9780924, 0.9786608, 0.9791892, 0.9797316, 0.9802432, 0.9807288,
+      0.9812232, 0.9816812, 0.9821484, 0.9825936, 0.9830204, 0.9834336,
+      0.9838492, 0.9842524, 0.9846252, 0.9849808, 0.9853352, 0.9856924,
+      0.9860432, 0.9864004, 0.9867244, 0.9870528, 0.9873684, 0.9876736,
+      0.9879676, 0.98826, 0.98857, 0.9888504, 0.9891176, 0.9893672, 0.989638,
+      0.9898724, 0.9901152, 0.9903572, 0.9905808, 0.9907972, 0.9909944,
+      0.9912008, 0.9914004, 0.9916104, 0.9918072, 0.9920088, 0.9921944,
+      0.9923764, 0.9925464, 0.9927128, 0.9928732, 0.9930444, 0.9931876,
+      0.9933572, 0.9935228, 0.9936684, 0.9938076, 0.9939576, 0.9940972,
+      0.9942272, 0.9943604, 0.9945032, 0.9946264, 0.9947464, 0.9948676,
+      0.9949728, 0.9950928, 0.9952132, 0.9953296, 0.9954364, 0.9955488,
+      0.9956452, 0.9957476, 0.9958492, 0.995946, 0.9960388, 0.9961344,
+      0.9962236, 0.996318, 0.9964048, 0.996478, 0.9965524, 0.996626, 0.9967072,
+      0.9967816, 0.996852, 0.9969128, 0.9969884, 0.9970532, 0.9971212,
+      0.9971852, 0.997246, 0.9973088, 0.9973632, 0.9974224, 0.9974644, 0.99752,
+      0.9975772, 0.9976312, 0.997678, 0.9977248, 0.9977676, 0.9978116,
+      0.9978624, 0.9979096, 0.9979484, 0.9979984, 0.998046, 0.9980892,
+      0.9981244, 0.998164, 0.9982064, 0.998246, 0.9982824, 0.9983132, 0.998352,
+      0.9983784, 0.9984124, 0.998448, 0.998478, 0.9985116, 0.9985432, 0.9985724,
+      0.998602, 0.9986312, 0.9986564, 0.998678, 0.9986996, 0.998734, 0.9987584,
+      0.9987828, 0.9988068, 0.9988228, 0.9988468, 0.9988752, 0.998902,
+      0.9989288, 0.9989496, 0.9989668, 0.9989856, 0.999006, 0.9990224,
+      0.9990424, 0.9990556, 0.9996312, 0.9998624, 1
+   },
+   { // n=22
+      0, 0.0013496, 0.096244, 0.3115472, 0.5133332, 0.662986, 0.76705,
+      0.7736912, 0.780172, 0.7864636, 0.7925668, 0.7985248, 0.8043176,
+      0.8098804, 0.815306, 0.8205968, 0.8256824, 0.8307804, 0.8356516,
+      0.8402852, 0.8447392, 0.8490756, 0.8532856, 0.8574416, 0.8614416,
+      0.865284, 0.8690436, 0.8726784, 0.8762188, 0.8796536, 0.8830288,
+      0.8862908, 0.889456, 0.8925084, 0.8954504, 0.8983704, 0.9011348, 0.903872,
+      0.906464, 0.9090524, 0.9115248, 0.913976, 0.9163084, 0.9185892, 0.9207976,
+      0.9229632, 0.9250724, 0.9270844, 0.9290456, 0.9309476, 0.9328248,
+      0.9346328, 0.9363496, 0.9379876, 0.9396596, 0.9412712, 0.9428472,
+      0.9443792, 0.9458616, 0.9473272, 0.948728, 0.950116, 0.951412, 0.9526592,
+      0.9538872, 0.955084, 0.9562864, 0.9574404, 0.9585896, 0.9596596,
+      0.9607024, 0.9617268, 0.9627064, 0.9636524, 0.9646116, 0.9655196,
+      0.9663956, 0.9672696, 0.9681116, 0.9689128, 0.9697056, 0.9704652,
+      0.971212, 0.9719356, 0.972662, 0.9733496, 0.9740148, 0.9746652, 0.9753336,
+      0.9759788, 0.9765856, 0.9771656, 0.977752, 0.978306, 0.9788404, 0.9793792,
+      0.9798936, 0.9804096, 0.9808984, 0.9813708, 0.9818396, 0.9822736,
+      0.982712, 0.9831484, 0.9835404, 0.9839372, 0.98432, 0.9846816, 0.985092,
+      0.9854492, 0.9858092, 0.986154, 0.9865012, 0.9868336, 0.9871456, 0.98746,
+      0.9877728, 0.9880808, 0.9883732, 0.9886632, 0.9889292, 0.9892, 0.9894628,
+      0.9897284, 0.9899688, 0.990206, 0.9904328, 0.9906716, 0.9908948, 0.991114,
+      0.9913232, 0.991516, 0.9917068, 0.9918944, 0.9920768, 0.9922864,
+      0.9924784, 0.9926616, 0.9928248, 0.9929884, 0.993156, 0.9933216,
+      0.9934616, 0.9936072, 0.9937412, 0.9938784, 0.99402, 0.9941488, 0.9942864,
+      0.9944216, 0.994548, 0.9946736, 0.9947888, 0.9949052, 0.995032, 0.9951496,
+      0.9952612, 0.9953704, 0.9954732, 0.995576, 0.995674, 0.9957716, 0.9958748,
+      0.9959696, 0.99605, 0.9961444, 0.9962192, 0.9963084, 0.996392, 0.9964828,
+      0.9965564, 0.9966296, 0.9967036, 0.9967772, 0.9968544, 0.9969204,
+      0.9969816, 0.99705, 0.9971216, 0.9971816, 0.9972428, 0.9972948, 0.9973568,
+      0.9974112, 0.9974632, 0.9975148, 0.997564, 0.997612, 0.9976668, 0.99772,
+      0.997768, 0.9978224, 0.9978692, 0.9979092, 0.9979588, 0.9980008,
+      0.9980412, 0.9980784, 0.9981248, 0.9981684, 0.9982088, 0.9982448,
+      0.9982828, 0.9983176, 0.9983576, 0.9983924, 0.9984244, 0.9984544, 0.99848,
+      0.9985108, 0.998542, 0.99857, 0.9986028, 0.9986312, 0.9986624, 0.9986844,
+      0.9987084, 0.998736, 0.9987688, 0.9987936, 0.9988192, 0.9988488,
+      0.9988716, 0.9988944, 0.9989164, 0.9989384, 0.9989596, 0.99898, 0.999002,
+      0.9990252, 0.9990432, 0.9990596, 0.999652, 0.9998652, 1
+   },
+   { // n=23
+      0, 0.0013864, 0.0967792, 0.3116324, 0.5136236, 0.6630428, 0.7668372,
+      0.7735624, 0.7801456, 0.7864872, 0.792656, 0.79854, 0.8043512, 0.809994,
+      0.815478, 0.820788, 0.8258964, 0.8307912, 0.8355976, 0.840272, 0.8448648,
+      0.8492324, 0.853482, 0.8576588, 0.8616344, 0.865532, 0.8693528, 0.8729672,
+      0.8765264, 0.8799788, 0.8833284, 0.8865416, 0.88978, 0.8928564, 0.8958048,
+      0.898698, 0.9014772, 0.9041824, 0.90679, 0.9093092, 0.9117852, 0.9141876,
+      0.9165208, 0.9188544, 0.9210572, 0.9232064, 0.9252736, 0.9272756,
+      0.9291856, 0.931098, 0.9329752, 0.9348188, 0.9365868, 0.9382888,
+      0.9399188, 0.9415696, 0.9431348, 0.9446788, 0.9461464, 0.9475632,
+      0.9489192, 0.9502612, 0.951568, 0.9528028, 0.9540724, 0.9552912,
+      0.9564508, 0.9576024, 0.9587352, 0.9598392, 0.9608624, 0.9618684,
+      0.9628224, 0.9637952, 0.9647364, 0.9656688, 0.9665728, 0.96745, 0.9683132,
+      0.9691372, 0.9699656, 0.9707372, 0.9714788, 0.9722212, 0.972922,
+      0.9735856, 0.974262, 0.9749132, 0.975544, 0.97615, 0.9767284, 0.9773188,
+      0.977866, 0.9784148, 0.9789656, 0.9794692, 0.9799836, 0.9804664,
+      0.9809448, 0.9813852, 0.9818328, 0.982264, 0.9827156, 0.983116, 0.9835376,
+      0.9839524, 0.9843456, 0.9847468, 0.9851308, 0.9854928, 0.9858536,
+      0.986194, 0.9865272, 0.9868368, 0.9871488, 0.987456, 0.98777, 0.9880824,
+      0.9883656, 0.9886456, 0.9889204, 0.989174, 0.9894292, 0.989688, 0.9899292,
+      0.9901544, 0.9903708, 0.9906148, 0.9908276, 0.9910604, 0.9912496,
+      0.9914716, 0.9916704, 0.9918712, 0.9920708, 0.9922584, 0.9924316,
+      0.9926092, 0.9927884, 0.9929584, 0.9931204, 0.993274, 0.993434, 0.9935768,
+      0.993728, 0.9938676, 0.9940204, 0.9941616, 0.994302, 0.9944332, 0.9945568,
+      0.9946728, 0.9948012, 0.9949228, 0.9950248, 0.9951336, 0.99525, 0.995352,
+      0.995452, 0.9955652, 0.9956668, 0.9957628, 0.9958584, 0.9959536, 0.996044,
+      0.9961272, 0.996228, 0.9963012, 0.9963868, 0.9964616, 0.9965392, 0.996616,
+      0.9966928, 0.9967612, 0.9968336, 0.996902, 0.9969664, 0.9970316,
+      0.9971016, 0.9971668, 0.9972304, 0.9972832, 0.9973364, 0.9974008,
+      0.9974652, 0.9975204, 0.9975728, 0.997632, 0.997674, 0.997726, 0.9977728,
+      0.9978256, 0.9978724, 0.9979276, 0.9979732, 0.998026, 0.998058, 0.9981016,
+      0.9981464, 0.998182, 0.9982208, 0.9982636, 0.9983028, 0.9983352,
+      0.9983684, 0.9983976, 0.9984304, 0.9984656, 0.9984964, 0.9985288,
+      0.9985576, 0.9985972, 0.9986236, 0.99865, 0.9986776, 0.9987068, 0.9987348,
+      0.998764, 0.9987836, 0.998806, 0.9988356, 0.9988588, 0.998884, 0.9989092,
+      0.9989308, 0.9989508, 0.998976, 0.9989984, 0.9990208, 0.999044, 0.9990588,
+      0.999074, 0.99966, 0.9998536, 1
+   },
+   { // n=24
+      0, 0.0013976, 0.0965608, 0.3112788, 0.5127952, 0.662488, 0.7663996,
+      0.7732408, 0.7797876, 0.7860612, 0.7921836, 0.7981556, 0.804016,
+      0.8096284, 0.8151168, 0.8203696, 0.8254424, 0.830482, 0.8353324, 0.84006,
+      0.8445068, 0.8489724, 0.8532312, 0.8573712, 0.861392, 0.8652508,
+      0.8690296, 0.8727, 0.8762692, 0.879754, 0.8830852, 0.8863504, 0.8894844,
+      0.8925368, 0.8954732, 0.8983064, 0.9011096, 0.9038056, 0.9064148,
+      0.9089928, 0.9115212, 0.913898, 0.916246, 0.918546, 0.9207704, 0.9228896,
+      0.924978, 0.927018, 0.9289536, 0.9309128, 0.9327912, 0.9346236, 0.9363816,
+      0.938128, 0.939772, 0.9413736, 0.9429924, 0.9445096, 0.9459364, 0.947384,
+      0.9487492, 0.9500956, 0.9514136, 0.9526912, 0.953912, 0.9551008,
+      0.9562824, 0.95744, 0.95852, 0.9596168, 0.9606684, 0.9616672, 0.9626804,
+      0.9636452, 0.964594, 0.9655276, 0.9664156, 0.9672744, 0.9681204,
+      0.9689352, 0.969728, 0.9705068, 0.9712432, 0.9720156, 0.9727144,
+      0.9733944, 0.9740592, 0.974724, 0.9753768, 0.975992, 0.9766232, 0.9772288,
+      0.9778112, 0.978386, 0.9789168, 0.9794428, 0.9799456, 0.98045, 0.980924,
+      0.981412, 0.9818584, 0.98232, 0.982742, 0.9831544, 0.9835848, 0.983992,
+      0.9843828, 0.98476, 0.9851264, 0.9855092, 0.9858496, 0.9861944, 0.986524,
+      0.98688, 0.9871824, 0.9874912, 0.9878056, 0.9881032, 0.9883888, 0.98867,
+      0.9889372, 0.9891884, 0.9894452, 0.989686, 0.9899204, 0.9901628,
+      0.9904088, 0.990658, 0.990886, 0.9910984, 0.9913052, 0.9915024, 0.9916956,
+      0.9918812, 0.9920804, 0.9922548, 0.992434, 0.992596, 0.9927812, 0.9929392,
+      0.9930984, 0.993254, 0.9934068, 0.9935588, 0.9936932, 0.9938524, 0.993984,
+      0.9941164, 0.9942488, 0.9943828, 0.9945156, 0.9946488, 0.9947628,
+      0.9948788, 0.9949916, 0.9951004, 0.9952088, 0.9953232, 0.995428,
+      0.9955288, 0.9956248, 0.9957268, 0.9958236, 0.9959156, 0.9960084,
+      0.9960944, 0.9961888, 0.9962664, 0.9963488, 0.9964356, 0.9965152,
+      0.9965824, 0.9966608, 0.9967392, 0.9968052, 0.9968732, 0.996942,
+      0.9970056, 0.9970744, 0.9971376, 0.9971996, 0.997266, 0.9973172,
+      0.9973736, 0.9974316, 0.9974832, 0.9975404, 0.9975972, 0.9976544,
+      0.997706, 0.9977556, 0.9978056, 0.9978596, 0.99791, 0.9979508, 0.9979984,
+      0.9980448, 0.9980808, 0.9981172, 0.9981604, 0.9982028, 0.998234,
+      0.9982756, 0.9983056, 0.9983488, 0.9983844, 0.9984216, 0.9984624,
+      0.9984912, 0.9985184, 0.9985516, 0.998582, 0.9986088, 0.9986408, 0.998666,
+      0.9986916, 0.9987188, 0.9987388, 0.9987676, 0.9987888, 0.9988144,
+      0.9988376, 0.998862, 0.9988872, 0.99891, 0.9989344, 0.9989576, 0.9989796,
+      0.999002, 0.9990216, 0.9990412, 0.9990632, 0.9996404, 0.9998532, 1
+   },
+   { // n=25
+      0, 0.0014464, 0.0965456, 0.3115612, 0.5131488, 0.6629812, 0.7665168,
+      0.7732548, 0.7797908, 0.7861828, 0.7921964, 0.7981312, 0.8039128,
+      0.8094904, 0.8149244, 0.8201668, 0.8253652, 0.8303292, 0.83511, 0.839734,
+      0.8442252, 0.8487188, 0.8530156, 0.857218, 0.8612224, 0.8651176,
+      0.8689272, 0.8725472, 0.876154, 0.8796744, 0.8829896, 0.8862164,
+      0.8893904, 0.8924328, 0.8955204, 0.8984416, 0.90126, 0.9039276, 0.9065512,
+      0.9091324, 0.9115524, 0.9139628, 0.9163344, 0.9185832, 0.9207388,
+      0.9228636, 0.9249424, 0.9269868, 0.9289956, 0.9308876, 0.9327292,
+      0.9345716, 0.9363104, 0.9380088, 0.939684, 0.9412752, 0.942778, 0.9443388,
+      0.9458548, 0.9472948, 0.9486752, 0.9500264, 0.9513236, 0.9525864,
+      0.9538236, 0.9550256, 0.9561904, 0.9573512, 0.9584892, 0.9595564,
+      0.9606104, 0.9616376, 0.9626436, 0.9636076, 0.9645772, 0.9655112,
+      0.9664008, 0.9672652, 0.9681328, 0.9689424, 0.9697396, 0.970538,
+      0.9712812, 0.9720324, 0.9727268, 0.9734084, 0.9740744, 0.9747252,
+      0.9753388, 0.975942, 0.9765456, 0.97713, 0.9777048, 0.9782544, 0.9788,
+      0.9793236, 0.9798276, 0.9803508, 0.98082, 0.9813, 0.981768, 0.982244,
+      0.9826928, 0.98311, 0.9835228, 0.98392, 0.9843232, 0.984704, 0.9850848,
+      0.9854532, 0.985822, 0.9861616, 0.98648, 0.9867992, 0.9871396, 0.9874608,
+      0.987764, 0.9880632, 0.98836, 0.9886304, 0.9888988, 0.9891676, 0.9894176,
+      0.989666, 0.9899112, 0.9901464, 0.9903952, 0.99063, 0.9908648, 0.9910748,
+      0.9912888, 0.991504, 0.9917104, 0.9919112, 0.9921092, 0.9923036,
+      0.9924848, 0.9926536, 0.992826, 0.993006, 0.9931664, 0.9933144, 0.9934832,
+      0.9936404, 0.9937812, 0.9939192, 0.994076, 0.9942032, 0.9943344,
+      0.9944784, 0.9945952, 0.9947232, 0.9948444, 0.9949664, 0.9950828,
+      0.9951812, 0.9952844, 0.995392, 0.9954968, 0.9956028, 0.9957004, 0.995802,
+      0.9958872, 0.9959788, 0.996084, 0.9961748, 0.9962604, 0.9963384,
+      0.9964352, 0.9965128, 0.9965916, 0.9966724, 0.9967468, 0.996822,
+      0.9968912, 0.996962, 0.9970304, 0.9970916, 0.9971568, 0.9972196,
+      0.9972772, 0.9973308, 0.997396, 0.9974472, 0.9974996, 0.9975644, 0.997614,
+      0.997662, 0.997712, 0.9977684, 0.9978088, 0.997862, 0.9979024, 0.9979448,
+      0.9979884, 0.9980284, 0.9980764, 0.9981228, 0.9981568, 0.998196,
+      0.9982384, 0.9982724, 0.9983084, 0.9983444, 0.9983812, 0.9984216,
+      0.9984528, 0.9984836, 0.998508, 0.9985396, 0.9985704, 0.998604, 0.9986312,
+      0.9986572, 0.998684, 0.9987052, 0.9987364, 0.9987584, 0.9987856, 0.998808,
+      0.9988316, 0.9988516, 0.9988788, 0.998902, 0.9989248, 0.9989432,
+      0.9989668, 0.998992, 0.999012, 0.999034, 0.9990552, 0.999074, 0.9996576,
+      0.999864, 1
+   },
+   { // n=26
+      0, 0.001424, 0.0964328, 0.3110308, 0.512324, 0.6620136, 0.7656248,
+      0.7723112, 0.7788232, 0.785262, 0.7913968, 0.7973872, 0.8032024, 0.808826,
+      0.8142748, 0.8195492, 0.8246672, 0.8296836, 0.834606, 0.8393256,
+      0.8438316, 0.8482892, 0.852562, 0.8566816, 0.8606988, 0.86454, 0.86827,
+      0.8719428, 0.875548, 0.87904, 0.8824052, 0.8856868, 0.8888744, 0.8919392,
+      0.89498, 0.8978652, 0.9006656, 0.903354, 0.9059704, 0.9085028, 0.9110076,
+      0.9134356, 0.91576, 0.9180512, 0.9203228, 0.9224948, 0.92459, 0.9266532,
+      0.9286528, 0.9305224, 0.9323928, 0.9341808, 0.9359248, 0.9375968,
+      0.939258, 0.940876, 0.9424912, 0.9440036, 0.9454688, 0.9469028, 0.94829,
+      0.949668, 0.950998, 0.9522968, 0.9535332, 0.9547616, 0.9558964, 0.9570244,
+      0.9581692, 0.9592604, 0.9603468, 0.9613764, 0.9623832, 0.9633664,
+      0.9643116, 0.9652408, 0.9661184, 0.9669884, 0.96786, 0.9686732, 0.9694996,
+      0.9702868, 0.9710572, 0.9717924, 0.9725272, 0.973248, 0.9739432, 0.97459,
+      0.9752516, 0.9758472, 0.9764456, 0.9770364, 0.9776196, 0.97819, 0.9787364,
+      0.9792876, 0.979784, 0.9802932, 0.9807904, 0.9812664, 0.9817352,
+      0.9821844, 0.9826184, 0.9830456, 0.9834612, 0.9838728, 0.9842608,
+      0.9846516, 0.9850476, 0.9854, 0.9857632, 0.9861028, 0.9864336, 0.9867744,
+      0.9870988, 0.9874348, 0.987748, 0.9880576, 0.9883528, 0.9886332,
+      0.9888972, 0.9891696, 0.9894328, 0.9896768, 0.9899332, 0.9901712,
+      0.990404, 0.9906344, 0.9908516, 0.9910732, 0.9912728, 0.9914832,
+      0.9916852, 0.991882, 0.9920652, 0.9922464, 0.9924388, 0.9926152,
+      0.9927948, 0.9929644, 0.9931324, 0.9932836, 0.9934252, 0.9935728,
+      0.9937356, 0.9938784, 0.9940208, 0.9941612, 0.9943028, 0.994438,
+      0.9945772, 0.9947028, 0.9948308, 0.9949492, 0.9950708, 0.9951704,
+      0.9952872, 0.9953964, 0.9954916, 0.9956032, 0.9957108, 0.9958, 0.9958896,
+      0.9959776, 0.9960656, 0.9961572, 0.99624, 0.9963344, 0.9964168, 0.9965056,
+      0.9965824, 0.9966592, 0.9967272, 0.9967936, 0.9968624, 0.9969248,
+      0.996992, 0.9970528, 0.9971136, 0.9971792, 0.9972308, 0.9972928,
+      0.9973468, 0.9974096, 0.9974624, 0.9975224, 0.9975824, 0.9976296,
+      0.997684, 0.997734, 0.9977796, 0.9978296, 0.997868, 0.997914, 0.9979464,
+      0.9979924, 0.9980276, 0.9980648, 0.9981056, 0.9981424, 0.998184,
+      0.9982224, 0.9982596, 0.9982928, 0.9983312, 0.9983668, 0.9983956,
+      0.9984296, 0.9984616, 0.9984964, 0.998528, 0.9985568, 0.99859, 0.9986188,
+      0.9986508, 0.9986808, 0.9987136, 0.9987356, 0.99877, 0.9988012, 0.9988244,
+      0.99885, 0.9988744, 0.9988976, 0.99892, 0.9989496, 0.9989736, 0.9989964,
+      0.999018, 0.9990384, 0.999062, 0.9990812, 0.9996616, 0.9998728, 1
+   },
+   { // n=27
+      0, 0.001432, 0.096488, 0.3108688, 0.5124368, 0.6620412, 0.7658852,
+      0.77261, 0.7791284, 0.785478, 0.7916692, 0.7976612, 0.8034444, 0.8090756,
+      0.8145044, 0.8197912, 0.824918, 0.8298916, 0.8346268, 0.8392872,
+      0.8438532, 0.8481836, 0.8524628, 0.8566276, 0.8606816, 0.864546,
+      0.8683256, 0.871974, 0.8755748, 0.8791232, 0.8824488, 0.8857268, 0.8889,
+      0.891956, 0.8949292, 0.8977816, 0.9005992, 0.9033832, 0.9059692,
+      0.9085272, 0.9109964, 0.913402, 0.91573, 0.9180336, 0.9202876, 0.9224396,
+      0.924554, 0.9265788, 0.9285444, 0.930474, 0.9323304, 0.9341752, 0.9359648,
+      0.93769, 0.9394056, 0.9410324, 0.9425852, 0.9441428, 0.945594, 0.947018,
+      0.9484188, 0.94975, 0.9510476, 0.9523376, 0.9535632, 0.9548072, 0.9559692,
+      0.9570936, 0.9582064, 0.9592832, 0.9603116, 0.9613336, 0.9623716,
+      0.9633704, 0.9643464, 0.9652552, 0.9661464, 0.9670464, 0.967894, 0.968722,
+      0.9695268, 0.97031, 0.9710636, 0.9717976, 0.9725268, 0.9732048, 0.9739,
+      0.9745648, 0.975218, 0.9758208, 0.9764352, 0.9770288, 0.977612, 0.97815,
+      0.9787016, 0.9792356, 0.9797732, 0.9802848, 0.9807736, 0.9812368,
+      0.9816936, 0.9821492, 0.9826192, 0.9830416, 0.9834868, 0.9838764, 0.98427,
+      0.9846852, 0.9850672, 0.9854344, 0.9858068, 0.9861328, 0.9864604,
+      0.986792, 0.9871292, 0.9874292, 0.9877292, 0.9880092, 0.988288, 0.9885472,
+      0.9888152, 0.9890804, 0.989336, 0.9895744, 0.98982, 0.9900652, 0.9903084,
+      0.990552, 0.9907792, 0.9909964, 0.991212, 0.9914252, 0.99163, 0.9918244,
+      0.9920316, 0.9922164, 0.9923968, 0.9925828, 0.9927576, 0.9929276,
+      0.9931016, 0.9932688, 0.9934184, 0.9935784, 0.9937328, 0.993882,
+      0.9940284, 0.994162, 0.9943012, 0.9944264, 0.9945528, 0.9946856,
+      0.9948076, 0.994924, 0.9950352, 0.9951384, 0.9952588, 0.995366, 0.99547,
+      0.995576, 0.9956804, 0.9957792, 0.9958692, 0.995958, 0.9960476, 0.9961396,
+      0.9962296, 0.9963128, 0.9963904, 0.996462, 0.9965432, 0.9966188,
+      0.9967016, 0.9967812, 0.9968508, 0.99691, 0.9969736, 0.9970396, 0.99711,
+      0.9971752, 0.9972432, 0.9972956, 0.9973588, 0.997416, 0.9974752,
+      0.9975276, 0.9975764, 0.9976328, 0.9976812, 0.9977292, 0.9977788,
+      0.9978304, 0.9978744, 0.997916, 0.99796, 0.9980056, 0.9980448, 0.998086,
+      0.9981208, 0.9981612, 0.9982012, 0.9982436, 0.9982832, 0.9983272,
+      0.9983608, 0.9983952, 0.9984316, 0.9984632, 0.9984968, 0.99853, 0.9985568,
+      0.99859, 0.9986136, 0.9986452, 0.9986724, 0.9986972, 0.9987312, 0.9987568,
+      0.998782, 0.99881, 0.998834, 0.998856, 0.9988836, 0.9989068, 0.9989284,
+      0.9989496, 0.998974, 0.9989964, 0.9990188, 0.9990384, 0.99906, 0.9990748,
+      0.9996648, 0.9998688, 1
+   },
+   { // n=28
+      0, 0.0013892, 0.0964496, 0.3106692, 0.5120812, 0.6616112, 0.7656704,
+      0.7723484, 0.7788584, 0.7851968, 0.7913684, 0.7974156, 0.8032172, 0.80885,
+      0.8143156, 0.8196164, 0.8246652, 0.8296408, 0.8344688, 0.8391272,
+      0.8437172, 0.8481416, 0.8523736, 0.856532, 0.8605216, 0.8643848,
+      0.8681588, 0.8717872, 0.8753752, 0.8788428, 0.8821776, 0.8854832,
+      0.8886568, 0.8917352, 0.8947416, 0.8976036, 0.9004368, 0.9031844,
+      0.9058212, 0.9084396, 0.910946, 0.9133532, 0.9157172, 0.9180252,
+      0.9202568, 0.922408, 0.9245124, 0.926544, 0.9285164, 0.930442, 0.9323204,
+      0.9341088, 0.9358736, 0.9375968, 0.9392416, 0.9408684, 0.9424516,
+      0.9440344, 0.9455012, 0.9469848, 0.9483852, 0.9497524, 0.9510956,
+      0.9523908, 0.9536108, 0.9548196, 0.9560168, 0.9571472, 0.9582192,
+      0.9592888, 0.9603468, 0.9613684, 0.9623884, 0.9633376, 0.9642852,
+      0.9651968, 0.9661116, 0.9669552, 0.9678248, 0.9686712, 0.9694412,
+      0.9702096, 0.9709324, 0.9716844, 0.9724188, 0.9731144, 0.9737848, 0.97444,
+      0.9751072, 0.9757552, 0.9763712, 0.9769648, 0.9775756, 0.9781248,
+      0.9786932, 0.9792376, 0.9797544, 0.9802476, 0.9807408, 0.9812104,
+      0.9816676, 0.9821176, 0.9825404, 0.9829444, 0.9833632, 0.9837812,
+      0.9841728, 0.9845748, 0.9849432, 0.9853232, 0.9856824, 0.9860484,
+      0.986384, 0.9867124, 0.9870448, 0.9873464, 0.9876452, 0.9879324,
+      0.9882352, 0.9885172, 0.9887832, 0.9890416, 0.989304, 0.9895852,
+      0.9898308, 0.9900704, 0.9902956, 0.9905492, 0.990774, 0.9909932,
+      0.9912192, 0.9914412, 0.9916492, 0.9918296, 0.992018, 0.992214, 0.9924,
+      0.9925884, 0.9927592, 0.9929248, 0.9931, 0.9932656, 0.9934264, 0.9935752,
+      0.993726, 0.9938592, 0.9940052, 0.9941588, 0.9942984, 0.9944388, 0.994562,
+      0.9946896, 0.9948124, 0.994922, 0.9950324, 0.9951444, 0.99525, 0.9953524,
+      0.9954664, 0.995572, 0.9956784, 0.9957936, 0.9958912, 0.995976, 0.9960716,
+      0.9961612, 0.9962432, 0.9963256, 0.9964072, 0.9964888, 0.9965596,
+      0.9966424, 0.9967092, 0.996792, 0.9968616, 0.996934, 0.9970088, 0.9970724,
+      0.99713, 0.9971944, 0.9972664, 0.9973232, 0.9973792, 0.9974376, 0.9974952,
+      0.9975528, 0.9976088, 0.9976588, 0.9977124, 0.9977588, 0.9977956,
+      0.9978452, 0.9978916, 0.9979368, 0.997984, 0.9980356, 0.9980824,
+      0.9981292, 0.9981688, 0.9982048, 0.9982436, 0.9982804, 0.9983212,
+      0.9983488, 0.9983808, 0.9984184, 0.998448, 0.9984756, 0.9985056,
+      0.9985348, 0.9985728, 0.9986004, 0.998628, 0.998662, 0.9986864, 0.9987168,
+      0.99875, 0.9987744, 0.9988004, 0.9988268, 0.998846, 0.99887, 0.9988928,
+      0.998914, 0.9989352, 0.9989596, 0.998978, 0.9989952, 0.9990132, 0.9990356,
+      0.999054, 0.9990764, 0.9996552, 0.9998736, 1
+   },
+   { // n=29
+      0, 0.001434, 0.0965548, 0.3107372, 0.5121068, 0.6616592, 0.7652836,
+      0.7720388, 0.778554, 0.7849104, 0.7910716, 0.7970376, 0.8028584,
+      0.8085404, 0.813922, 0.8192056, 0.8243476, 0.8292768, 0.834076, 0.8387472,
+      0.8432844, 0.8476888, 0.8519596, 0.8561112, 0.8601196, 0.8640552,
+      0.8678892, 0.8715988, 0.8751728, 0.8786624, 0.8820936, 0.8854028,
+      0.8885928, 0.8916136, 0.89461, 0.8975132, 0.9003852, 0.9031136, 0.9057924,
+      0.9084064, 0.9108668, 0.9133268, 0.91568, 0.9179528, 0.9201532, 0.9223292,
+      0.9244528, 0.9265148, 0.9284848, 0.9304716, 0.9323452, 0.9341448,
+      0.9359168, 0.9376192, 0.9392584, 0.9409292, 0.9424904, 0.9440288,
+      0.9455196, 0.9469828, 0.9483756, 0.949764, 0.9510636, 0.9523488,
+      0.9535708, 0.95479, 0.9559724, 0.957138, 0.9582912, 0.9593532, 0.9604192,
+      0.961426, 0.9624244, 0.96339, 0.9643264, 0.965258, 0.966128, 0.9670272,
+      0.967878, 0.9686756, 0.969478, 0.970276, 0.9710316, 0.9717768, 0.9725128,
+      0.9732268, 0.9739136, 0.9745708, 0.9752128, 0.9758636, 0.9764808,
+      0.9770876, 0.9776736, 0.9782408, 0.9787644, 0.9793152, 0.9798336,
+      0.9803248, 0.9808236, 0.981298, 0.9817568, 0.9822064, 0.982634, 0.983058,
+      0.9834712, 0.9838848, 0.9842804, 0.9846568, 0.9850196, 0.9853924,
+      0.9857576, 0.986118, 0.9864768, 0.9868112, 0.9871488, 0.987476, 0.9877876,
+      0.9880856, 0.988382, 0.9886696, 0.9889456, 0.9892064, 0.989462, 0.9897116,
+      0.989948, 0.9901852, 0.9904128, 0.990634, 0.990858, 0.99107, 0.991262,
+      0.9914712, 0.9916668, 0.9918456, 0.9920412, 0.9922252, 0.9924268,
+      0.9926176, 0.9927984, 0.9929728, 0.9931436, 0.993308, 0.993468, 0.993608,
+      0.9937576, 0.99389, 0.9940268, 0.994162, 0.9943072, 0.9944444, 0.9945672,
+      0.9946892, 0.9948156, 0.9949312, 0.9950484, 0.995166, 0.9952716,
+      0.9953756, 0.9954924, 0.9956092, 0.995708, 0.9958008, 0.9958976,
+      0.9959868, 0.9960752, 0.996168, 0.9962552, 0.9963392, 0.9964252,
+      0.9965076, 0.9965908, 0.9966576, 0.9967356, 0.996816, 0.9968792,
+      0.9969476, 0.9970136, 0.9970828, 0.997144, 0.9972, 0.9972668, 0.9973164,
+      0.997384, 0.9974376, 0.9974896, 0.9975472, 0.9976092, 0.99767, 0.9977216,
+      0.9977752, 0.9978164, 0.9978632, 0.9979104, 0.997958, 0.998004, 0.9980492,
+      0.9980948, 0.9981348, 0.9981724, 0.998216, 0.9982576, 0.9982912,
+      0.9983248, 0.998356, 0.9983872, 0.9984224, 0.998454, 0.9984872, 0.9985172,
+      0.9985484, 0.99858, 0.998612, 0.998648, 0.9986852, 0.99871, 0.9987376,
+      0.9987644, 0.998794, 0.9988228, 0.998854, 0.9988756, 0.9988968, 0.9989152,
+      0.9989384, 0.9989572, 0.9989816, 0.9990044, 0.999024, 0.999044, 0.9990588,
+      0.9990756, 0.9990956, 0.9996656, 0.999876, 1
+   },
+   { // n=30
+      0, 0.0014556, 0.0964636, 0.3107264, 0.5116528, 0.6614592, 0.7655712,
+      0.7722664, 0.7788384, 0.785224, 0.7914172, 0.7974592, 0.8032068,
+      0.8087348, 0.8142032, 0.8195992, 0.8247096, 0.8296688, 0.8344988,
+      0.8391124, 0.8435816, 0.8480592, 0.8523452, 0.8564948, 0.860466,
+      0.8644492, 0.8682048, 0.8718932, 0.8754724, 0.8789532, 0.8823408,
+      0.8855632, 0.8887204, 0.891766, 0.8946936, 0.8975124, 0.9003064,
+      0.9029924, 0.9056216, 0.908194, 0.9106956, 0.9131264, 0.915508, 0.9178096,
+      0.9200284, 0.922204, 0.924328, 0.9264268, 0.9283536, 0.930264, 0.9321768,
+      0.9340192, 0.935782, 0.937532, 0.9391724, 0.9407604, 0.9423336, 0.9439088,
+      0.9453812, 0.9467776, 0.9481784, 0.9495496, 0.9508992, 0.9521896,
+      0.9533656, 0.9545928, 0.9557868, 0.9569404, 0.958078, 0.9591656, 0.960252,
+      0.9612808, 0.9622776, 0.9632448, 0.964184, 0.96509, 0.9660056, 0.9668788,
+      0.9676892, 0.968502, 0.9693144, 0.9700972, 0.9708596, 0.9716144,
+      0.9723252, 0.9730068, 0.9737096, 0.9743756, 0.975018, 0.9756344,
+      0.9762492, 0.9768428, 0.9774348, 0.978, 0.97853, 0.9790424, 0.9795584,
+      0.9800652, 0.9805612, 0.9810368, 0.9815172, 0.9819776, 0.9824288,
+      0.9828672, 0.9832696, 0.9836724, 0.9840664, 0.9844528, 0.9848196,
+      0.9851944, 0.9855504, 0.9858916, 0.986224, 0.986554, 0.986856, 0.9871948,
+      0.98749, 0.9877828, 0.9880844, 0.9883708, 0.9886476, 0.9889144, 0.9891824,
+      0.9894396, 0.9896916, 0.9899456, 0.9901864, 0.990416, 0.9906376,
+      0.9908588, 0.991064, 0.9912712, 0.991478, 0.9916752, 0.9918676, 0.992054,
+      0.992238, 0.9924144, 0.9925932, 0.992764, 0.992932, 0.993082, 0.9932424,
+      0.993388, 0.993542, 0.9936912, 0.993836, 0.9939816, 0.9941188, 0.994256,
+      0.9943956, 0.9945168, 0.9946396, 0.9947572, 0.9948784, 0.9949912,
+      0.9951064, 0.9952236, 0.9953284, 0.9954336, 0.9955472, 0.9956528,
+      0.9957452, 0.9958504, 0.9959484, 0.9960528, 0.9961404, 0.996226,
+      0.9963132, 0.9963932, 0.9964768, 0.9965572, 0.9966308, 0.9967132,
+      0.9967768, 0.9968492, 0.9969204, 0.9969956, 0.997062, 0.9971248, 0.997188,
+      0.9972532, 0.997314, 0.9973784, 0.9974356, 0.9974948, 0.9975476,
+      0.9975992, 0.9976444, 0.9976952, 0.9977444, 0.997798, 0.9978484,
+      0.9978952, 0.9979376, 0.9979876, 0.9980328, 0.9980776, 0.9981216,
+      0.9981636, 0.998192, 0.9982296, 0.9982752, 0.9983104, 0.9983496,
+      0.9983872, 0.9984204, 0.9984496, 0.9984788, 0.9985116, 0.998542,
+      0.9985796, 0.99861, 0.9986376, 0.9986608, 0.9986888, 0.998714, 0.998742,
+      0.9987676, 0.9987896, 0.9988196, 0.9988476, 0.9988748, 0.9988996,
+      0.9989192, 0.9989452, 0.9989608, 0.998984, 0.9990124, 0.9990308,
+      0.9990576, 0.9990824, 0.9996704, 0.999868, 1
+   },
+   { // n=31
+      0, 0.0015032, 0.0966336, 0.3104828, 0.5117204, 0.6614604, 0.7656164,
+      0.7723484, 0.7788876, 0.7851704, 0.7912272, 0.797228, 0.8031472,
+      0.8088284, 0.814236, 0.8195156, 0.8246792, 0.8295824, 0.834378, 0.8390312,
+      0.8436284, 0.848064, 0.8523468, 0.8565092, 0.8604772, 0.8644112,
+      0.8681532, 0.8718472, 0.8753816, 0.8788476, 0.8822764, 0.8855584,
+      0.8887496, 0.891824, 0.8947988, 0.8976704, 0.9004572, 0.903138, 0.9058004,
+      0.9083692, 0.9108688, 0.9132784, 0.9156384, 0.9179096, 0.9201896,
+      0.9223084, 0.924382, 0.9264212, 0.9283532, 0.9302888, 0.932192, 0.934012,
+      0.9358024, 0.937498, 0.9391176, 0.9407556, 0.9423348, 0.9438684,
+      0.9453264, 0.9467508, 0.948166, 0.9495092, 0.9508108, 0.9520888,
+      0.9533276, 0.9545456, 0.95572, 0.95687, 0.9579888, 0.9590768, 0.9601176,
+      0.9611404, 0.9621648, 0.9631132, 0.9640484, 0.9649464, 0.9658556,
+      0.9667216, 0.9675988, 0.9684328, 0.9692284, 0.9700288, 0.9708072,
+      0.9715748, 0.9722772, 0.9729804, 0.9736488, 0.9743136, 0.9749392,
+      0.9755576, 0.9761772, 0.97677, 0.977354, 0.9779236, 0.9784436, 0.9789796,
+      0.9795168, 0.98003, 0.9805168, 0.9810064, 0.9814832, 0.9819496, 0.9824056,
+      0.9828328, 0.9832556, 0.9836668, 0.9840664, 0.9844736, 0.9848388,
+      0.9852384, 0.9855848, 0.985958, 0.9862908, 0.9866324, 0.9869628,
+      0.9872672, 0.9875688, 0.9878652, 0.9881628, 0.9884432, 0.988718,
+      0.9889908, 0.9892484, 0.9894988, 0.9897672, 0.9900132, 0.9902432,
+      0.9904628, 0.990678, 0.9909064, 0.991128, 0.9913284, 0.9915392, 0.991724,
+      0.9919212, 0.9921216, 0.9922924, 0.992488, 0.9926716, 0.992832, 0.9930004,
+      0.9931632, 0.993332, 0.9934924, 0.9936348, 0.993792, 0.9939348, 0.994072,
+      0.9942024, 0.9943368, 0.9944764, 0.9945936, 0.9947164, 0.994832,
+      0.9949444, 0.9950688, 0.9951904, 0.9953044, 0.9954016, 0.9954996,
+      0.9955988, 0.9957052, 0.9958008, 0.9958936, 0.9959796, 0.9960772,
+      0.9961632, 0.9962468, 0.9963412, 0.996428, 0.9965108, 0.9965872, 0.996656,
+      0.9967296, 0.9968068, 0.9968724, 0.99694, 0.9970084, 0.9970768, 0.9971468,
+      0.997208, 0.9972672, 0.99733, 0.9973928, 0.9974608, 0.9975228, 0.9975704,
+      0.9976272, 0.9976868, 0.9977408, 0.9977944, 0.9978412, 0.9978896,
+      0.997934, 0.9979796, 0.9980204, 0.998068, 0.9981184, 0.9981588, 0.9981972,
+      0.998238, 0.9982796, 0.9983176, 0.9983696, 0.998398, 0.998428, 0.9984588,
+      0.9984928, 0.9985204, 0.9985532, 0.9985812, 0.9986152, 0.9986464,
+      0.9986736, 0.9987048, 0.9987284, 0.9987552, 0.9987856, 0.9988132,
+      0.9988396, 0.9988668, 0.9988928, 0.998914, 0.9989464, 0.9989688,
+      0.9989924, 0.9990108, 0.9990288, 0.9990488, 0.9990684, 0.9990924,
+      0.9991104, 0.9996796, 0.9998776, 1
+   },
+   { // n=32
+      0, 0.0014448, 0.0965292, 0.3099256, 0.5105796, 0.6602988, 0.7648784,
+      0.7716452, 0.7781924, 0.78458, 0.7907684, 0.7967704, 0.8025868, 0.8082372,
+      0.8136748, 0.8189008, 0.8240756, 0.8290376, 0.8339684, 0.8386636,
+      0.843242, 0.8476812, 0.8520012, 0.8562016, 0.8601932, 0.8640632,
+      0.8678384, 0.8715052, 0.87511, 0.8785648, 0.8818936, 0.8851768, 0.8883956,
+      0.891482, 0.8944544, 0.8973444, 0.9002028, 0.9029424, 0.905562, 0.908098,
+      0.9105248, 0.91295, 0.9153344, 0.9176492, 0.9198424, 0.9220136, 0.9241056,
+      0.92616, 0.928146, 0.9300208, 0.9319128, 0.9337504, 0.9355036, 0.937236,
+      0.93895, 0.9405588, 0.942132, 0.9437024, 0.9451684, 0.9465968, 0.9480268,
+      0.949384, 0.9507636, 0.9520444, 0.9532884, 0.9544984, 0.9557036, 0.956888,
+      0.9580172, 0.9591204, 0.9601768, 0.961206, 0.9622376, 0.9632664,
+      0.9642044, 0.9651596, 0.96602, 0.9668912, 0.9677732, 0.9686424, 0.9694384,
+      0.970228, 0.9709652, 0.9716776, 0.9723948, 0.9730928, 0.9737888, 0.974432,
+      0.9751088, 0.9757384, 0.9763708, 0.976972, 0.9775612, 0.9781236,
+      0.9787172, 0.9792584, 0.9797648, 0.980262, 0.9807464, 0.9812188,
+      0.9816992, 0.9821508, 0.9825816, 0.9830108, 0.9834396, 0.9838684,
+      0.9842612, 0.9846404, 0.9850232, 0.9853768, 0.985744, 0.986088, 0.9864356,
+      0.986774, 0.9871132, 0.9874252, 0.9877172, 0.9880244, 0.9883116,
+      0.9886068, 0.988868, 0.989132, 0.9893968, 0.9896428, 0.9899136, 0.9901696,
+      0.990386, 0.9906092, 0.990826, 0.9910368, 0.9912536, 0.9914748, 0.9916964,
+      0.991884, 0.992076, 0.9922628, 0.9924356, 0.9926136, 0.9927964, 0.9929752,
+      0.9931516, 0.9933072, 0.9934632, 0.9936188, 0.9937704, 0.9939084,
+      0.9940528, 0.9941976, 0.9943292, 0.9944648, 0.994592, 0.9947064,
+      0.9948196, 0.9949392, 0.9950364, 0.99515, 0.9952536, 0.9953708, 0.9954852,
+      0.9956032, 0.9957052, 0.9958108, 0.9959032, 0.9959904, 0.996092, 0.996176,
+      0.9962612, 0.99634, 0.9964224, 0.9964976, 0.9965764, 0.9966576, 0.99673,
+      0.9967972, 0.9968788, 0.9969516, 0.9970164, 0.9970808, 0.9971572,
+      0.9972244, 0.9972884, 0.997352, 0.9974036, 0.9974552, 0.9975068,
+      0.9975584, 0.997618, 0.9976668, 0.99772, 0.9977612, 0.9978132, 0.9978664,
+      0.9979076, 0.9979628, 0.9980088, 0.9980568, 0.9981004, 0.9981432,
+      0.9981828, 0.9982208, 0.9982572, 0.9982904, 0.9983292, 0.9983712, 0.99841,
+      0.9984472, 0.9984784, 0.9985112, 0.9985416, 0.9985724, 0.998604,
+      0.9986404, 0.9986672, 0.9986916, 0.9987256, 0.9987536, 0.9987832,
+      0.998808, 0.9988276, 0.9988512, 0.9988772, 0.998902, 0.998926, 0.9989528,
+      0.9989748, 0.9989932, 0.9990164, 0.999036, 0.9990512, 0.9990688,
+      0.9990888, 0.9991116, 0.9996904, 0.999884, 1
+   },
+   { // n=33
+      0, 0.0014528, 0.0963084, 0.3099124, 0.5105752, 0.6604504, 0.7647864,
+      0.7714704, 0.7779564, 0.7843272, 0.7905828, 0.7965356, 0.8023244,
+      0.808004, 0.8133464, 0.8186852, 0.823804, 0.8287836, 0.8336624, 0.8383544,
+      0.8428796, 0.84734, 0.8516336, 0.8557428, 0.8597664, 0.8637328, 0.8674988,
+      0.8712272, 0.8747904, 0.8781836, 0.881618, 0.884882, 0.8881316, 0.891206,
+      0.8941884, 0.8971208, 0.899954, 0.9026728, 0.9052316, 0.9078496,
+      0.9103264, 0.91281, 0.9151788, 0.9175008, 0.9197728, 0.921962, 0.9240744,
+      0.9261588, 0.9281276, 0.93005, 0.9318976, 0.9337144, 0.9355028, 0.9371724,
+      0.938852, 0.940488, 0.9420888, 0.943608, 0.9450556, 0.946508, 0.9479272,
+      0.9493064, 0.9506728, 0.951958, 0.9532044, 0.9544264, 0.9556304,
+      0.9567792, 0.9578892, 0.9589876, 0.9600612, 0.9610792, 0.9620728,
+      0.9630552, 0.963972, 0.9649016, 0.96579, 0.966692, 0.967552, 0.968364,
+      0.9691616, 0.9699452, 0.9707036, 0.9714608, 0.9721696, 0.972898,
+      0.9736052, 0.974282, 0.9749288, 0.9755624, 0.9761556, 0.9767436,
+      0.9773272, 0.9778872, 0.9784176, 0.9789552, 0.9794624, 0.979954,
+      0.9804716, 0.9809276, 0.9813864, 0.9818584, 0.9823048, 0.9827264,
+      0.983174, 0.9835852, 0.9840108, 0.9843832, 0.9847676, 0.9851496,
+      0.9855324, 0.9858616, 0.9862048, 0.9865524, 0.9868796, 0.9872044,
+      0.9875232, 0.9878352, 0.9881372, 0.98844, 0.9887292, 0.9889832, 0.9892532,
+      0.9895092, 0.9897556, 0.9900064, 0.9902588, 0.990496, 0.9907272,
+      0.9909424, 0.991158, 0.9913548, 0.9915676, 0.9917824, 0.9919856,
+      0.9921748, 0.9923704, 0.9925532, 0.992742, 0.9929008, 0.9930676,
+      0.9932292, 0.9933784, 0.9935268, 0.9936904, 0.9938424, 0.99399, 0.9941312,
+      0.9942676, 0.9943976, 0.9945336, 0.9946528, 0.9947676, 0.994898,
+      0.9950156, 0.9951332, 0.9952424, 0.9953452, 0.995454, 0.995568, 0.9956696,
+      0.9957616, 0.9958524, 0.9959412, 0.9960372, 0.9961372, 0.9962272,
+      0.996318, 0.9964004, 0.9964844, 0.9965652, 0.99664, 0.9967188, 0.9967804,
+      0.9968544, 0.996922, 0.996996, 0.997056, 0.9971256, 0.9971888, 0.9972536,
+      0.9973132, 0.997374, 0.9974244, 0.9974796, 0.9975332, 0.9975872,
+      0.9976364, 0.9976856, 0.9977392, 0.997784, 0.9978248, 0.9978716,
+      0.9979256, 0.9979712, 0.9980152, 0.9980556, 0.9980984, 0.998138,
+      0.9981776, 0.9982148, 0.9982536, 0.9982868, 0.9983196, 0.9983532,
+      0.9983892, 0.9984188, 0.9984536, 0.998482, 0.9985124, 0.9985504,
+      0.9985772, 0.9986084, 0.9986404, 0.9986768, 0.9987024, 0.9987288,
+      0.9987564, 0.9987808, 0.9988068, 0.9988328, 0.9988576, 0.9988796,
+      0.9988992, 0.9989268, 0.9989512, 0.99897, 0.9989932, 0.9990152, 0.9990296,
+      0.999048, 0.9990668, 0.9996552, 0.999874, 1
+   },
+   { // n=34
+      0, 0.0014624, 0.0958332, 0.3098392, 0.5110396, 0.6606128, 0.7646516,
+      0.771472, 0.7780624, 0.784372, 0.79061, 0.7965692, 0.8023428, 0.8080372,
+      0.813556, 0.8189092, 0.8240804, 0.8291108, 0.8339508, 0.838718, 0.843266,
+      0.8476964, 0.8519732, 0.8560464, 0.8600488, 0.8639572, 0.8678252, 0.87152,
+      0.875076, 0.878498, 0.8819088, 0.8851652, 0.8883356, 0.8914236, 0.8943976,
+      0.8973016, 0.9001308, 0.9028712, 0.9055676, 0.9080932, 0.9105968,
+      0.912998, 0.9153552, 0.9176484, 0.9198624, 0.9220208, 0.9241216,
+      0.9261332, 0.9281464, 0.9299592, 0.931818, 0.9336348, 0.9353868,
+      0.9371664, 0.9387968, 0.9404352, 0.9419452, 0.9434172, 0.9449476,
+      0.946394, 0.9477784, 0.9491848, 0.9505312, 0.9518476, 0.9531008, 0.95435,
+      0.9555716, 0.9567376, 0.9578504, 0.958928, 0.9599944, 0.9610324,
+      0.9620496, 0.9630288, 0.9639564, 0.964882, 0.9658044, 0.96668, 0.9675068,
+      0.9683424, 0.9691552, 0.9699092, 0.9706828, 0.9714444, 0.9721876,
+      0.9728748, 0.9735648, 0.974234, 0.9748844, 0.9755152, 0.9761408, 0.976754,
+      0.977336, 0.9778908, 0.978428, 0.9789748, 0.9794864, 0.9800244, 0.9805212,
+      0.9809948, 0.9814712, 0.9819332, 0.9823684, 0.982808, 0.98324, 0.9836516,
+      0.9840628, 0.984456, 0.9848344, 0.9852, 0.985556, 0.9859204, 0.9862432,
+      0.9865872, 0.9869076, 0.9872432, 0.9875688, 0.9878636, 0.9881708,
+      0.9884476, 0.9887176, 0.9890004, 0.9892748, 0.98954, 0.9897864, 0.990018,
+      0.9902504, 0.9904784, 0.990696, 0.990924, 0.9911408, 0.9913584, 0.991566,
+      0.9917672, 0.9919576, 0.9921452, 0.9923292, 0.9925072, 0.9926836,
+      0.9928652, 0.9930304, 0.9931904, 0.9933452, 0.9935004, 0.9936584,
+      0.9938068, 0.9939492, 0.9940924, 0.9942228, 0.9943568, 0.9944804,
+      0.9946068, 0.9947312, 0.9948576, 0.9949708, 0.9950808, 0.9951864,
+      0.9953016, 0.9954032, 0.995518, 0.9956076, 0.9957084, 0.9957952, 0.995892,
+      0.995982, 0.9960728, 0.9961764, 0.9962572, 0.9963392, 0.9964148,
+      0.9964936, 0.9965672, 0.996638, 0.9967108, 0.9967912, 0.9968628, 0.99694,
+      0.9970216, 0.997084, 0.9971488, 0.9972132, 0.9972724, 0.9973308,
+      0.9973988, 0.997452, 0.9975068, 0.997554, 0.9976016, 0.9976628, 0.9977144,
+      0.9977648, 0.997816, 0.9978668, 0.9979232, 0.9979744, 0.9980216,
+      0.9980744, 0.9981128, 0.9981516, 0.9981964, 0.9982252, 0.9982644,
+      0.9982976, 0.9983328, 0.9983676, 0.9984064, 0.998436, 0.9984732,
+      0.9985056, 0.998538, 0.9985628, 0.9985912, 0.99862, 0.9986432, 0.9986688,
+      0.9987056, 0.998736, 0.9987608, 0.9987872, 0.9988128, 0.9988372,
+      0.9988572, 0.9988808, 0.9989012, 0.9989316, 0.9989544, 0.9989756,
+      0.9990012, 0.999024, 0.9990476, 0.9990684, 0.9990864, 0.9996648,
+      0.9998728, 1
+   },
+   { // n=35
+      0, 0.001466, 0.0962308, 0.3096116, 0.5102224, 0.6601984, 0.764668,
+      0.7715056, 0.77806, 0.7844008, 0.7904704, 0.7963952, 0.8022292, 0.8078688,
+      0.8133468, 0.8186492, 0.8237492, 0.8288248, 0.833708, 0.8383112,
+      0.8428388, 0.8471836, 0.8514272, 0.8556496, 0.8596224, 0.8635036, 0.86734,
+      0.8709724, 0.8745284, 0.8779932, 0.881342, 0.8846156, 0.8878168,
+      0.8908688, 0.893872, 0.8967896, 0.8996276, 0.902356, 0.9050388, 0.907636,
+      0.9100852, 0.912494, 0.9148464, 0.9171264, 0.9193868, 0.9215548,
+      0.9236884, 0.9257564, 0.9277472, 0.9297028, 0.9315776, 0.933388, 0.935168,
+      0.93687, 0.9385408, 0.9401708, 0.94176, 0.9433024, 0.9447904, 0.946272,
+      0.9476352, 0.9490096, 0.950342, 0.951632, 0.952868, 0.9541032, 0.9553304,
+      0.9565156, 0.9576616, 0.958736, 0.9598348, 0.960898, 0.9618996, 0.9628844,
+      0.9638372, 0.9647456, 0.9656716, 0.9665504, 0.9674108, 0.9682164,
+      0.9690196, 0.9698268, 0.9705848, 0.9713356, 0.9720572, 0.972754, 0.97344,
+      0.9741172, 0.9747956, 0.9754116, 0.9760564, 0.9766648, 0.9772768,
+      0.9778208, 0.9783732, 0.978932, 0.979448, 0.979946, 0.9804348, 0.9809052,
+      0.9813664, 0.9818372, 0.982286, 0.9827164, 0.9831328, 0.9835624,
+      0.9839796, 0.9843712, 0.984766, 0.98515, 0.9855136, 0.9858588, 0.9862136,
+      0.9865272, 0.9868728, 0.9871988, 0.9875, 0.9878088, 0.9880928, 0.9884004,
+      0.98868, 0.988942, 0.9892204, 0.98948, 0.9897288, 0.989978, 0.9902304,
+      0.9904576, 0.9906728, 0.9908932, 0.9911068, 0.9913288, 0.9915324,
+      0.9917348, 0.9919432, 0.9921344, 0.992312, 0.9924876, 0.9926592,
+      0.9928372, 0.993006, 0.9931624, 0.99331, 0.9934672, 0.993622, 0.9937876,
+      0.993936, 0.9940776, 0.9942172, 0.9943408, 0.9944648, 0.9945948, 0.99472,
+      0.9948436, 0.994962, 0.9950704, 0.9951852, 0.9952928, 0.9953972,
+      0.9955148, 0.9956184, 0.9957156, 0.9958084, 0.9959032, 0.9960072,
+      0.9961088, 0.9961932, 0.9962864, 0.9963756, 0.9964488, 0.9965324,
+      0.9966112, 0.9966852, 0.9967548, 0.9968288, 0.9969048, 0.9969804,
+      0.9970444, 0.997104, 0.9971644, 0.9972252, 0.9972832, 0.9973476,
+      0.9974004, 0.9974504, 0.99751, 0.9975744, 0.9976232, 0.9976768, 0.99773,
+      0.9977796, 0.9978272, 0.9978756, 0.9979228, 0.997968, 0.9980076,
+      0.9980504, 0.9980964, 0.9981384, 0.9981816, 0.9982164, 0.9982596,
+      0.9982976, 0.9983368, 0.9983748, 0.9984056, 0.9984356, 0.9984668,
+      0.9985036, 0.9985344, 0.9985712, 0.9986012, 0.9986292, 0.998652,
+      0.9986828, 0.9987144, 0.9987472, 0.99878, 0.9987996, 0.9988272, 0.9988508,
+      0.9988736, 0.9988964, 0.9989228, 0.9989464, 0.9989672, 0.9989836,
+      0.9990032, 0.9990208, 0.9990416, 0.99906, 0.9990812, 0.999678, 0.999878,
+      1
+   },
+   { // n=36
+      0, 0.0015016, 0.0964032, 0.309674, 0.510474, 0.6602192, 0.7646128,
+      0.7713668, 0.7778848, 0.7842452, 0.7904024, 0.796354, 0.8021556, 0.807822,
+      0.8132704, 0.8185904, 0.8236628, 0.8286248, 0.8335132, 0.8381804,
+      0.8426896, 0.8470424, 0.8513436, 0.8555648, 0.8596008, 0.8634884,
+      0.8672916, 0.8710384, 0.8745788, 0.8780812, 0.8814604, 0.8847208,
+      0.8879804, 0.891024, 0.8939936, 0.89691, 0.8997876, 0.9024536, 0.905164,
+      0.9077672, 0.9102796, 0.9127592, 0.9150632, 0.9173396, 0.9195448,
+      0.9217308, 0.9238492, 0.9258756, 0.9278652, 0.9297904, 0.9316568, 0.93347,
+      0.9352608, 0.9369656, 0.9386904, 0.940312, 0.9418968, 0.9434476,
+      0.9449712, 0.9463792, 0.9478316, 0.9492164, 0.950536, 0.9518132, 0.953108,
+      0.95433, 0.9555316, 0.9566904, 0.9578428, 0.958954, 0.9599976, 0.9610572,
+      0.9620508, 0.9630132, 0.9639628, 0.9648888, 0.9657812, 0.9666452,
+      0.9674784, 0.9682908, 0.9691024, 0.9698996, 0.9706324, 0.9713692,
+      0.9721072, 0.9728076, 0.9734884, 0.97413, 0.9747696, 0.9754104, 0.9760016,
+      0.9766184, 0.97723, 0.9777928, 0.9783336, 0.9788796, 0.979388, 0.9798984,
+      0.9803972, 0.9808728, 0.9813624, 0.9818212, 0.9822684, 0.98272, 0.983138,
+      0.9835572, 0.9839588, 0.9843528, 0.9847592, 0.985142, 0.9855116,
+      0.9858608, 0.9862084, 0.98654, 0.9868676, 0.987184, 0.9874956, 0.9877924,
+      0.9880992, 0.9883844, 0.9886544, 0.9889232, 0.989188, 0.9894556,
+      0.9897032, 0.9899432, 0.9901908, 0.990414, 0.9906392, 0.990866, 0.9910796,
+      0.991304, 0.9914924, 0.9916928, 0.9918976, 0.9920948, 0.9922848,
+      0.9924644, 0.9926588, 0.9928344, 0.9929944, 0.9931608, 0.9933076,
+      0.993468, 0.9936108, 0.9937572, 0.9938968, 0.9940416, 0.9941884,
+      0.9943268, 0.9944644, 0.9945888, 0.9947136, 0.9948304, 0.9949548,
+      0.995082, 0.995194, 0.99531, 0.9954136, 0.995524, 0.9956248, 0.9957188,
+      0.9958104, 0.9959152, 0.9960144, 0.9961052, 0.9961964, 0.996274,
+      0.9963664, 0.9964556, 0.9965388, 0.996616, 0.996694, 0.9967776, 0.9968576,
+      0.9969344, 0.9970116, 0.9970836, 0.9971496, 0.9972076, 0.9972744,
+      0.997328, 0.9973932, 0.9974548, 0.9975128, 0.9975624, 0.9976088,
+      0.9976608, 0.9977064, 0.997752, 0.9977964, 0.99785, 0.9978936, 0.997938,
+      0.9979796, 0.9980308, 0.9980736, 0.9981192, 0.9981584, 0.9981968,
+      0.9982392, 0.9982756, 0.9983104, 0.9983444, 0.998386, 0.9984264,
+      0.9984632, 0.998498, 0.9985312, 0.9985628, 0.998592, 0.9986304, 0.9986612,
+      0.9986932, 0.9987184, 0.9987444, 0.9987732, 0.9988008, 0.9988276,
+      0.9988524, 0.9988792, 0.9988976, 0.998924, 0.9989432, 0.9989668,
+      0.9989844, 0.9990024, 0.999024, 0.999042, 0.9990616, 0.99908, 0.9991004,
+      0.9996796, 0.9998808, 1
+   },
+   { // n=37
+      0, 0.0014736, 0.0959372, 0.3098456, 0.510726, 0.6605668, 0.7645412,
+      0.7712928, 0.7778008, 0.7842208, 0.79048, 0.7964648, 0.8022496, 0.80783,
+      0.8132792, 0.8185308, 0.8236964, 0.8286668, 0.8334936, 0.8382052,
+      0.8427828, 0.8471808, 0.851454, 0.8555652, 0.8595468, 0.863482, 0.867256,
+      0.8709124, 0.8744924, 0.8779724, 0.881364, 0.8846716, 0.8878476,
+      0.8908988, 0.8939092, 0.8967752, 0.89955, 0.9022308, 0.9048236, 0.9073648,
+      0.9099268, 0.9123356, 0.9147328, 0.917044, 0.9192832, 0.9215036,
+      0.9236012, 0.9256248, 0.9276072, 0.9295276, 0.9313912, 0.933196,
+      0.9349776, 0.93665, 0.9383524, 0.9399736, 0.9415768, 0.943118, 0.9446512,
+      0.9461208, 0.94756, 0.9489252, 0.950276, 0.9516068, 0.9528784, 0.9541236,
+      0.9553172, 0.9564704, 0.9575928, 0.9587048, 0.9598088, 0.9608496,
+      0.9618428, 0.9628584, 0.963822, 0.9647356, 0.9656244, 0.9664988,
+      0.9673576, 0.9681536, 0.9689464, 0.969742, 0.9705068, 0.9712348, 0.971936,
+      0.972636, 0.9733132, 0.9739752, 0.9745992, 0.97527, 0.9758872, 0.9764932,
+      0.9770872, 0.9776792, 0.9782244, 0.9787892, 0.9793088, 0.9798292, 0.98034,
+      0.9808152, 0.9812976, 0.981762, 0.9821888, 0.982658, 0.9830712, 0.9834864,
+      0.9838924, 0.9842728, 0.9846664, 0.9850364, 0.985394, 0.985752, 0.9860976,
+      0.986444, 0.9867776, 0.9870924, 0.9874012, 0.9877112, 0.988002, 0.9883112,
+      0.9885824, 0.9888748, 0.9891384, 0.9894, 0.9896788, 0.98993, 0.9901776,
+      0.9904068, 0.9906312, 0.9908608, 0.9910764, 0.9912848, 0.991496,
+      0.9916952, 0.9918844, 0.9920768, 0.992262, 0.992442, 0.9926384, 0.9928016,
+      0.9929644, 0.9931432, 0.9933164, 0.9934652, 0.9936356, 0.9937832,
+      0.9939264, 0.9940724, 0.9942096, 0.9943416, 0.994484, 0.9946008,
+      0.9947196, 0.9948504, 0.9949736, 0.9950916, 0.9952084, 0.9953184,
+      0.9954232, 0.995524, 0.9956276, 0.9957364, 0.995826, 0.9959156, 0.9960048,
+      0.9961044, 0.996186, 0.9962812, 0.9963676, 0.9964568, 0.9965356, 0.996606,
+      0.9966764, 0.9967552, 0.9968352, 0.9969136, 0.9969824, 0.9970492,
+      0.9971172, 0.997178, 0.9972508, 0.9973072, 0.9973748, 0.9974352, 0.99749,
+      0.9975496, 0.9976048, 0.9976572, 0.9977068, 0.9977504, 0.9977976,
+      0.9978496, 0.997906, 0.9979472, 0.997996, 0.9980404, 0.99808, 0.9981248,
+      0.9981684, 0.99821, 0.998254, 0.9982932, 0.9983352, 0.998372, 0.9984108,
+      0.9984484, 0.9984796, 0.9985148, 0.998544, 0.9985792, 0.9986116,
+      0.9986416, 0.9986696, 0.9986964, 0.9987256, 0.9987524, 0.9987848,
+      0.998808, 0.9988324, 0.9988596, 0.998884, 0.9989076, 0.99893, 0.9989516,
+      0.9989752, 0.9990036, 0.99902, 0.9990368, 0.9990568, 0.9990764, 0.9990956,
+      0.9991108, 0.9996768, 0.9998824, 1
+   },
+   { // n=38
+      0, 0.0014924, 0.0962432, 0.3096068, 0.5102488, 0.660038, 0.764274,
+      0.7709872, 0.7775484, 0.783774, 0.7899588, 0.7959232, 0.8017296, 0.80735,
+      0.8128444, 0.8181528, 0.8232888, 0.8283144, 0.8331392, 0.8378404,
+      0.8423608, 0.846774, 0.8510888, 0.8552196, 0.8592624, 0.8631172,
+      0.8668896, 0.8705248, 0.8741376, 0.8775844, 0.8809048, 0.8841816,
+      0.887354, 0.8904476, 0.8935244, 0.896446, 0.899294, 0.9020616, 0.9047136,
+      0.9072344, 0.9097612, 0.9122448, 0.9146236, 0.9168812, 0.919122,
+      0.9212744, 0.9234004, 0.9254792, 0.9274732, 0.9293852, 0.931238,
+      0.9330668, 0.9348364, 0.93659, 0.938242, 0.9398604, 0.9414488, 0.9429528,
+      0.9444928, 0.9459352, 0.9473492, 0.9487696, 0.950122, 0.9513704,
+      0.9526348, 0.9538792, 0.9550424, 0.9562132, 0.9573832, 0.9585256,
+      0.9595708, 0.9606052, 0.9616384, 0.9626016, 0.9635544, 0.9644588,
+      0.9653808, 0.9662888, 0.9671404, 0.9679688, 0.9687856, 0.9695616,
+      0.9703484, 0.9710936, 0.9718064, 0.9725312, 0.973192, 0.9738588,
+      0.9745188, 0.9751492, 0.9757692, 0.976386, 0.9769788, 0.977542, 0.9781044,
+      0.978636, 0.9791412, 0.9796308, 0.980132, 0.980618, 0.9810668, 0.9815436,
+      0.9819964, 0.9824372, 0.9828772, 0.9832964, 0.9837092, 0.9841204,
+      0.9845252, 0.9849084, 0.98529, 0.985656, 0.9860032, 0.9863432, 0.986672,
+      0.987, 0.9873016, 0.987602, 0.9878932, 0.9881844, 0.9884744, 0.9887556,
+      0.9890272, 0.9893068, 0.989566, 0.989796, 0.99005, 0.9903, 0.9905336,
+      0.9907608, 0.990966, 0.9911724, 0.9913776, 0.9915676, 0.9917596,
+      0.9919548, 0.9921484, 0.992326, 0.9925056, 0.992686, 0.9928544, 0.993016,
+      0.993178, 0.9933248, 0.9934776, 0.9936348, 0.993776, 0.9939176, 0.9940576,
+      0.9942108, 0.9943532, 0.9944828, 0.994622, 0.994752, 0.9948844, 0.9950004,
+      0.995112, 0.9952292, 0.995342, 0.9954412, 0.99555, 0.995666, 0.995776,
+      0.9958752, 0.9959652, 0.9960572, 0.9961452, 0.9962308, 0.996316,
+      0.9963992, 0.9964776, 0.9965668, 0.9966496, 0.9967244, 0.9968012,
+      0.9968708, 0.9969452, 0.9970148, 0.9970792, 0.9971504, 0.997208, 0.997272,
+      0.9973392, 0.9974012, 0.9974624, 0.9975148, 0.9975692, 0.9976288,
+      0.9976828, 0.9977296, 0.9977792, 0.9978336, 0.9978776, 0.9979228,
+      0.9979692, 0.99801, 0.9980496, 0.998094, 0.9981256, 0.9981636, 0.998202,
+      0.9982452, 0.9982828, 0.9983148, 0.9983528, 0.9983864, 0.9984228,
+      0.9984676, 0.9984976, 0.998534, 0.9985664, 0.9985912, 0.9986244,
+      0.9986568, 0.9986824, 0.9987104, 0.9987452, 0.9987732, 0.9988004, 0.99883,
+      0.9988576, 0.9988816, 0.9989064, 0.9989328, 0.9989544, 0.9989776,
+      0.9989972, 0.9990144, 0.9990328, 0.99905, 0.9990668, 0.9990876, 0.999676,
+      0.999876, 1
+   },
+   { // n=39
+      0, 0.0014928, 0.0960576, 0.309012, 0.5102192, 0.6598668, 0.7644652,
+      0.7712672, 0.7778672, 0.7842012, 0.7904132, 0.7963428, 0.8022152,
+      0.8077788, 0.8131468, 0.818388, 0.823524, 0.8284836, 0.8333756, 0.8380924,
+      0.8425924, 0.8469336, 0.8511956, 0.8553664, 0.8594504, 0.8633568,
+      0.8671856, 0.8708884, 0.8745416, 0.8779944, 0.881362, 0.884648, 0.887752,
+      0.8908308, 0.8938196, 0.8967616, 0.8995584, 0.9023072, 0.9049864,
+      0.9075688, 0.9100944, 0.9125568, 0.9149032, 0.91719, 0.9193956, 0.9215316,
+      0.9236644, 0.92564, 0.92756, 0.92951, 0.9313964, 0.9331764, 0.9349436,
+      0.9366916, 0.9384084, 0.9400004, 0.9415916, 0.9430884, 0.9446152,
+      0.946072, 0.9474948, 0.9488848, 0.9502008, 0.9515272, 0.9527772,
+      0.9540048, 0.9551912, 0.95636, 0.9574868, 0.9585508, 0.9596492, 0.9606844,
+      0.9617152, 0.9626656, 0.963614, 0.9645304, 0.9654184, 0.9662772,
+      0.9670992, 0.9678948, 0.9687216, 0.9695232, 0.9703388, 0.971098, 0.971836,
+      0.9725692, 0.9732476, 0.9739484, 0.9745772, 0.9752048, 0.9758448,
+      0.9764164, 0.9770304, 0.977594, 0.9781624, 0.9786952, 0.9791968,
+      0.9796824, 0.980174, 0.9806808, 0.981144, 0.981622, 0.9820788, 0.9825224,
+      0.9829568, 0.9833864, 0.983804, 0.9841784, 0.9845684, 0.9849708,
+      0.9853476, 0.9856968, 0.9860204, 0.9863824, 0.9867044, 0.9870216,
+      0.9873444, 0.9876416, 0.9879544, 0.988268, 0.9885536, 0.988844, 0.9891124,
+      0.9893808, 0.9896396, 0.9898944, 0.9901316, 0.9903716, 0.9906012,
+      0.990832, 0.9910452, 0.9912644, 0.9914732, 0.99169, 0.991872, 0.9920636,
+      0.9922696, 0.9924524, 0.9926408, 0.9928084, 0.992982, 0.9931308,
+      0.9932988, 0.9934528, 0.9936136, 0.9937536, 0.9938936, 0.994034,
+      0.9941716, 0.9943128, 0.994436, 0.9945684, 0.9946976, 0.994806, 0.9949264,
+      0.9950356, 0.9951432, 0.9952468, 0.99537, 0.995472, 0.9955768, 0.995668,
+      0.9957716, 0.9958692, 0.995962, 0.9960548, 0.996134, 0.99622, 0.9963028,
+      0.9963948, 0.996484, 0.996562, 0.9966428, 0.9967104, 0.9967876, 0.9968472,
+      0.9969144, 0.9969836, 0.997044, 0.9971052, 0.9971724, 0.9972368,
+      0.9973048, 0.99737, 0.9974292, 0.9974856, 0.9975404, 0.997596, 0.9976424,
+      0.9976916, 0.9977392, 0.997784, 0.9978336, 0.9978792, 0.9979292,
+      0.9979728, 0.9980208, 0.9980648, 0.9981044, 0.9981472, 0.9981808,
+      0.9982236, 0.9982592, 0.9982988, 0.9983324, 0.9983724, 0.9984128,
+      0.9984492, 0.9984856, 0.9985176, 0.9985408, 0.9985708, 0.9986024,
+      0.9986332, 0.9986592, 0.9986892, 0.9987112, 0.9987436, 0.9987688,
+      0.9987964, 0.9988232, 0.9988456, 0.9988644, 0.9988836, 0.9989088,
+      0.9989316, 0.9989488, 0.9989784, 0.9990044, 0.9990252, 0.9990452,
+      0.9990616, 0.9996644, 0.9998768, 1
+   },
+   { // n=40
+      0, 0.0014888, 0.096174, 0.309098, 0.51005, 0.659634, 0.7641692, 0.770892,
+      0.7775348, 0.7838432, 0.7900528, 0.7960668, 0.8019304, 0.8075608,
+      0.8130764, 0.8183956, 0.8235956, 0.82858, 0.8333268, 0.8379348, 0.842512,
+      0.8468692, 0.8511248, 0.85523, 0.8592608, 0.863122, 0.8669328, 0.87062,
+      0.874228, 0.8777044, 0.8811492, 0.8843696, 0.88756, 0.8906292, 0.8936448,
+      0.8965252, 0.8993928, 0.9021336, 0.9047684, 0.907374, 0.9099384,
+      0.9123404, 0.9146984, 0.9170084, 0.9192372, 0.9214056, 0.9234736,
+      0.9255392, 0.9275708, 0.9295024, 0.9313552, 0.9331652, 0.9349504,
+      0.9367068, 0.9383768, 0.9400088, 0.9415984, 0.9431536, 0.9446376,
+      0.9460776, 0.9474992, 0.9488312, 0.9501784, 0.9514892, 0.9527692,
+      0.9540044, 0.9551684, 0.9563304, 0.957464, 0.9585408, 0.9595976, 0.960634,
+      0.961678, 0.9626788, 0.963632, 0.9645464, 0.9654364, 0.966304, 0.967182,
+      0.9680188, 0.9688352, 0.9696428, 0.9703908, 0.971128, 0.9718592, 0.972562,
+      0.9732516, 0.9739536, 0.9746384, 0.9753172, 0.9759436, 0.9765392,
+      0.9771468, 0.977732, 0.9782732, 0.9787992, 0.979332, 0.9798384, 0.9803472,
+      0.9808284, 0.9813192, 0.9817596, 0.9821972, 0.982634, 0.9830488,
+      0.9834604, 0.983862, 0.9842372, 0.9846328, 0.9850112, 0.9853784,
+      0.9857424, 0.9860896, 0.9864476, 0.986772, 0.987106, 0.9874208, 0.9877328,
+      0.9880264, 0.9883316, 0.988618, 0.9889028, 0.9891748, 0.989452, 0.9896984,
+      0.9899484, 0.990192, 0.9904352, 0.9906644, 0.9908772, 0.9910984,
+      0.9913184, 0.9915188, 0.9917188, 0.9918976, 0.9920928, 0.9922816,
+      0.9924704, 0.9926432, 0.9928268, 0.992992, 0.9931764, 0.9933388, 0.993502,
+      0.9936512, 0.993798, 0.9939344, 0.9940728, 0.9942136, 0.9943636,
+      0.9944904, 0.9946288, 0.9947568, 0.99489, 0.9950024, 0.995132, 0.9952408,
+      0.9953556, 0.9954712, 0.9955804, 0.9956836, 0.99577, 0.9958676, 0.9959584,
+      0.9960492, 0.9961452, 0.9962296, 0.9963196, 0.9963984, 0.9964832,
+      0.9965708, 0.9966544, 0.9967324, 0.9968072, 0.9968804, 0.9969428,
+      0.9970072, 0.9970744, 0.9971388, 0.9971904, 0.9972488, 0.997306,
+      0.9973712, 0.9974288, 0.9974836, 0.997542, 0.9975968, 0.997654, 0.997708,
+      0.9977608, 0.9978096, 0.9978608, 0.99791, 0.9979524, 0.9980028, 0.998038,
+      0.9980808, 0.998126, 0.9981708, 0.998208, 0.998246, 0.9982824, 0.9983212,
+      0.9983636, 0.9984036, 0.9984376, 0.9984696, 0.9985008, 0.9985412,
+      0.9985736, 0.9986008, 0.9986264, 0.9986596, 0.9986848, 0.9987168,
+      0.9987504, 0.9987752, 0.9987992, 0.9988252, 0.998848, 0.998872, 0.9988932,
+      0.9989144, 0.998932, 0.9989508, 0.9989756, 0.9989944, 0.99902, 0.9990384,
+      0.9990568, 0.9990804, 0.9991008, 0.9996848, 0.9998752, 1
+   },
+   { // n=41
+      0, 0.0015148, 0.0965104, 0.3091856, 0.5100988, 0.6597064, 0.7640636,
+      0.7708352, 0.7774544, 0.7838952, 0.7899788, 0.7959924, 0.801742,
+      0.8074084, 0.812854, 0.8181228, 0.823268, 0.8283396, 0.8332536, 0.8379444,
+      0.8424988, 0.8469748, 0.8512596, 0.855404, 0.8593972, 0.8633884,
+      0.8671232, 0.8708096, 0.874418, 0.8780012, 0.8813624, 0.8846684, 0.88786,
+      0.8909352, 0.8939144, 0.8968188, 0.899604, 0.9023496, 0.9049732,
+      0.9075544, 0.910054, 0.9124376, 0.9147668, 0.9170556, 0.9192312,
+      0.9214104, 0.9234824, 0.9255456, 0.9275884, 0.9295408, 0.9314208,
+      0.9332392, 0.9349892, 0.9366756, 0.938338, 0.9399716, 0.9415356,
+      0.9430416, 0.9445544, 0.9460344, 0.9474472, 0.9488124, 0.950162,
+      0.9514732, 0.9527324, 0.953978, 0.9552164, 0.9563608, 0.9574756,
+      0.9586052, 0.9596932, 0.9607384, 0.9617512, 0.9627648, 0.9637488,
+      0.9647092, 0.9655788, 0.9664568, 0.9673044, 0.9681252, 0.9689636,
+      0.9697628, 0.9705176, 0.9712956, 0.9720308, 0.9727404, 0.9734156,
+      0.9740932, 0.9747356, 0.9753836, 0.975996, 0.9766196, 0.977178, 0.9777628,
+      0.978302, 0.9788332, 0.9793532, 0.9798932, 0.9803944, 0.980888, 0.981366,
+      0.981844, 0.9822996, 0.9827296, 0.9831584, 0.9835584, 0.9839792,
+      0.9843784, 0.9847712, 0.9851384, 0.9855152, 0.9858732, 0.986218,
+      0.9865492, 0.9868732, 0.9871852, 0.9875096, 0.9878072, 0.9881104,
+      0.9884016, 0.9886748, 0.9889528, 0.9892328, 0.9894788, 0.9897252,
+      0.9899552, 0.990194, 0.9904176, 0.9906416, 0.990882, 0.9911068, 0.9913264,
+      0.9915212, 0.9917232, 0.99192, 0.9921188, 0.9923104, 0.9924836, 0.9926672,
+      0.9928448, 0.9930228, 0.9931856, 0.9933408, 0.9935092, 0.9936676,
+      0.9938136, 0.9939644, 0.9941072, 0.99423, 0.9943588, 0.994492, 0.9946208,
+      0.9947508, 0.9948684, 0.9949884, 0.9950924, 0.995212, 0.9953272,
+      0.9954412, 0.9955448, 0.9956384, 0.9957308, 0.9958268, 0.995912, 0.996006,
+      0.9960976, 0.9961876, 0.9962604, 0.9963452, 0.9964276, 0.99651, 0.9965936,
+      0.9966728, 0.9967416, 0.9968232, 0.996888, 0.996958, 0.9970332, 0.9970948,
+      0.9971556, 0.9972228, 0.99729, 0.9973448, 0.9974024, 0.99747, 0.9975288,
+      0.9975868, 0.997638, 0.9976956, 0.997744, 0.9977976, 0.9978492, 0.9979028,
+      0.9979456, 0.9979988, 0.9980468, 0.99809, 0.9981348, 0.9981728, 0.998214,
+      0.9982508, 0.998292, 0.9983284, 0.9983628, 0.998402, 0.998436, 0.998468,
+      0.9985056, 0.9985372, 0.9985712, 0.9986052, 0.9986344, 0.9986632,
+      0.9986964, 0.9987256, 0.9987536, 0.9987784, 0.9988016, 0.9988232,
+      0.9988476, 0.998876, 0.9989028, 0.9989184, 0.9989412, 0.998964, 0.9989868,
+      0.9990092, 0.9990308, 0.9990536, 0.999074, 0.9990972, 0.9991164,
+      0.9996852, 0.9998832, 1
+   },
+   { // n=42
+      0, 0.0015348, 0.0964096, 0.3090712, 0.5097324, 0.6592136, 0.763698,
+      0.7705244, 0.7771232, 0.7835196, 0.7896648, 0.7957204, 0.801522,
+      0.8070808, 0.812594, 0.8179576, 0.8231612, 0.828082, 0.8329264, 0.837636,
+      0.8422376, 0.8466892, 0.8509804, 0.8551356, 0.8592136, 0.8632, 0.8670376,
+      0.870746, 0.87435, 0.8778516, 0.8812828, 0.8846552, 0.8878864, 0.8909912,
+      0.8939844, 0.8969132, 0.8998052, 0.902548, 0.9051688, 0.9076696,
+      0.9102092, 0.912632, 0.9149856, 0.9172684, 0.9195064, 0.9216752,
+      0.9237228, 0.925754, 0.9277832, 0.9296992, 0.9315508, 0.9333664,
+      0.9351408, 0.9369136, 0.9385496, 0.9401508, 0.9417296, 0.943298,
+      0.9448276, 0.9462568, 0.9476176, 0.9490008, 0.9503416, 0.9516264, 0.95286,
+      0.9540756, 0.955276, 0.9564304, 0.9575488, 0.9586388, 0.9596996, 0.960732,
+      0.9617776, 0.9627528, 0.9637164, 0.9646524, 0.9655672, 0.9664476,
+      0.9673024, 0.9681464, 0.9689584, 0.9697768, 0.9705296, 0.9712848,
+      0.9720188, 0.9727524, 0.9734128, 0.9740964, 0.9747332, 0.9754064,
+      0.976016, 0.976624, 0.9772444, 0.977844, 0.9784048, 0.9789512, 0.9794708,
+      0.9799824, 0.9805108, 0.9809736, 0.981466, 0.981916, 0.9823516, 0.9827796,
+      0.9832096, 0.9836276, 0.9840252, 0.984426, 0.9847984, 0.9851896,
+      0.9855528, 0.9858836, 0.9862272, 0.9865624, 0.98689, 0.98721, 0.9875284,
+      0.98783, 0.9881008, 0.9883624, 0.9886356, 0.9889048, 0.9891772, 0.9894124,
+      0.989678, 0.9899224, 0.9901484, 0.9903936, 0.9906216, 0.9908588,
+      0.9910724, 0.9912868, 0.991488, 0.991688, 0.9918868, 0.9920856, 0.9922748,
+      0.9924732, 0.9926692, 0.9928312, 0.992992, 0.9931556, 0.993318, 0.9934736,
+      0.9936212, 0.993772, 0.9939412, 0.9940792, 0.9942292, 0.9943616,
+      0.9944868, 0.9946064, 0.9947316, 0.9948604, 0.994976, 0.99509, 0.9951992,
+      0.9953152, 0.9954276, 0.9955416, 0.9956376, 0.9957436, 0.9958392,
+      0.995926, 0.9960172, 0.9961084, 0.9962044, 0.9962964, 0.9963716,
+      0.9964512, 0.9965236, 0.9966096, 0.9966896, 0.9967632, 0.9968344,
+      0.9969056, 0.9969784, 0.997046, 0.9971092, 0.997176, 0.997234, 0.997304,
+      0.9973676, 0.997426, 0.9974812, 0.9975372, 0.9975928, 0.9976448,
+      0.9976952, 0.9977444, 0.9977936, 0.9978452, 0.997886, 0.9979256,
+      0.9979704, 0.9980176, 0.9980544, 0.9981044, 0.9981404, 0.9981792,
+      0.9982184, 0.998254, 0.9982864, 0.9983276, 0.9983648, 0.998402, 0.9984404,
+      0.9984752, 0.9985124, 0.9985452, 0.9985812, 0.9986116, 0.9986432,
+      0.9986696, 0.9987016, 0.99873, 0.9987556, 0.9987764, 0.9987984, 0.998824,
+      0.99885, 0.9988716, 0.9988968, 0.9989188, 0.9989432, 0.9989652, 0.9989816,
+      0.9990068, 0.9990272, 0.9990484, 0.9990632, 0.999086, 0.9996728, 0.99988,
+      1
+   },
+   { // n=43
+      0, 0.001534, 0.0960292, 0.309148, 0.510322, 0.6602156, 0.7643388,
+      0.7710556, 0.77761, 0.7839956, 0.790082, 0.7959972, 0.8017752, 0.8073612,
+      0.8128084, 0.8181036, 0.8231564, 0.828196, 0.8330224, 0.8376456,
+      0.8422392, 0.8466828, 0.8509624, 0.855184, 0.8591964, 0.8631876,
+      0.8669576, 0.8706664, 0.8742348, 0.8777672, 0.8811012, 0.8843516,
+      0.8875052, 0.8905832, 0.8935896, 0.8965076, 0.8994056, 0.9021612,
+      0.9048444, 0.9074476, 0.9099708, 0.912394, 0.9148112, 0.9170976, 0.919342,
+      0.9214908, 0.9236252, 0.9256748, 0.9276296, 0.9295928, 0.9314784,
+      0.9332872, 0.9350428, 0.9367712, 0.938382, 0.9399832, 0.9415764,
+      0.9431512, 0.9446248, 0.9460836, 0.9474576, 0.9488136, 0.950132,
+      0.9514168, 0.9526916, 0.9538928, 0.9551208, 0.9562448, 0.9573956,
+      0.9584952, 0.9595896, 0.9606256, 0.9616228, 0.9625752, 0.9635244,
+      0.9644292, 0.9653468, 0.966232, 0.9670728, 0.9679076, 0.9687468,
+      0.9695364, 0.9703176, 0.9710624, 0.971782, 0.972498, 0.9732052, 0.9738828,
+      0.9745156, 0.9751588, 0.9757712, 0.976378, 0.976952, 0.9775052, 0.9780704,
+      0.9786072, 0.9791388, 0.9796592, 0.9801596, 0.9806572, 0.9811224,
+      0.9816032, 0.9820576, 0.982518, 0.9829424, 0.983382, 0.983792, 0.9842164,
+      0.9845992, 0.984992, 0.9853568, 0.9857288, 0.9860712, 0.9864044,
+      0.9867248, 0.9870584, 0.9873656, 0.9876756, 0.9879764, 0.9882464,
+      0.9885476, 0.9888248, 0.989094, 0.9893404, 0.9895936, 0.9898272,
+      0.9900628, 0.9902956, 0.9905296, 0.9907616, 0.99098, 0.9912148, 0.991428,
+      0.9916436, 0.9918388, 0.9920348, 0.992226, 0.9924108, 0.9925892,
+      0.9927648, 0.992954, 0.9931124, 0.9932844, 0.9934352, 0.9935888,
+      0.9937464, 0.993888, 0.994034, 0.994172, 0.994312, 0.994436, 0.99455,
+      0.9946756, 0.9947972, 0.9949136, 0.9950272, 0.9951464, 0.99525, 0.9953588,
+      0.995468, 0.9955692, 0.9956748, 0.9957628, 0.9958604, 0.9959548,
+      0.9960436, 0.9961308, 0.9962172, 0.996304, 0.9963832, 0.996456, 0.9965412,
+      0.996626, 0.9967036, 0.9967776, 0.9968448, 0.9969156, 0.9969992,
+      0.9970648, 0.9971308, 0.99719, 0.9972552, 0.9973204, 0.997382, 0.9974504,
+      0.9975084, 0.9975568, 0.9976104, 0.997668, 0.9977124, 0.9977632,
+      0.9978188, 0.9978644, 0.9979164, 0.9979592, 0.9980132, 0.9980584,
+      0.9981016, 0.9981456, 0.9981876, 0.9982308, 0.9982672, 0.9983136,
+      0.9983496, 0.9983812, 0.9984244, 0.998456, 0.9984828, 0.998516, 0.9985444,
+      0.9985764, 0.9986056, 0.9986312, 0.998668, 0.9986992, 0.9987244,
+      0.9987512, 0.9987824, 0.9988112, 0.9988376, 0.998864, 0.9988888,
+      0.9989152, 0.9989416, 0.9989672, 0.9989856, 0.9990084, 0.9990284,
+      0.9990492, 0.9990744, 0.9990932, 0.9991128, 0.9996996, 0.9998932, 1
+   },
+   { // n=44
+      0, 0.00153, 0.096194, 0.3092948, 0.5096744, 0.6594548, 0.7638144,
+      0.7705372, 0.7770996, 0.783478, 0.7897192, 0.7957104, 0.8014944,
+      0.8071392, 0.8126748, 0.8180032, 0.8231656, 0.8281332, 0.8329832,
+      0.837672, 0.8421672, 0.84655, 0.8508364, 0.8549968, 0.8590624, 0.8629004,
+      0.8667508, 0.8704172, 0.87406, 0.8775376, 0.8809652, 0.8842756, 0.887412,
+      0.8904512, 0.8934068, 0.8963392, 0.8991776, 0.9018904, 0.90458, 0.9071976,
+      0.9097172, 0.9121508, 0.9145168, 0.9167908, 0.9189836, 0.9211028,
+      0.9232032, 0.9252288, 0.9271648, 0.9290756, 0.9309672, 0.9327992,
+      0.9345708, 0.9363112, 0.9379612, 0.9395984, 0.941194, 0.9427732,
+      0.9443284, 0.9458124, 0.9472288, 0.9486084, 0.9499516, 0.9512536,
+      0.9525504, 0.9537724, 0.9549732, 0.9561224, 0.9572684, 0.9584272,
+      0.9595064, 0.9605352, 0.9615472, 0.9625244, 0.9635048, 0.9644392,
+      0.965336, 0.966234, 0.967098, 0.9679052, 0.9687024, 0.9694716, 0.9702784,
+      0.9710332, 0.971782, 0.9725332, 0.9732244, 0.9739132, 0.9745652,
+      0.9751772, 0.9758024, 0.9764104, 0.9770256, 0.9776256, 0.978176,
+      0.9787408, 0.9792724, 0.979788, 0.980274, 0.9807728, 0.9812716, 0.9817272,
+      0.98217, 0.9826, 0.983026, 0.983438, 0.983838, 0.9842328, 0.9846136,
+      0.9849912, 0.985354, 0.985708, 0.9860656, 0.9863956, 0.9867168, 0.987054,
+      0.9873852, 0.9876712, 0.9879688, 0.9882592, 0.988546, 0.9888032, 0.989078,
+      0.989344, 0.9896048, 0.9898552, 0.9900964, 0.9903412, 0.9905636,
+      0.9907884, 0.9909844, 0.9912076, 0.9914224, 0.9916228, 0.9918096,
+      0.9920096, 0.9921976, 0.9923852, 0.9925652, 0.99273, 0.992892, 0.993058,
+      0.993226, 0.9933848, 0.9935524, 0.993702, 0.993846, 0.9940052, 0.9941468,
+      0.9942768, 0.9943972, 0.994524, 0.9946396, 0.9947628, 0.9948792,
+      0.9949904, 0.9951008, 0.9952152, 0.9953328, 0.9954472, 0.9955552,
+      0.9956592, 0.9957644, 0.9958632, 0.9959632, 0.9960584, 0.9961536,
+      0.9962464, 0.9963348, 0.9964176, 0.996498, 0.9965756, 0.996668, 0.9967432,
+      0.9968156, 0.9968928, 0.9969588, 0.9970228, 0.9970884, 0.9971612,
+      0.997218, 0.99728, 0.9973472, 0.997406, 0.9974664, 0.9975192, 0.9975756,
+      0.9976224, 0.9976756, 0.9977256, 0.9977712, 0.9978128, 0.997858,
+      0.9978976, 0.9979468, 0.9979972, 0.99804, 0.9980824, 0.9981288, 0.9981652,
+      0.9982008, 0.9982428, 0.9982856, 0.998318, 0.9983564, 0.9983856, 0.998422,
+      0.998454, 0.9984872, 0.9985268, 0.9985608, 0.9985956, 0.9986292,
+      0.9986556, 0.9986912, 0.998718, 0.998744, 0.9987644, 0.9987944, 0.9988204,
+      0.998848, 0.9988728, 0.998896, 0.9989188, 0.9989408, 0.9989652, 0.998988,
+      0.99901, 0.9990324, 0.99905, 0.9990756, 0.9990992, 0.9996836, 0.999876, 1
+   },
+   { // n=45
+      0, 0.0015536, 0.0963968, 0.3091776, 0.5098244, 0.659264, 0.763752,
+      0.7705604, 0.7771992, 0.783654, 0.7898596, 0.7959112, 0.8016976, 0.807336,
+      0.8127476, 0.818044, 0.8231884, 0.8282096, 0.8330296, 0.837754, 0.8423144,
+      0.8467768, 0.8510556, 0.855212, 0.8592092, 0.8631052, 0.8668696,
+      0.8705752, 0.8741748, 0.8776524, 0.8810048, 0.8843224, 0.887514, 0.890602,
+      0.8935448, 0.8964848, 0.8993268, 0.902036, 0.9046904, 0.9072632,
+      0.9097188, 0.9121836, 0.91458, 0.9168608, 0.9190584, 0.9212456, 0.9233456,
+      0.9253848, 0.9273668, 0.9293468, 0.9312224, 0.9330296, 0.9348, 0.9365916,
+      0.938252, 0.9399012, 0.941484, 0.9430412, 0.9445424, 0.9460072, 0.9474168,
+      0.9487704, 0.9501004, 0.9513812, 0.9526076, 0.9537944, 0.954954,
+      0.9561412, 0.9573052, 0.9583988, 0.959442, 0.960514, 0.9615492, 0.962574,
+      0.9635316, 0.9644692, 0.9654076, 0.966276, 0.9671176, 0.967978, 0.968816,
+      0.9696108, 0.9704052, 0.9711652, 0.9718868, 0.9725728, 0.973258, 0.973948,
+      0.9746204, 0.9752368, 0.975848, 0.9764256, 0.9770004, 0.977566, 0.9781456,
+      0.9786944, 0.9792336, 0.9797484, 0.9802644, 0.9807492, 0.9812248,
+      0.981684, 0.9821412, 0.98259, 0.9830228, 0.9834364, 0.9838424, 0.9842344,
+      0.9846356, 0.9849908, 0.9853636, 0.9857268, 0.9860728, 0.9864152,
+      0.986762, 0.9870916, 0.987424, 0.9877292, 0.9880356, 0.9883288, 0.9886224,
+      0.9889072, 0.9891756, 0.9894252, 0.9896744, 0.989916, 0.9901428,
+      0.9903668, 0.9906152, 0.9908304, 0.9910468, 0.991258, 0.9914824, 0.991674,
+      0.9918656, 0.99206, 0.9922608, 0.9924324, 0.9926116, 0.9927916, 0.9929484,
+      0.9931148, 0.9932764, 0.9934312, 0.9935804, 0.9937324, 0.9938824,
+      0.9940216, 0.9941744, 0.9943144, 0.9944428, 0.994586, 0.9947116, 0.99484,
+      0.9949552, 0.9950648, 0.9951888, 0.9952972, 0.9953976, 0.995494,
+      0.9956024, 0.9956932, 0.995786, 0.9958924, 0.9959844, 0.996072, 0.9961648,
+      0.9962552, 0.9963524, 0.996428, 0.996516, 0.996596, 0.9966736, 0.9967436,
+      0.9968236, 0.9968948, 0.9969612, 0.997022, 0.9970904, 0.9971576,
+      0.9972176, 0.997278, 0.9973468, 0.9974028, 0.9974672, 0.9975276, 0.99759,
+      0.997642, 0.9976924, 0.9977468, 0.9977944, 0.9978468, 0.9979032,
+      0.9979436, 0.9979896, 0.998028, 0.9980744, 0.9981244, 0.998164, 0.9982056,
+      0.9982464, 0.998292, 0.998326, 0.9983644, 0.9984008, 0.9984392, 0.9984784,
+      0.9985076, 0.9985344, 0.9985668, 0.9986028, 0.9986352, 0.9986644,
+      0.9986988, 0.9987276, 0.9987548, 0.9987852, 0.9988144, 0.9988432,
+      0.9988696, 0.9988864, 0.998916, 0.998938, 0.9989548, 0.9989752, 0.9989984,
+      0.9990212, 0.9990368, 0.9990556, 0.9990728, 0.999092, 0.9991104, 0.999688,
+      0.9998872, 1
+   },
+   { // n=46
+      0, 0.0015516, 0.09609, 0.3089836, 0.5094764, 0.6593156, 0.763676,
+      0.7704848, 0.7770628, 0.7834176, 0.7895192, 0.7954468, 0.8012728,
+      0.8068852, 0.8123584, 0.8175996, 0.8228032, 0.827836, 0.8326672,
+      0.8373972, 0.8419524, 0.846422, 0.8507696, 0.8548972, 0.8589248,
+      0.8628176, 0.8666152, 0.8702676, 0.8738556, 0.8773188, 0.880738,
+      0.8840104, 0.887194, 0.8902952, 0.8932636, 0.8961908, 0.89904, 0.9018216,
+      0.9044592, 0.907018, 0.9095632, 0.9120436, 0.914406, 0.9167108, 0.9189412,
+      0.921148, 0.9232532, 0.9253456, 0.9273728, 0.929354, 0.9312464, 0.933054,
+      0.9348464, 0.9365852, 0.9382916, 0.939918, 0.941496, 0.9430356, 0.9445096,
+      0.9459644, 0.947378, 0.948736, 0.9500496, 0.9513868, 0.9526764, 0.95393,
+      0.9551144, 0.956308, 0.9574268, 0.9585264, 0.9595876, 0.960606, 0.9616008,
+      0.9625504, 0.9635048, 0.9644088, 0.9653304, 0.96621, 0.967064, 0.9678952,
+      0.9687244, 0.969536, 0.9702596, 0.971004, 0.9717368, 0.9724716, 0.973144,
+      0.9738204, 0.9744864, 0.9751228, 0.975744, 0.9763476, 0.9769384,
+      0.9775304, 0.9780816, 0.9786208, 0.9791776, 0.9796952, 0.9801928,
+      0.9806864, 0.9811936, 0.981678, 0.9821356, 0.9825704, 0.9830224,
+      0.9834116, 0.9838044, 0.9842044, 0.9845896, 0.9849716, 0.9853476,
+      0.9857056, 0.986062, 0.9863924, 0.9867188, 0.987042, 0.9873652, 0.9876532,
+      0.9879552, 0.988244, 0.9885324, 0.988822, 0.9891064, 0.9893608, 0.98962,
+      0.989862, 0.990106, 0.990336, 0.9905688, 0.9907836, 0.9910108, 0.991236,
+      0.9914432, 0.9916568, 0.9918588, 0.9920556, 0.9922572, 0.9924456,
+      0.9926028, 0.9927812, 0.9929524, 0.9931248, 0.9932672, 0.9934368,
+      0.9935804, 0.9937488, 0.993882, 0.9940188, 0.9941584, 0.9942844, 0.994416,
+      0.9945424, 0.9946652, 0.9947896, 0.9949168, 0.9950424, 0.9951436,
+      0.9952676, 0.9953752, 0.995488, 0.995594, 0.9956864, 0.9957916, 0.995908,
+      0.9959948, 0.9960808, 0.996178, 0.9962628, 0.9963496, 0.9964244,
+      0.9965096, 0.9966, 0.9966752, 0.996744, 0.9968088, 0.9968804, 0.9969536,
+      0.9970204, 0.9970904, 0.9971544, 0.9972284, 0.9972972, 0.9973508,
+      0.9974128, 0.997468, 0.99753, 0.997586, 0.9976408, 0.9976964, 0.9977452,
+      0.9977956, 0.9978536, 0.9979004, 0.99794, 0.9979844, 0.998038, 0.9980804,
+      0.9981208, 0.998162, 0.9982016, 0.9982484, 0.9982884, 0.9983224,
+      0.9983612, 0.9983944, 0.9984264, 0.9984588, 0.9984944, 0.9985232,
+      0.9985532, 0.9985792, 0.998612, 0.9986392, 0.9986684, 0.998706, 0.9987364,
+      0.9987612, 0.9987868, 0.998812, 0.9988392, 0.998862, 0.9988888, 0.9989156,
+      0.9989412, 0.9989612, 0.9989832, 0.999004, 0.999026, 0.9990432, 0.9990644,
+      0.9990828, 0.999104, 0.9997008, 0.9998772, 1
+   },
+   { // n=47
+      0, 0.001564, 0.095948, 0.3092696, 0.5093728, 0.65899, 0.7633136,
+      0.7700268, 0.7765696, 0.782924, 0.7891652, 0.7951308, 0.8009716,
+      0.8066928, 0.8121476, 0.8174872, 0.822668, 0.8276272, 0.832532, 0.8372428,
+      0.8416956, 0.8461112, 0.8503384, 0.8545784, 0.8586584, 0.8625948,
+      0.8664492, 0.870144, 0.873726, 0.8772012, 0.8805712, 0.8838932, 0.8871004,
+      0.8901828, 0.8931608, 0.8960856, 0.8989444, 0.9017316, 0.904448,
+      0.9070292, 0.9095408, 0.9119792, 0.9143584, 0.9166872, 0.9189168,
+      0.9211276, 0.9232404, 0.9252928, 0.9272588, 0.929194, 0.9310904,
+      0.9329336, 0.9346784, 0.936446, 0.9381524, 0.939776, 0.9413876, 0.9429448,
+      0.9444684, 0.9459464, 0.9473896, 0.9487456, 0.9500288, 0.9513096,
+      0.9525784, 0.9538288, 0.9549964, 0.9561768, 0.9573008, 0.9584056,
+      0.9594612, 0.9605124, 0.9615172, 0.9625052, 0.9634744, 0.96441, 0.965312,
+      0.9662028, 0.9670832, 0.967946, 0.9687592, 0.9695536, 0.9703316,
+      0.9710856, 0.971818, 0.9725304, 0.9732188, 0.9738792, 0.9745424,
+      0.9751628, 0.9758132, 0.976414, 0.9769752, 0.9775496, 0.9780964,
+      0.9786284, 0.9791488, 0.9796544, 0.9801608, 0.9806384, 0.9811052,
+      0.9815672, 0.9820248, 0.9824524, 0.9828896, 0.983296, 0.9837152, 0.98411,
+      0.9844916, 0.9848556, 0.9852496, 0.98561, 0.9859576, 0.9862872, 0.9866264,
+      0.9869584, 0.9872752, 0.9875848, 0.9878976, 0.9881956, 0.9884708,
+      0.9887504, 0.9890252, 0.9892748, 0.9895216, 0.9897936, 0.9900492,
+      0.9902812, 0.9905128, 0.9907416, 0.9909508, 0.9911692, 0.9913952,
+      0.9915996, 0.9918168, 0.9920184, 0.9922068, 0.9923892, 0.9925792,
+      0.9927656, 0.9929228, 0.993094, 0.9932476, 0.9934004, 0.9935524,
+      0.9937008, 0.9938516, 0.9939928, 0.9941484, 0.9942792, 0.9944208,
+      0.9945592, 0.9946892, 0.9948116, 0.9949232, 0.9950296, 0.995152, 0.99526,
+      0.9953656, 0.995476, 0.995576, 0.995682, 0.9957792, 0.9958888, 0.9959856,
+      0.9960764, 0.9961644, 0.9962584, 0.9963448, 0.9964276, 0.9965048,
+      0.9965744, 0.996656, 0.9967296, 0.9968032, 0.996878, 0.9969468, 0.9970196,
+      0.9970924, 0.9971512, 0.9972236, 0.997286, 0.9973464, 0.9974172,
+      0.9974728, 0.9975336, 0.9975952, 0.9976592, 0.997716, 0.9977636,
+      0.9978148, 0.9978652, 0.9979064, 0.9979504, 0.9979856, 0.9980296,
+      0.9980772, 0.9981232, 0.9981688, 0.9982048, 0.998248, 0.9982936,
+      0.9983236, 0.9983632, 0.9984, 0.9984288, 0.9984604, 0.9984924, 0.9985276,
+      0.9985644, 0.9985972, 0.9986244, 0.9986492, 0.998676, 0.9987036,
+      0.9987288, 0.998762, 0.9987872, 0.9988148, 0.9988368, 0.9988652,
+      0.9988872, 0.9989096, 0.998932, 0.9989608, 0.9989816, 0.999004, 0.999028,
+      0.99905, 0.9990696, 0.9990888, 0.999108, 0.999682, 0.9998868, 1
+   },
+   { // n=48
+      0, 0.0015312, 0.096332, 0.3089888, 0.5092472, 0.6589444, 0.7629992,
+      0.7697476, 0.7763284, 0.782646, 0.7888536, 0.7948484, 0.8006116,
+      0.8062728, 0.8117752, 0.817086, 0.8222992, 0.8272636, 0.8320484,
+      0.8367432, 0.8413328, 0.8457508, 0.8501432, 0.8542804, 0.8584144,
+      0.862304, 0.8661652, 0.8699456, 0.8735728, 0.8770844, 0.8804828,
+      0.8837732, 0.8869332, 0.8900464, 0.8930296, 0.8959372, 0.8987828,
+      0.9015384, 0.9041716, 0.9067692, 0.9093056, 0.9117392, 0.9141024,
+      0.9164084, 0.918668, 0.9208372, 0.9229644, 0.9250088, 0.9270288,
+      0.9289964, 0.9308484, 0.9326356, 0.9344408, 0.9361852, 0.9379208,
+      0.939608, 0.9411996, 0.9427356, 0.9442696, 0.945724, 0.9471856, 0.9486076,
+      0.9499436, 0.9512268, 0.9524724, 0.9537384, 0.9549404, 0.9561144,
+      0.9572628, 0.9583924, 0.959444, 0.9604584, 0.961466, 0.962462, 0.9634392,
+      0.964396, 0.965314, 0.966182, 0.9670512, 0.9678656, 0.9686828, 0.9694588,
+      0.9702332, 0.9709956, 0.9717436, 0.9724432, 0.973148, 0.9738512,
+      0.9745528, 0.9751664, 0.9757872, 0.9764252, 0.9770148, 0.9775984,
+      0.9781828, 0.9787628, 0.9792952, 0.9797952, 0.9803152, 0.9808116,
+      0.981292, 0.981774, 0.9822348, 0.9826704, 0.9831136, 0.9835408, 0.9839632,
+      0.984352, 0.9847248, 0.9851, 0.98546, 0.9858072, 0.9861424, 0.9864608,
+      0.9868072, 0.9871388, 0.9874452, 0.9877564, 0.988064, 0.98837, 0.9886744,
+      0.9889424, 0.9891912, 0.9894464, 0.9896928, 0.989938, 0.9901796, 0.990418,
+      0.9906376, 0.9908648, 0.9910864, 0.9913116, 0.9915132, 0.9917076,
+      0.9919004, 0.992092, 0.9922952, 0.9924716, 0.992658, 0.9928372, 0.9930076,
+      0.9931812, 0.99334, 0.9934928, 0.9936508, 0.9937824, 0.9939404, 0.9940844,
+      0.994228, 0.9943608, 0.9944828, 0.9946176, 0.9947428, 0.9948784,
+      0.9950076, 0.9951264, 0.9952424, 0.9953728, 0.9954844, 0.995582,
+      0.9956772, 0.9957844, 0.9958804, 0.9959808, 0.9960752, 0.9961564,
+      0.9962436, 0.9963252, 0.9964088, 0.9964988, 0.996584, 0.9966612,
+      0.9967388, 0.996814, 0.9968808, 0.9969536, 0.997032, 0.9971096, 0.997182,
+      0.9972388, 0.9972992, 0.9973576, 0.9974148, 0.9974656, 0.9975344,
+      0.9975784, 0.9976368, 0.9976904, 0.997744, 0.9977916, 0.9978324, 0.997878,
+      0.9979308, 0.9979768, 0.9980208, 0.9980612, 0.998098, 0.9981392,
+      0.9981788, 0.9982252, 0.9982672, 0.9983048, 0.9983384, 0.9983752,
+      0.9984116, 0.9984416, 0.9984752, 0.9985108, 0.9985456, 0.9985784,
+      0.998606, 0.998632, 0.9986632, 0.9986968, 0.99873, 0.9987556, 0.998784,
+      0.9988076, 0.9988356, 0.9988576, 0.9988752, 0.9989036, 0.9989316,
+      0.9989528, 0.9989724, 0.998992, 0.999016, 0.9990436, 0.9990636, 0.9990852,
+      0.999102, 0.9991224, 0.9996924, 0.9998952, 1
+   },
+   { // n=49
+      0, 0.0015148, 0.0962164, 0.3088552, 0.5091504, 0.6590996, 0.763644,
+      0.7704724, 0.7771336, 0.7834636, 0.7896012, 0.7955376, 0.8012756,
+      0.8069668, 0.8125328, 0.8178568, 0.823002, 0.8279512, 0.832814, 0.8375208,
+      0.8421644, 0.8465344, 0.8508596, 0.854986, 0.8590576, 0.8630148,
+      0.8667908, 0.8704372, 0.8740404, 0.8775224, 0.8809488, 0.8842484,
+      0.8874196, 0.8904692, 0.8934268, 0.8963656, 0.8991896, 0.901958,
+      0.9046432, 0.9072112, 0.9097092, 0.912202, 0.9145008, 0.916802, 0.919068,
+      0.92122, 0.9233416, 0.9253636, 0.9273592, 0.9292548, 0.9311464, 0.9330024,
+      0.9347676, 0.9364916, 0.9381916, 0.9398184, 0.9413952, 0.9429016,
+      0.9443932, 0.9458408, 0.9472276, 0.9485928, 0.9499792, 0.9512884,
+      0.9525776, 0.953802, 0.9549768, 0.9561292, 0.9572744, 0.958416, 0.9594908,
+      0.960498, 0.9614972, 0.9624868, 0.963444, 0.9644108, 0.9652872, 0.9661364,
+      0.9669764, 0.9678328, 0.968644, 0.9694404, 0.9702056, 0.9709608,
+      0.9716932, 0.9724168, 0.9731364, 0.9738052, 0.9744604, 0.9751012,
+      0.9757364, 0.9763536, 0.9769292, 0.9775056, 0.9780616, 0.9785996,
+      0.9791328, 0.97966, 0.9801716, 0.9806704, 0.9811512, 0.981596, 0.982052,
+      0.9825008, 0.9829324, 0.9833496, 0.9837468, 0.9841656, 0.9845632,
+      0.9849388, 0.9853004, 0.985658, 0.9859788, 0.9863416, 0.9866684,
+      0.9869812, 0.9872792, 0.9875856, 0.9878832, 0.9881728, 0.9884692,
+      0.9887572, 0.989028, 0.9892864, 0.98954, 0.9897856, 0.9900372, 0.9902668,
+      0.9904944, 0.9907272, 0.99093, 0.9911544, 0.9913684, 0.991562, 0.9917744,
+      0.9919668, 0.9921616, 0.9923436, 0.9925196, 0.992706, 0.992864, 0.993036,
+      0.9931932, 0.9933388, 0.9935052, 0.993654, 0.9937932, 0.9939352,
+      0.9940828, 0.994222, 0.9943548, 0.9944884, 0.9946248, 0.9947508,
+      0.9948772, 0.9949872, 0.9950968, 0.9952088, 0.995322, 0.9954228,
+      0.9955304, 0.9956296, 0.9957348, 0.99583, 0.9959276, 0.9960244, 0.9961112,
+      0.9962044, 0.9962912, 0.9963684, 0.9964528, 0.9965264, 0.9965996,
+      0.9966752, 0.996748, 0.99683, 0.9969028, 0.9969668, 0.997038, 0.9970992,
+      0.997172, 0.9972372, 0.9973056, 0.9973668, 0.9974296, 0.9974972,
+      0.9975528, 0.9976144, 0.9976744, 0.9977228, 0.9977728, 0.9978248,
+      0.9978664, 0.9979112, 0.9979596, 0.9980112, 0.998058, 0.9981016,
+      0.9981436, 0.998188, 0.9982312, 0.9982684, 0.9983028, 0.9983384,
+      0.9983824, 0.9984108, 0.998448, 0.9984792, 0.9985124, 0.9985516,
+      0.9985824, 0.9986164, 0.9986452, 0.9986808, 0.9987068, 0.9987368,
+      0.9987716, 0.9987968, 0.99882, 0.9988468, 0.9988732, 0.9989032, 0.998926,
+      0.9989492, 0.9989692, 0.9989912, 0.9990144, 0.9990396, 0.9990636,
+      0.9990792, 0.9990976, 0.9991208, 0.9996964, 0.9998944, 1
+   },
+   { // n=50
+      0, 0.0015716, 0.0960172, 0.3085348, 0.509296, 0.6590692, 0.7634708,
+      0.7701952, 0.7768484, 0.7831456, 0.7892892, 0.79529, 0.801104, 0.8067412,
+      0.8121952, 0.8173944, 0.8224948, 0.8276136, 0.8324676, 0.8371548,
+      0.8417248, 0.846198, 0.8504744, 0.8546332, 0.858634, 0.862566, 0.8663756,
+      0.8700548, 0.873648, 0.8770992, 0.8805084, 0.8838324, 0.887056, 0.890166,
+      0.89315, 0.896104, 0.8989076, 0.9016468, 0.9043, 0.9068792, 0.909426,
+      0.9118796, 0.9142292, 0.9165008, 0.9187244, 0.9208744, 0.9229448,
+      0.925026, 0.9270272, 0.9290084, 0.9308844, 0.932744, 0.9345348, 0.9362656,
+      0.9379412, 0.9395268, 0.9411068, 0.94268, 0.94421, 0.945662, 0.9471328,
+      0.9485172, 0.9498424, 0.9511564, 0.9523728, 0.9536012, 0.9548168,
+      0.955988, 0.9571404, 0.9582504, 0.9593064, 0.9603704, 0.96137, 0.9623612,
+      0.9633356, 0.964264, 0.9652064, 0.966064, 0.9669208, 0.9677596, 0.9685692,
+      0.9693608, 0.9701376, 0.9708884, 0.9716128, 0.9723124, 0.9730136,
+      0.9737156, 0.9743572, 0.9750392, 0.9756868, 0.9763216, 0.9769008,
+      0.9774776, 0.9780468, 0.9785956, 0.9791288, 0.9796248, 0.9801648,
+      0.9806572, 0.98114, 0.981628, 0.982084, 0.98254, 0.9829516, 0.983348,
+      0.9837364, 0.9841376, 0.9845196, 0.9849, 0.9852756, 0.9856404, 0.985986,
+      0.9863228, 0.986666, 0.9870112, 0.9873336, 0.9876432, 0.987944, 0.9882192,
+      0.9885056, 0.9887872, 0.9890616, 0.989328, 0.9895776, 0.9898312,
+      0.9900688, 0.9903164, 0.9905304, 0.9907508, 0.990988, 0.9911872,
+      0.9914084, 0.99162, 0.9918284, 0.9920204, 0.9922192, 0.992412, 0.992584,
+      0.992774, 0.992944, 0.9931196, 0.993284, 0.9934388, 0.993592, 0.9937444,
+      0.9938844, 0.9940468, 0.994174, 0.9943064, 0.994444, 0.9945612, 0.9946844,
+      0.9948112, 0.99492, 0.99503, 0.9951544, 0.9952808, 0.9953904, 0.995504,
+      0.9956108, 0.9957076, 0.9958104, 0.9959108, 0.996004, 0.9961012,
+      0.9961972, 0.9962944, 0.9963724, 0.996462, 0.9965476, 0.9966212, 0.996692,
+      0.9967692, 0.996842, 0.9969168, 0.996982, 0.997052, 0.9971188, 0.997182,
+      0.9972548, 0.9973112, 0.997376, 0.9974356, 0.9974976, 0.9975552,
+      0.9976196, 0.9976772, 0.9977256, 0.997784, 0.9978436, 0.9978916,
+      0.9979392, 0.9979812, 0.9980236, 0.9980668, 0.9981112, 0.9981428,
+      0.9981752, 0.9982156, 0.9982608, 0.9983, 0.9983384, 0.9983736, 0.9984164,
+      0.9984644, 0.9984992, 0.998534, 0.998568, 0.9985968, 0.9986248, 0.9986528,
+      0.9986828, 0.9987072, 0.9987332, 0.9987588, 0.998782, 0.99881, 0.9988332,
+      0.9988576, 0.9988804, 0.998902, 0.9989244, 0.99895, 0.998972, 0.9989936,
+      0.9990252, 0.9990484, 0.9990688, 0.9990888, 0.9991144, 0.999128,
+      0.9997132, 0.9998912, 1
+   },
+   { // n=51
+      0, 0.0015248, 0.0961432, 0.30879, 0.509, 0.6586772, 0.7632536, 0.7699556,
+      0.7765036, 0.7829104, 0.7890964, 0.795134, 0.8008524, 0.8065328,
+      0.8120604, 0.8173916, 0.8225524, 0.827554, 0.8323856, 0.8370892,
+      0.8416412, 0.8460872, 0.8504716, 0.8546624, 0.8587012, 0.8626092,
+      0.866466, 0.8701436, 0.8737784, 0.8773096, 0.8807012, 0.8839776, 0.887138,
+      0.8903, 0.893294, 0.8962392, 0.89905, 0.9017936, 0.9045348, 0.907096,
+      0.9096816, 0.9121552, 0.914546, 0.916822, 0.9191408, 0.92135, 0.9233972,
+      0.9254248, 0.9274328, 0.9293744, 0.9312396, 0.9330672, 0.9348572,
+      0.9365884, 0.938346, 0.939946, 0.9415, 0.9430176, 0.9445184, 0.94595,
+      0.9473884, 0.9487196, 0.950072, 0.9513704, 0.9526088, 0.9538516, 0.955056,
+      0.9562296, 0.957398, 0.9585024, 0.9595468, 0.9605976, 0.9616268, 0.962578,
+      0.9635084, 0.9644184, 0.9653276, 0.9662084, 0.9670656, 0.9679172,
+      0.9687292, 0.96952, 0.9702848, 0.9710448, 0.9717868, 0.9724936, 0.973176,
+      0.9738804, 0.9745764, 0.9752076, 0.9758332, 0.9764408, 0.977028,
+      0.9776092, 0.9781652, 0.9787096, 0.9792476, 0.9797672, 0.9802608,
+      0.9807536, 0.9812324, 0.9817152, 0.9821992, 0.9826188, 0.9830484,
+      0.9834548, 0.9838452, 0.9842552, 0.9846592, 0.9850292, 0.9854004,
+      0.985756, 0.9861032, 0.9864484, 0.986764, 0.9870684, 0.9873816, 0.9876944,
+      0.987996, 0.9883016, 0.9885864, 0.9888636, 0.98913, 0.9893972, 0.9896688,
+      0.9899112, 0.9901528, 0.9904056, 0.990628, 0.990854, 0.9910684, 0.991272,
+      0.9914728, 0.9916552, 0.9918636, 0.992048, 0.9922324, 0.99242, 0.9926164,
+      0.9927912, 0.9929692, 0.9931412, 0.9932936, 0.993448, 0.993602, 0.993752,
+      0.9938944, 0.9940244, 0.994158, 0.9942968, 0.99443, 0.9945592, 0.9946956,
+      0.9948168, 0.9949524, 0.9950772, 0.9951988, 0.995304, 0.995424, 0.9955304,
+      0.9956292, 0.9957324, 0.995836, 0.995936, 0.99603, 0.9961068, 0.9961952,
+      0.9962744, 0.9963548, 0.9964344, 0.9965116, 0.9965876, 0.9966628,
+      0.996744, 0.99682, 0.996884, 0.9969536, 0.9970152, 0.9970816, 0.9971484,
+      0.997216, 0.997276, 0.9973364, 0.9973964, 0.9974528, 0.9975052, 0.9975604,
+      0.9976144, 0.9976716, 0.9977248, 0.99778, 0.9978328, 0.9978832, 0.9979296,
+      0.9979684, 0.998006, 0.9980532, 0.9980932, 0.9981348, 0.9981824,
+      0.9982248, 0.9982628, 0.9983024, 0.9983484, 0.9983856, 0.998426,
+      0.9984572, 0.9984876, 0.9985204, 0.9985564, 0.9985896, 0.9986176,
+      0.998654, 0.9986808, 0.9987084, 0.9987292, 0.998764, 0.998796, 0.998822,
+      0.9988524, 0.9988776, 0.9989032, 0.9989272, 0.9989508, 0.9989748,
+      0.9989968, 0.9990204, 0.9990404, 0.9990648, 0.9990832, 0.9991052,
+      0.999124, 0.9996936, 0.999888, 1
+   },
+   { // n=52
+      0, 0.0015784, 0.0960684, 0.3085044, 0.5088728, 0.6585776, 0.7632656,
+      0.7700188, 0.7766028, 0.7829168, 0.7891484, 0.795192, 0.8010556,
+      0.8067056, 0.8122388, 0.817548, 0.8227124, 0.8276928, 0.8326288, 0.837328,
+      0.841878, 0.8463776, 0.8506196, 0.8547528, 0.8587868, 0.8626984,
+      0.8664656, 0.8701616, 0.8737844, 0.8772664, 0.880628, 0.8839184,
+      0.8870692, 0.890162, 0.8931784, 0.8961076, 0.89891, 0.901684, 0.9043984,
+      0.9070296, 0.9096192, 0.9120552, 0.9144128, 0.916734, 0.9189572, 0.92114,
+      0.9232644, 0.925268, 0.9272704, 0.9292048, 0.931092, 0.9329592, 0.9347544,
+      0.9365008, 0.9381748, 0.9398364, 0.9413996, 0.9429636, 0.9444644,
+      0.9459188, 0.9473168, 0.9486988, 0.9500508, 0.9513448, 0.9526296,
+      0.9538652, 0.9550248, 0.9561968, 0.9573264, 0.9584124, 0.9594672,
+      0.9605284, 0.9615632, 0.962564, 0.9634988, 0.964436, 0.96532, 0.9662128,
+      0.9670516, 0.967902, 0.9686968, 0.9694808, 0.9702516, 0.9709876,
+      0.9717184, 0.9724596, 0.973184, 0.9738876, 0.9745592, 0.9751928,
+      0.9758196, 0.9764328, 0.9770156, 0.9776128, 0.9781544, 0.9786932,
+      0.9792224, 0.9797328, 0.9802644, 0.980784, 0.9812436, 0.9817028, 0.98215,
+      0.9825896, 0.9830228, 0.983418, 0.9838156, 0.9841964, 0.984596, 0.9849784,
+      0.9853552, 0.9857256, 0.9860732, 0.9864064, 0.9867408, 0.987076, 0.987392,
+      0.9876956, 0.9880016, 0.9882976, 0.9885764, 0.988842, 0.9891064,
+      0.9893624, 0.9896128, 0.989858, 0.9901116, 0.9903616, 0.9905864,
+      0.9908156, 0.9910376, 0.9912772, 0.9915092, 0.9917164, 0.9918948,
+      0.9920828, 0.9922704, 0.9924556, 0.9926448, 0.9928144, 0.9929736,
+      0.9931416, 0.9933052, 0.9934712, 0.993614, 0.9937704, 0.9939116, 0.994052,
+      0.9941964, 0.99435, 0.9944816, 0.994604, 0.99474, 0.9948516, 0.9949724,
+      0.9950892, 0.9952084, 0.9953172, 0.9954412, 0.9955424, 0.9956524,
+      0.9957372, 0.9958368, 0.9959344, 0.9960368, 0.9961376, 0.9962256,
+      0.9963112, 0.9963968, 0.9964804, 0.9965624, 0.9966408, 0.9967132,
+      0.9967888, 0.9968544, 0.9969252, 0.9970004, 0.9970704, 0.997146,
+      0.9972108, 0.9972676, 0.9973276, 0.9973892, 0.9974492, 0.997508, 0.997562,
+      0.9976096, 0.9976688, 0.9977172, 0.9977796, 0.9978352, 0.9978796,
+      0.997924, 0.9979708, 0.9980124, 0.998054, 0.9981024, 0.9981432, 0.9981828,
+      0.998216, 0.9982488, 0.998294, 0.9983388, 0.9983756, 0.9984184, 0.9984536,
+      0.998492, 0.9985256, 0.998556, 0.9985932, 0.9986204, 0.998656, 0.998686,
+      0.9987124, 0.99874, 0.9987684, 0.9987924, 0.9988212, 0.998848, 0.9988768,
+      0.9989, 0.9989216, 0.9989432, 0.9989664, 0.99899, 0.9990124, 0.9990368,
+      0.9990588, 0.9990784, 0.9991, 0.9991168, 0.999134, 0.9997164, 0.9999072,
+      1
+   },
+   { // n=53
+      0, 0.0015476, 0.0960212, 0.3081456, 0.5086668, 0.658652, 0.7628416,
+      0.7695808, 0.776104, 0.7825824, 0.7888828, 0.7948852, 0.8006608,
+      0.8063156, 0.8117876, 0.8171836, 0.8223732, 0.8273636, 0.8322276,
+      0.836848, 0.8413768, 0.8458268, 0.8501264, 0.8543152, 0.8583804, 0.86233,
+      0.8660972, 0.8698508, 0.873414, 0.8768804, 0.8803256, 0.8836172,
+      0.8868124, 0.8898892, 0.8929336, 0.8958636, 0.8987232, 0.901504,
+      0.9041808, 0.9068084, 0.9093544, 0.911824, 0.9141644, 0.9164928,
+      0.9187204, 0.920868, 0.922946, 0.9250112, 0.9270104, 0.9289208, 0.930868,
+      0.9326788, 0.934516, 0.9362248, 0.9378904, 0.939492, 0.9410604, 0.9426228,
+      0.9440724, 0.945542, 0.9470044, 0.9484172, 0.9497536, 0.9510524,
+      0.9523168, 0.9535212, 0.9547108, 0.9558896, 0.9570216, 0.9581108,
+      0.9592016, 0.960266, 0.9612952, 0.9622916, 0.9632468, 0.9642148,
+      0.9651052, 0.9659972, 0.96688, 0.96774, 0.9685804, 0.9694016, 0.9701436,
+      0.9708904, 0.9716332, 0.972364, 0.9730484, 0.9737748, 0.974424, 0.9750288,
+      0.9756592, 0.9762276, 0.976816, 0.9773704, 0.9779468, 0.9784844,
+      0.9790012, 0.9795444, 0.980054, 0.9805472, 0.9810388, 0.9815052,
+      0.9819424, 0.9823944, 0.9828216, 0.9832544, 0.9836836, 0.9840568,
+      0.9844372, 0.9848308, 0.9852172, 0.9855768, 0.9859108, 0.9862652,
+      0.9866064, 0.9869076, 0.9872252, 0.9875152, 0.9878072, 0.9880868,
+      0.9883584, 0.988646, 0.9889208, 0.9891916, 0.9894652, 0.9897196,
+      0.9899804, 0.99023, 0.9904568, 0.9906896, 0.9909204, 0.9911364, 0.9913512,
+      0.9915552, 0.9917572, 0.9919556, 0.9921444, 0.9923344, 0.9925276,
+      0.9927052, 0.9928812, 0.9930364, 0.993202, 0.9933516, 0.9935148,
+      0.9936632, 0.9938084, 0.993946, 0.9940952, 0.9942392, 0.9943772,
+      0.9945096, 0.994632, 0.9947548, 0.9948764, 0.994996, 0.9951204, 0.9952304,
+      0.9953276, 0.9954416, 0.9955496, 0.9956576, 0.9957608, 0.99587, 0.9959712,
+      0.9960696, 0.9961544, 0.9962432, 0.9963288, 0.9964128, 0.9964936,
+      0.9965676, 0.996646, 0.9967196, 0.996794, 0.9968632, 0.9969372, 0.99701,
+      0.997078, 0.997142, 0.9972112, 0.9972772, 0.9973416, 0.9973976, 0.9974636,
+      0.997518, 0.9975732, 0.9976268, 0.9976744, 0.9977208, 0.997772, 0.9978268,
+      0.9978776, 0.99792, 0.9979644, 0.9980084, 0.9980516, 0.9980964, 0.9981356,
+      0.998178, 0.9982152, 0.9982568, 0.9982956, 0.9983328, 0.9983692,
+      0.9983956, 0.9984304, 0.998466, 0.9984976, 0.998536, 0.9985672, 0.9985972,
+      0.9986236, 0.9986584, 0.998682, 0.9987028, 0.9987324, 0.9987592,
+      0.9987848, 0.9988104, 0.9988336, 0.99886, 0.9988844, 0.9989076, 0.9989368,
+      0.9989552, 0.9989832, 0.999006, 0.9990304, 0.9990516, 0.9990652,
+      0.9990836, 0.999684, 0.9998872, 1
+   },
+   { // n=54
+      0, 0.0015336, 0.0961128, 0.3085388, 0.5088536, 0.65848, 0.7625464,
+      0.7693972, 0.7759824, 0.7823324, 0.7884748, 0.7944348, 0.800242,
+      0.8058652, 0.811504, 0.8167836, 0.8219308, 0.8268836, 0.8317796,
+      0.8363996, 0.8410152, 0.8455028, 0.8498204, 0.8539704, 0.8580404,
+      0.861968, 0.8657988, 0.869502, 0.8731048, 0.8766568, 0.8800488, 0.8833476,
+      0.8865676, 0.8896724, 0.892658, 0.8955948, 0.8984552, 0.9012268,
+      0.9038756, 0.9064572, 0.9089616, 0.9114048, 0.913778, 0.9161056,
+      0.9183144, 0.9205164, 0.9226252, 0.924654, 0.926682, 0.9286424, 0.9305704,
+      0.9324484, 0.9342052, 0.93595, 0.937616, 0.9392312, 0.9408624, 0.94241,
+      0.9439248, 0.9454224, 0.9468312, 0.9482232, 0.9496124, 0.9509456,
+      0.9522204, 0.9534904, 0.9546792, 0.955854, 0.9570124, 0.9581348,
+      0.9592212, 0.9602424, 0.9612772, 0.9622928, 0.9632552, 0.964196, 0.965124,
+      0.9660324, 0.966912, 0.9677564, 0.9685776, 0.9693372, 0.9701, 0.9708724,
+      0.97159, 0.9723256, 0.9730212, 0.9737052, 0.974368, 0.97503, 0.9756444,
+      0.9762788, 0.976866, 0.9774356, 0.9779836, 0.9784912, 0.9790096,
+      0.9795376, 0.9800416, 0.9805572, 0.9810292, 0.9815168, 0.9819764,
+      0.9824332, 0.9828632, 0.9832748, 0.9837076, 0.9841096, 0.9844988,
+      0.9848788, 0.9852528, 0.9856, 0.9859524, 0.9862992, 0.9866348, 0.9869756,
+      0.9872768, 0.9875924, 0.987886, 0.9881664, 0.9884364, 0.9887172, 0.989,
+      0.9892676, 0.9895196, 0.9897792, 0.9900132, 0.9902612, 0.990496,
+      0.9907312, 0.990968, 0.9911864, 0.991398, 0.9916012, 0.9918008, 0.9919852,
+      0.9921688, 0.9923456, 0.9925396, 0.992706, 0.992884, 0.9930652, 0.9932276,
+      0.9934044, 0.993572, 0.9937188, 0.9938756, 0.9940188, 0.9941704,
+      0.9943036, 0.9944352, 0.9945712, 0.9946904, 0.9948064, 0.9949248, 0.99503,
+      0.9951372, 0.9952432, 0.9953668, 0.9954784, 0.995578, 0.9956916, 0.995798,
+      0.9959068, 0.9960036, 0.9960916, 0.9961804, 0.9962624, 0.9963332,
+      0.996412, 0.9964872, 0.9965648, 0.996646, 0.9967256, 0.9968052, 0.9968716,
+      0.9969404, 0.997, 0.9970628, 0.9971264, 0.9971932, 0.9972588, 0.9973292,
+      0.9973904, 0.9974432, 0.9974884, 0.9975516, 0.9976044, 0.9976612,
+      0.9977128, 0.9977668, 0.99782, 0.997872, 0.9979172, 0.9979684, 0.9980156,
+      0.9980596, 0.9981024, 0.9981508, 0.9981916, 0.9982308, 0.9982724,
+      0.9983056, 0.99834, 0.9983736, 0.9984076, 0.998444, 0.9984832, 0.9985172,
+      0.99855, 0.9985724, 0.9986072, 0.998638, 0.998664, 0.9987004, 0.9987268,
+      0.9987584, 0.9987852, 0.9988156, 0.99884, 0.9988724, 0.9988948, 0.9989148,
+      0.9989324, 0.9989552, 0.9989788, 0.9989996, 0.9990212, 0.9990404,
+      0.9990624, 0.9990816, 0.9990968, 0.9996948, 0.99988, 1
+   },
+   { // n=55
+      0, 0.0015352, 0.096132, 0.3083204, 0.5084352, 0.658536, 0.7628132,
+      0.7696092, 0.7762408, 0.78262, 0.7888064, 0.7948708, 0.8007336, 0.80645,
+      0.8120128, 0.8172808, 0.8224252, 0.8274048, 0.8322468, 0.8369368,
+      0.8415236, 0.8459796, 0.8502676, 0.85436, 0.8583864, 0.8623168, 0.8661572,
+      0.8698724, 0.873488, 0.8770412, 0.880404, 0.883658, 0.886848, 0.8898972,
+      0.892874, 0.8957392, 0.8986068, 0.9013572, 0.9039976, 0.9066012, 0.909114,
+      0.911592, 0.9139828, 0.9163344, 0.9185652, 0.9207132, 0.9228096,
+      0.9248768, 0.9268908, 0.9288272, 0.9307012, 0.9325212, 0.9343068,
+      0.9360236, 0.9377376, 0.9393468, 0.9409992, 0.9425864, 0.9440652,
+      0.9455084, 0.946934, 0.94833, 0.949652, 0.9508996, 0.9521624, 0.9534532,
+      0.9546348, 0.9558152, 0.9569068, 0.9580308, 0.9591172, 0.9601992, 0.96121,
+      0.9622392, 0.9632216, 0.9641672, 0.965082, 0.9659988, 0.96687, 0.9677172,
+      0.968544, 0.9693272, 0.9701312, 0.9708848, 0.9716024, 0.9723272, 0.973034,
+      0.9737244, 0.9744016, 0.975048, 0.9756664, 0.976268, 0.9768644, 0.977444,
+      0.978028, 0.9785716, 0.9790904, 0.9796012, 0.9801148, 0.9805952,
+      0.9810708, 0.9815584, 0.982016, 0.9824604, 0.9829116, 0.9833404,
+      0.9837352, 0.9841164, 0.9844888, 0.9848508, 0.985238, 0.9856164,
+      0.9859804, 0.9863452, 0.9866832, 0.9870072, 0.9873348, 0.987664, 0.987968,
+      0.988272, 0.9885416, 0.9888116, 0.98906, 0.989324, 0.9895788, 0.9898444,
+      0.9900964, 0.9903392, 0.9905632, 0.99079, 0.991004, 0.991212, 0.9914212,
+      0.9916212, 0.9918196, 0.9920048, 0.9921916, 0.9923864, 0.9925764,
+      0.9927516, 0.9929248, 0.993096, 0.9932476, 0.9934132, 0.9935772,
+      0.9937412, 0.9938888, 0.9940396, 0.9941876, 0.9943172, 0.9944448,
+      0.9945828, 0.9947216, 0.9948532, 0.9949768, 0.9951044, 0.995214,
+      0.9953204, 0.9954416, 0.9955492, 0.9956508, 0.9957468, 0.9958628,
+      0.9959532, 0.9960492, 0.9961472, 0.9962252, 0.9963072, 0.9963944,
+      0.996466, 0.9965548, 0.9966296, 0.9967112, 0.9967916, 0.9968652, 0.99694,
+      0.9970004, 0.9970712, 0.9971336, 0.9971948, 0.9972592, 0.9973164,
+      0.9973684, 0.997422, 0.9974732, 0.997532, 0.9975848, 0.9976384, 0.9977012,
+      0.9977488, 0.997796, 0.9978484, 0.9978944, 0.997942, 0.9979844, 0.9980276,
+      0.9980752, 0.9981188, 0.9981572, 0.9982, 0.9982388, 0.9982748, 0.99831,
+      0.9983464, 0.9983852, 0.9984212, 0.9984496, 0.9984856, 0.998524,
+      0.9985548, 0.9985864, 0.9986176, 0.9986476, 0.9986808, 0.998706,
+      0.9987356, 0.9987668, 0.9987908, 0.998814, 0.9988364, 0.9988584,
+      0.9988848, 0.9989068, 0.9989304, 0.998952, 0.9989716, 0.9989936,
+      0.9990136, 0.9990316, 0.9990516, 0.9990684, 0.999084, 0.9996784, 0.99988,
+      1
+   },
+   { // n=56
+      0, 0.0015436, 0.0960988, 0.3083852, 0.5090412, 0.6585372, 0.7628844,
+      0.7696268, 0.776262, 0.782594, 0.7887732, 0.7947916, 0.8007472, 0.806358,
+      0.81182, 0.8171388, 0.8223932, 0.8273384, 0.8321488, 0.83692, 0.8414528,
+      0.8458772, 0.8501556, 0.8542884, 0.8583116, 0.8623112, 0.8661016,
+      0.8698164, 0.873414, 0.876918, 0.8803076, 0.8835936, 0.8868132, 0.8899072,
+      0.8928516, 0.895736, 0.898586, 0.9013132, 0.9040356, 0.9066528, 0.909192,
+      0.9116096, 0.9139732, 0.9162864, 0.9185692, 0.9207596, 0.92295, 0.925056,
+      0.9270568, 0.9289992, 0.930906, 0.9327488, 0.9345624, 0.9362808,
+      0.9379328, 0.939544, 0.9411508, 0.942678, 0.9441916, 0.9456816, 0.9470808,
+      0.9484684, 0.9498184, 0.951112, 0.952348, 0.953588, 0.9547624, 0.9559256,
+      0.9570704, 0.9581552, 0.9592616, 0.9603064, 0.961314, 0.9623444,
+      0.9633264, 0.9642584, 0.9651764, 0.9660648, 0.96693, 0.9677532, 0.9685676,
+      0.969364, 0.9701464, 0.9708628, 0.9716044, 0.9723368, 0.9730276, 0.973702,
+      0.9743576, 0.9749808, 0.9755924, 0.9762124, 0.9768296, 0.9774252,
+      0.9779952, 0.9785468, 0.979098, 0.979638, 0.980166, 0.9806636, 0.9811152,
+      0.981576, 0.9820352, 0.9824632, 0.9829184, 0.9833412, 0.9837452,
+      0.9841536, 0.9845496, 0.984934, 0.9853084, 0.9856736, 0.9860324, 0.986352,
+      0.9866984, 0.9870244, 0.9873424, 0.9876428, 0.9879348, 0.988226, 0.988504,
+      0.9887772, 0.9890496, 0.9893028, 0.9895512, 0.9897924, 0.9900176,
+      0.9902476, 0.9904796, 0.990708, 0.9909364, 0.9911416, 0.9913484,
+      0.9915604, 0.9917732, 0.9919728, 0.9921596, 0.9923508, 0.99252, 0.9927004,
+      0.99287, 0.9930384, 0.9932168, 0.9933664, 0.9935376, 0.9936916, 0.9938336,
+      0.9939856, 0.9941352, 0.994282, 0.9944144, 0.99455, 0.9946708, 0.994798,
+      0.9949224, 0.995042, 0.9951592, 0.9952552, 0.9953752, 0.995496, 0.9956012,
+      0.9957164, 0.9958228, 0.9959152, 0.9960084, 0.9961088, 0.9962056,
+      0.9962964, 0.9963832, 0.9964652, 0.9965476, 0.996626, 0.996708, 0.9967804,
+      0.9968476, 0.9969216, 0.9969872, 0.9970588, 0.997126, 0.997202, 0.9972664,
+      0.9973252, 0.9973888, 0.9974388, 0.99749, 0.9975524, 0.9976108, 0.9976576,
+      0.997712, 0.9977612, 0.9978096, 0.997864, 0.9979204, 0.9979632, 0.9980112,
+      0.9980664, 0.9981128, 0.9981544, 0.9981964, 0.9982352, 0.9982736,
+      0.9983076, 0.9983476, 0.9983876, 0.9984268, 0.9984596, 0.9984936,
+      0.9985224, 0.9985716, 0.9986044, 0.9986324, 0.998664, 0.9986976,
+      0.9987252, 0.9987512, 0.9987808, 0.9988056, 0.9988328, 0.9988524,
+      0.998878, 0.9989036, 0.9989248, 0.9989436, 0.9989672, 0.9989912,
+      0.9990132, 0.9990348, 0.9990556, 0.99908, 0.9990964, 0.9991156, 0.9991384,
+      0.99971, 0.9998972, 1
+   },
+   { // n=57
+      0, 0.0015176, 0.0961284, 0.3083884, 0.5087188, 0.6585924, 0.762896,
+      0.7696504, 0.7762332, 0.7825324, 0.7886744, 0.79474, 0.8006128, 0.8063052,
+      0.8118272, 0.8171808, 0.8222992, 0.8273324, 0.832222, 0.8368736,
+      0.8414724, 0.845942, 0.8501992, 0.8544532, 0.858522, 0.86248, 0.8662432,
+      0.8699424, 0.8735908, 0.8770364, 0.8804472, 0.8837664, 0.8869432,
+      0.8900416, 0.893046, 0.8959964, 0.89884, 0.9015512, 0.9042048, 0.9067884,
+      0.9093092, 0.911738, 0.9141252, 0.9164196, 0.9186664, 0.9208184,
+      0.9229544, 0.9249732, 0.9269692, 0.9288884, 0.930788, 0.9326056, 0.934378,
+      0.9361088, 0.9377556, 0.9394264, 0.9409876, 0.9425192, 0.9440092,
+      0.9454724, 0.946892, 0.9483048, 0.9496792, 0.9510168, 0.9522104, 0.953444,
+      0.9546464, 0.9558684, 0.9570112, 0.9581176, 0.9592016, 0.9602244,
+      0.9612108, 0.9621992, 0.9631736, 0.9641124, 0.9650592, 0.9659728,
+      0.9668652, 0.9677244, 0.9685796, 0.9694084, 0.9701876, 0.9709436,
+      0.9716424, 0.972366, 0.9730828, 0.9737456, 0.9744112, 0.97506, 0.9756768,
+      0.9762744, 0.9769076, 0.9774748, 0.978012, 0.978554, 0.9791184, 0.9796328,
+      0.980148, 0.9806276, 0.981114, 0.9815864, 0.9820288, 0.9824404, 0.98287,
+      0.9832844, 0.9836924, 0.984102, 0.9845032, 0.9848804, 0.9852644,
+      0.9856384, 0.9860064, 0.9863348, 0.9866692, 0.987008, 0.9873252,
+      0.9876184, 0.9879364, 0.9882328, 0.9885228, 0.9887916, 0.9890584,
+      0.9893248, 0.9895884, 0.989818, 0.9900608, 0.9903248, 0.99056, 0.990792,
+      0.9910244, 0.9912348, 0.991448, 0.9916448, 0.9918352, 0.992022, 0.992226,
+      0.9924068, 0.9925988, 0.9927752, 0.9929376, 0.9931004, 0.9932516,
+      0.9934156, 0.9935628, 0.993712, 0.9938508, 0.9939944, 0.994132, 0.9942784,
+      0.994414, 0.9945488, 0.9946828, 0.9948152, 0.9949356, 0.9950448,
+      0.9951724, 0.9952852, 0.9953916, 0.9955044, 0.995606, 0.9957048,
+      0.9958032, 0.9958932, 0.9959872, 0.9960796, 0.9961752, 0.9962524,
+      0.9963344, 0.996414, 0.9964884, 0.9965712, 0.9966492, 0.9967332,
+      0.9968092, 0.9968808, 0.9969556, 0.9970268, 0.9970976, 0.99716, 0.9972268,
+      0.9972904, 0.9973564, 0.9974228, 0.9974808, 0.9975348, 0.9975868,
+      0.997646, 0.997696, 0.9977468, 0.9977956, 0.9978408, 0.9978936, 0.9979432,
+      0.9979868, 0.9980316, 0.9980728, 0.9981196, 0.9981632, 0.9982052,
+      0.9982424, 0.9982844, 0.9983256, 0.9983572, 0.9983944, 0.998426,
+      0.9984656, 0.9985016, 0.9985332, 0.998568, 0.9986048, 0.9986356, 0.99866,
+      0.9986868, 0.9987172, 0.9987484, 0.998778, 0.9988084, 0.9988308,
+      0.9988504, 0.9988808, 0.9989064, 0.9989284, 0.9989572, 0.9989772,
+      0.9989984, 0.9990172, 0.9990328, 0.9990532, 0.9990724, 0.9990904,
+      0.9991088, 0.9997012, 0.9999016, 1
+   },
+   { // n=58
+      0, 0.0015704, 0.0960744, 0.3085444, 0.5092636, 0.6586308, 0.7630372,
+      0.76978, 0.776474, 0.7828572, 0.7890036, 0.7950792, 0.8008232, 0.8064448,
+      0.8119416, 0.8171348, 0.8223616, 0.8273844, 0.8322004, 0.836928,
+      0.8414688, 0.845862, 0.850172, 0.8543708, 0.8584308, 0.8623908, 0.8661792,
+      0.8698796, 0.873496, 0.8769528, 0.8803484, 0.8835984, 0.8867972, 0.889888,
+      0.892904, 0.8958188, 0.89866, 0.9013796, 0.903994, 0.9065948, 0.9091596,
+      0.9116084, 0.9139784, 0.9163368, 0.9185556, 0.9207424, 0.9228816,
+      0.9249648, 0.9269364, 0.9288644, 0.9307788, 0.9326264, 0.9344128,
+      0.9361504, 0.9377984, 0.9394344, 0.9410092, 0.9425768, 0.9440696,
+      0.9455388, 0.9470044, 0.9483628, 0.9497272, 0.9510448, 0.9523036,
+      0.9535196, 0.9547008, 0.9558868, 0.95701, 0.9580948, 0.9591564, 0.9601784,
+      0.9612, 0.96222, 0.9631632, 0.9641344, 0.965028, 0.9659188, 0.9667804,
+      0.9675996, 0.9684388, 0.9692184, 0.9699964, 0.970774, 0.9715024,
+      0.9722428, 0.9729272, 0.9735944, 0.9742784, 0.9749264, 0.9755432,
+      0.9761472, 0.9767548, 0.9773452, 0.9778872, 0.978448, 0.9790072,
+      0.9795168, 0.980044, 0.98056, 0.9810308, 0.9815184, 0.9819544, 0.9824076,
+      0.9828448, 0.9832608, 0.9836552, 0.9840684, 0.9844484, 0.9848312,
+      0.9852048, 0.9855736, 0.9859312, 0.9862844, 0.986626, 0.9869484,
+      0.9872892, 0.9875808, 0.9878696, 0.9881784, 0.9884672, 0.9887452, 0.98902,
+      0.989266, 0.9895192, 0.98977, 0.9900176, 0.990266, 0.9905072, 0.9907456,
+      0.9909512, 0.991172, 0.9913772, 0.9915796, 0.9917692, 0.991954, 0.99214,
+      0.9923252, 0.9924964, 0.9926704, 0.992842, 0.993018, 0.99319, 0.9933592,
+      0.993502, 0.9936624, 0.9938216, 0.9939584, 0.994088, 0.994234, 0.9943636,
+      0.9945036, 0.99465, 0.9947716, 0.994892, 0.9950012, 0.9951308, 0.9952436,
+      0.9953432, 0.995456, 0.9955436, 0.9956388, 0.9957432, 0.9958348,
+      0.9959388, 0.996028, 0.9961228, 0.9962084, 0.996304, 0.9963804, 0.9964524,
+      0.996536, 0.9966324, 0.9967136, 0.996786, 0.9968668, 0.9969428, 0.9970228,
+      0.997096, 0.9971684, 0.9972352, 0.9972988, 0.997358, 0.997418, 0.997474,
+      0.9975276, 0.9975856, 0.9976416, 0.997698, 0.9977548, 0.9978052,
+      0.9978616, 0.9979072, 0.9979548, 0.9980024, 0.99804, 0.9980852, 0.9981288,
+      0.9981768, 0.9982204, 0.9982512, 0.9982948, 0.9983316, 0.9983728,
+      0.9984032, 0.9984364, 0.9984752, 0.9985152, 0.9985504, 0.9985824,
+      0.9986168, 0.9986552, 0.9986804, 0.9987084, 0.9987392, 0.998768,
+      0.9987872, 0.998822, 0.998848, 0.998878, 0.9989016, 0.9989272, 0.9989508,
+      0.9989772, 0.9989956, 0.999016, 0.9990332, 0.9990528, 0.999074, 0.999096,
+      0.9991156, 0.999134, 0.9997024, 0.99989, 1
+   },
+   { // n=59
+      0, 0.0015416, 0.0956432, 0.3079244, 0.5085672, 0.6582464, 0.7626208,
+      0.769374, 0.7758, 0.7821972, 0.7883332, 0.7943596, 0.8002596, 0.8059612,
+      0.8114632, 0.8168164, 0.8219668, 0.8269792, 0.8317832, 0.8364912,
+      0.841074, 0.8454452, 0.8497792, 0.8540324, 0.8581272, 0.8620904,
+      0.8659444, 0.8696544, 0.8732556, 0.8767052, 0.8801112, 0.8834148,
+      0.8865596, 0.8897196, 0.8926984, 0.8956396, 0.898456, 0.9012388,
+      0.9039036, 0.9064912, 0.9090424, 0.9114736, 0.9138236, 0.9160816,
+      0.9183732, 0.9205856, 0.9226888, 0.9247504, 0.9267988, 0.9287124,
+      0.930568, 0.9324004, 0.934228, 0.936014, 0.9377228, 0.9393892, 0.9409804,
+      0.9424992, 0.944016, 0.9454564, 0.9468888, 0.9482828, 0.9496464,
+      0.9509412, 0.9521908, 0.9534348, 0.9546668, 0.9558216, 0.9569504,
+      0.9580824, 0.9591496, 0.9601852, 0.9612352, 0.9622572, 0.9632532,
+      0.9641684, 0.965092, 0.9660056, 0.9668556, 0.9676936, 0.9685188,
+      0.9693216, 0.9701072, 0.9708756, 0.9715896, 0.9723028, 0.9729996,
+      0.9736972, 0.9743648, 0.9750172, 0.9756196, 0.9762164, 0.976814,
+      0.9773908, 0.9779864, 0.9785476, 0.9791064, 0.9796416, 0.980146,
+      0.9806468, 0.9810944, 0.9815684, 0.9820152, 0.98245, 0.9828956, 0.98333,
+      0.9837248, 0.9841244, 0.9845032, 0.9848752, 0.9852328, 0.985596,
+      0.9859464, 0.9863048, 0.9866472, 0.986976, 0.987288, 0.9876172, 0.987928,
+      0.9882208, 0.9885096, 0.9887712, 0.9890552, 0.9893136, 0.9895596,
+      0.989806, 0.9900516, 0.9902804, 0.9905096, 0.9907396, 0.990954, 0.9911748,
+      0.9913876, 0.99159, 0.991792, 0.9919956, 0.9921764, 0.9923564, 0.9925324,
+      0.9927028, 0.9928764, 0.9930528, 0.9932224, 0.9933876, 0.9935436,
+      0.9936976, 0.9938444, 0.9939936, 0.9941416, 0.9942724, 0.9944036,
+      0.9945232, 0.99465, 0.99478, 0.9948908, 0.9950224, 0.9951416, 0.9952584,
+      0.9953732, 0.995478, 0.9955768, 0.995684, 0.9957808, 0.9958656, 0.9959636,
+      0.9960564, 0.9961532, 0.9962396, 0.99632, 0.9964004, 0.9964888, 0.9965744,
+      0.99665, 0.9967308, 0.9968072, 0.9968868, 0.9969564, 0.9970224, 0.9970932,
+      0.9971604, 0.9972336, 0.9972964, 0.9973572, 0.997418, 0.9974784,
+      0.9975364, 0.9975868, 0.9976332, 0.9976872, 0.997738, 0.997788, 0.9978404,
+      0.9978836, 0.9979296, 0.9979816, 0.998024, 0.9980712, 0.998108, 0.9981488,
+      0.9981832, 0.9982288, 0.9982696, 0.9983044, 0.99834, 0.9983856, 0.998422,
+      0.9984492, 0.9984828, 0.998518, 0.9985532, 0.9985856, 0.9986176,
+      0.9986512, 0.9986852, 0.9987108, 0.99874, 0.9987648, 0.9987944, 0.9988176,
+      0.9988496, 0.9988768, 0.9989048, 0.9989304, 0.9989528, 0.9989776,
+      0.9989948, 0.9990188, 0.9990376, 0.9990596, 0.99908, 0.9991032, 0.9991172,
+      0.9996996, 0.9998952, 1
+   },
+   { // n=60
+      0, 0.0015644, 0.095784, 0.3083708, 0.508922, 0.6585796, 0.7632896,
+      0.7699672, 0.7765124, 0.7829008, 0.7890644, 0.7950168, 0.8008812,
+      0.8065828, 0.812052, 0.817266, 0.822454, 0.8274508, 0.8322292, 0.8369744,
+      0.8415244, 0.8459132, 0.8502372, 0.8543924, 0.8584136, 0.8623592,
+      0.866176, 0.8699172, 0.8734688, 0.876976, 0.8803564, 0.883636, 0.8868256,
+      0.8898748, 0.8929088, 0.8957868, 0.8985488, 0.901278, 0.9039112, 0.9065,
+      0.909052, 0.9115016, 0.9139208, 0.9162544, 0.918546, 0.9206852, 0.9228292,
+      0.9248668, 0.9268868, 0.9288272, 0.9306864, 0.9325128, 0.9343224,
+      0.9360468, 0.9377144, 0.9393776, 0.9409504, 0.9424964, 0.9440256,
+      0.9454756, 0.9469084, 0.948272, 0.9496, 0.950906, 0.952136, 0.9533592,
+      0.9545668, 0.9557268, 0.9568776, 0.9579816, 0.9590832, 0.9601052,
+      0.9611416, 0.962128, 0.9631136, 0.964066, 0.96501, 0.9658948, 0.9667424,
+      0.967602, 0.9684424, 0.969258, 0.9700664, 0.970854, 0.9715856, 0.9722816,
+      0.9729792, 0.9736368, 0.9742944, 0.9749324, 0.975534, 0.9761848,
+      0.9767604, 0.977314, 0.9778728, 0.9784216, 0.9789484, 0.9794748, 0.97997,
+      0.9804824, 0.9809628, 0.9814348, 0.9818868, 0.9823192, 0.9827588,
+      0.9831812, 0.9835848, 0.9839816, 0.9843764, 0.9847528, 0.9851452,
+      0.9855136, 0.9858792, 0.9862244, 0.9865476, 0.986878, 0.9871792, 0.987494,
+      0.9877868, 0.9880752, 0.988356, 0.988638, 0.9889168, 0.9891756, 0.9894372,
+      0.9896776, 0.9899364, 0.9901856, 0.9904248, 0.990672, 0.9909168,
+      0.9911404, 0.9913492, 0.9915444, 0.9917568, 0.9919492, 0.9921412,
+      0.9923188, 0.992498, 0.9926792, 0.992854, 0.9930228, 0.9931988, 0.9933464,
+      0.993512, 0.993662, 0.9938004, 0.9939404, 0.9940864, 0.9942244, 0.99436,
+      0.9944904, 0.9946228, 0.9947604, 0.9948796, 0.9950116, 0.9951248,
+      0.995236, 0.9953496, 0.9954604, 0.995572, 0.9956792, 0.9957804, 0.995878,
+      0.9959672, 0.9960624, 0.9961596, 0.9962452, 0.9963396, 0.9964216,
+      0.9965072, 0.9965864, 0.9966588, 0.996732, 0.9968048, 0.9968856,
+      0.9969588, 0.9970268, 0.9970928, 0.9971684, 0.9972416, 0.9973036,
+      0.9973628, 0.9974224, 0.9974756, 0.997528, 0.9975872, 0.9976416,
+      0.9977008, 0.997746, 0.9977996, 0.997846, 0.9978984, 0.9979492, 0.997998,
+      0.9980424, 0.9980924, 0.9981348, 0.998188, 0.9982292, 0.998262, 0.9982996,
+      0.9983396, 0.9983792, 0.9984072, 0.9984396, 0.998476, 0.9985072,
+      0.9985412, 0.9985708, 0.9986072, 0.9986396, 0.9986752, 0.9986996,
+      0.9987256, 0.9987544, 0.9987772, 0.9988012, 0.9988248, 0.9988484,
+      0.9988716, 0.9988892, 0.9989132, 0.9989336, 0.9989552, 0.9989752,
+      0.9990016, 0.9990216, 0.9990444, 0.9990644, 0.9990908, 0.999112,
+      0.9996976, 0.9998944, 1
+   },
+   { // n=61
+      0, 0.0015324, 0.0961736, 0.3081348, 0.5093284, 0.658778, 0.7631432,
+      0.7699432, 0.7765488, 0.7829316, 0.7890892, 0.7949956, 0.8008156,
+      0.8064284, 0.8119152, 0.8172688, 0.8223364, 0.8273176, 0.8321412,
+      0.8368196, 0.8414328, 0.8458428, 0.8501376, 0.854278, 0.8582872,
+      0.8621292, 0.865944, 0.8696384, 0.8732636, 0.876774, 0.8801488, 0.8834552,
+      0.8866556, 0.8897356, 0.8927848, 0.8957112, 0.898572, 0.90135, 0.904026,
+      0.9066208, 0.9091236, 0.9115416, 0.9138812, 0.9162044, 0.9184552,
+      0.9206356, 0.9227548, 0.9248352, 0.9268612, 0.9288448, 0.93074, 0.9326064,
+      0.9344068, 0.9361336, 0.9378548, 0.9394848, 0.9410336, 0.94257, 0.9440856,
+      0.9455552, 0.9470012, 0.9483964, 0.9497404, 0.9510424, 0.9523252,
+      0.9535736, 0.9548032, 0.9559704, 0.95713, 0.9582216, 0.9592844, 0.9602996,
+      0.9612992, 0.962278, 0.9632496, 0.9641904, 0.9650952, 0.9659744,
+      0.9668484, 0.967696, 0.9684968, 0.9692788, 0.970074, 0.9708216, 0.9715428,
+      0.972238, 0.9729388, 0.9736308, 0.9743188, 0.974976, 0.9756352, 0.9762264,
+      0.9768436, 0.9774324, 0.978008, 0.9785752, 0.9790864, 0.979616, 0.9801548,
+      0.980652, 0.9810948, 0.9815688, 0.9820248, 0.9824724, 0.9828996,
+      0.9833308, 0.9837364, 0.9841528, 0.98453, 0.9849028, 0.9852756, 0.985636,
+      0.9860012, 0.9863452, 0.9866868, 0.9870144, 0.9873396, 0.9876772,
+      0.9879652, 0.9882608, 0.9885428, 0.9888188, 0.9890676, 0.9893156,
+      0.9895628, 0.9898096, 0.990074, 0.9903076, 0.9905512, 0.990784, 0.9909984,
+      0.9912036, 0.991424, 0.9916228, 0.9918172, 0.9920156, 0.9922016,
+      0.9923924, 0.9925676, 0.992742, 0.9929212, 0.993092, 0.993258, 0.9934228,
+      0.9935796, 0.9937288, 0.9938724, 0.9940156, 0.9941548, 0.994276,
+      0.9944152, 0.9945548, 0.9946848, 0.9948056, 0.9949156, 0.995038,
+      0.9951544, 0.995266, 0.995378, 0.9954912, 0.9956012, 0.9956996, 0.995798,
+      0.995898, 0.9959992, 0.9960816, 0.9961596, 0.9962552, 0.9963432,
+      0.9964276, 0.9965104, 0.996584, 0.9966608, 0.9967392, 0.996806, 0.9968728,
+      0.9969352, 0.9970072, 0.9970756, 0.9971472, 0.9972108, 0.9972804,
+      0.9973348, 0.9973992, 0.9974552, 0.9975172, 0.9975736, 0.9976288,
+      0.9976816, 0.9977328, 0.9977828, 0.9978272, 0.9978796, 0.9979216,
+      0.997968, 0.998012, 0.998056, 0.9981028, 0.9981424, 0.99818, 0.9982196,
+      0.998266, 0.9983064, 0.9983412, 0.9983772, 0.998414, 0.9984524, 0.9984896,
+      0.9985228, 0.9985592, 0.9985896, 0.9986236, 0.9986576, 0.9986856,
+      0.9987116, 0.9987376, 0.9987648, 0.9987912, 0.9988192, 0.9988416,
+      0.9988624, 0.9988816, 0.9989096, 0.9989328, 0.9989588, 0.998984,
+      0.9990092, 0.9990288, 0.9990512, 0.99907, 0.9990916, 0.99911, 0.9997012,
+      0.9999028, 1
+   },
+   { // n=62
+      0, 0.0016008, 0.096062, 0.308498, 0.5087388, 0.6580736, 0.7624772,
+      0.7692312, 0.7758404, 0.7822824, 0.7884164, 0.7944808, 0.8003528,
+      0.8059984, 0.811524, 0.816926, 0.821954, 0.82699, 0.8318496, 0.8365192,
+      0.8409848, 0.8454092, 0.8497184, 0.853916, 0.857974, 0.8619172, 0.8657252,
+      0.8694528, 0.8730512, 0.876534, 0.8799448, 0.88326, 0.8864892, 0.8896044,
+      0.8926564, 0.8955632, 0.8984164, 0.9011904, 0.9038392, 0.9064744,
+      0.9090016, 0.9114092, 0.9138036, 0.916146, 0.9183876, 0.9205564,
+      0.9226708, 0.9247008, 0.9267132, 0.9286556, 0.9305652, 0.9324104,
+      0.9342432, 0.9359772, 0.9376664, 0.9393324, 0.9409828, 0.9425372,
+      0.9440328, 0.945502, 0.946926, 0.9482832, 0.9496104, 0.9509148, 0.9521856,
+      0.953442, 0.9546244, 0.9557956, 0.9569072, 0.9579828, 0.9590852,
+      0.9601292, 0.9611816, 0.962174, 0.963134, 0.9640624, 0.9650128, 0.9659068,
+      0.9667492, 0.967602, 0.9684344, 0.969234, 0.9700004, 0.9707584, 0.9714844,
+      0.9721904, 0.9728716, 0.9735428, 0.9741944, 0.9748388, 0.9754716,
+      0.9760956, 0.9766736, 0.9772724, 0.9778288, 0.9783976, 0.97892, 0.979442,
+      0.9799476, 0.9804444, 0.9809236, 0.9813916, 0.9818392, 0.98229, 0.9827156,
+      0.9831704, 0.9835808, 0.983978, 0.9843788, 0.9847404, 0.9851344,
+      0.9854948, 0.9858548, 0.9861956, 0.9865188, 0.986858, 0.9871752, 0.987496,
+      0.987782, 0.9880708, 0.9883504, 0.9886312, 0.9888924, 0.9891696,
+      0.9894332, 0.9896848, 0.9899332, 0.9901684, 0.9904128, 0.990646,
+      0.9908736, 0.9910792, 0.99129, 0.9915056, 0.9917072, 0.9918952, 0.9920748,
+      0.9922672, 0.9924488, 0.992614, 0.9927944, 0.9929644, 0.9931476,
+      0.9933008, 0.99346, 0.9935972, 0.9937592, 0.9939104, 0.9940604, 0.9941964,
+      0.9943384, 0.99448, 0.9946088, 0.9947396, 0.9948608, 0.9949852, 0.9951068,
+      0.9952212, 0.9953256, 0.995434, 0.9955376, 0.9956392, 0.995744, 0.9958492,
+      0.9959592, 0.9960516, 0.9961384, 0.9962248, 0.9963136, 0.996406,
+      0.9964888, 0.9965676, 0.9966452, 0.9967356, 0.996804, 0.9968736,
+      0.9969356, 0.9969988, 0.9970744, 0.9971456, 0.99721, 0.9972868, 0.9973408,
+      0.9974036, 0.9974584, 0.997522, 0.9975728, 0.997628, 0.9976824, 0.9977336,
+      0.9977916, 0.9978472, 0.9978976, 0.9979452, 0.9979916, 0.9980396,
+      0.9980848, 0.9981284, 0.9981732, 0.998216, 0.9982528, 0.9982884,
+      0.9983236, 0.9983608, 0.9984012, 0.9984356, 0.9984724, 0.9985072,
+      0.9985392, 0.99857, 0.9986004, 0.99863, 0.998666, 0.9986948, 0.9987244,
+      0.9987552, 0.998786, 0.9988124, 0.998838, 0.9988644, 0.9988916, 0.9989168,
+      0.9989384, 0.9989612, 0.9989868, 0.9990096, 0.9990328, 0.9990536,
+      0.9990732, 0.9990928, 0.9991132, 0.9991292, 0.9997132, 0.9998968, 1
+   },
+   { // n=63
+      0, 0.0015592, 0.0959352, 0.3083956, 0.5093228, 0.65854, 0.7626104,
+      0.769326, 0.7758756, 0.7823464, 0.7885544, 0.7946304, 0.8004748,
+      0.8061548, 0.8116608, 0.81705, 0.822138, 0.8271436, 0.8319944, 0.836754,
+      0.8413264, 0.8457864, 0.850138, 0.8542664, 0.8583468, 0.8622468,
+      0.8660112, 0.869736, 0.8732844, 0.8768144, 0.880248, 0.883568, 0.8867684,
+      0.88984, 0.8929208, 0.895872, 0.8987228, 0.9014588, 0.9041656, 0.9067672,
+      0.9093024, 0.911786, 0.9141172, 0.9164228, 0.9186684, 0.9208388,
+      0.9229204, 0.9249832, 0.9270376, 0.928972, 0.930892, 0.9327564, 0.9345216,
+      0.9362412, 0.937916, 0.9395732, 0.9412212, 0.9427932, 0.9442948,
+      0.9457604, 0.9472064, 0.9485784, 0.949908, 0.9511968, 0.9524848, 0.953734,
+      0.9549728, 0.9561348, 0.9573212, 0.958406, 0.9594784, 0.9605304, 0.96156,
+      0.9625104, 0.9634768, 0.9643712, 0.9653056, 0.966176, 0.9670224,
+      0.9678632, 0.9686772, 0.9694796, 0.9702828, 0.9710276, 0.9717852,
+      0.9724872, 0.9731752, 0.9738368, 0.9744944, 0.9751272, 0.9757528,
+      0.976388, 0.9769636, 0.9775396, 0.9781112, 0.97866, 0.9791864, 0.9797188,
+      0.9802216, 0.9807352, 0.9812132, 0.9816872, 0.9821284, 0.9825636,
+      0.9830172, 0.98344, 0.9838408, 0.9842288, 0.9846352, 0.9850028, 0.9853732,
+      0.9857192, 0.9860656, 0.9864108, 0.986748, 0.9870768, 0.987406, 0.9877252,
+      0.9880256, 0.9883216, 0.9885988, 0.9888668, 0.98912, 0.9893908, 0.9896432,
+      0.9898872, 0.990128, 0.9903448, 0.990588, 0.9908248, 0.9910572, 0.9912832,
+      0.9914904, 0.9916948, 0.9918864, 0.9920716, 0.9922628, 0.9924456,
+      0.9926184, 0.9927888, 0.9929744, 0.9931416, 0.9933132, 0.9934672,
+      0.9936196, 0.9937668, 0.9939148, 0.9940576, 0.9941928, 0.9943284,
+      0.9944512, 0.9945856, 0.9947068, 0.9948252, 0.9949428, 0.9950584,
+      0.9951744, 0.9952964, 0.9954052, 0.9955128, 0.9956152, 0.9957172,
+      0.9958184, 0.9959128, 0.9960036, 0.9961012, 0.9961952, 0.99628, 0.9963704,
+      0.9964552, 0.9965348, 0.996614, 0.9966896, 0.9967672, 0.9968532, 0.996932,
+      0.9970116, 0.9970804, 0.9971536, 0.9972108, 0.9972732, 0.9973412,
+      0.9974024, 0.997458, 0.997516, 0.997584, 0.9976396, 0.9976908, 0.9977392,
+      0.9977964, 0.9978364, 0.9978848, 0.9979276, 0.997984, 0.9980316, 0.998074,
+      0.998116, 0.9981652, 0.9982092, 0.9982516, 0.9982896, 0.9983292,
+      0.9983656, 0.9984056, 0.9984388, 0.9984732, 0.9985076, 0.9985416,
+      0.9985772, 0.9986036, 0.998632, 0.998662, 0.9986952, 0.9987228, 0.9987568,
+      0.9987828, 0.9988092, 0.9988388, 0.998862, 0.9988944, 0.9989188,
+      0.9989416, 0.9989616, 0.9989852, 0.9990068, 0.9990304, 0.9990516, 0.99907,
+      0.9990896, 0.9991124, 0.99913, 0.9991492, 0.999714, 0.9999028, 1
+   },
+   { // n=64
+      0, 0.0015652, 0.0961632, 0.30868, 0.5090112, 0.6582356, 0.7626792,
+      0.769386, 0.7759572, 0.7822472, 0.788388, 0.794348, 0.8001508, 0.8057336,
+      0.8111684, 0.8164632, 0.8216136, 0.8266104, 0.8314972, 0.836242, 0.840796,
+      0.8452324, 0.8495272, 0.853724, 0.85778, 0.861718, 0.8656136, 0.86935,
+      0.8729084, 0.8764396, 0.8797788, 0.8831116, 0.8862572, 0.8893764,
+      0.8923584, 0.8952712, 0.898152, 0.9009064, 0.903598, 0.9061524, 0.9086368,
+      0.911066, 0.913482, 0.915796, 0.9180276, 0.9201724, 0.9223344, 0.9244244,
+      0.9264328, 0.928402, 0.9302952, 0.9321348, 0.9339312, 0.9356632, 0.93738,
+      0.9390332, 0.940648, 0.942214, 0.943746, 0.9451824, 0.9466024, 0.94797,
+      0.9493348, 0.9506812, 0.9519812, 0.9532188, 0.95444, 0.955674, 0.9568336,
+      0.9579264, 0.9590084, 0.9600592, 0.9610848, 0.9620768, 0.963074,
+      0.9639928, 0.9649084, 0.96581, 0.9667128, 0.9676048, 0.9684408, 0.9692232,
+      0.969976, 0.9707312, 0.9714676, 0.9721708, 0.972854, 0.973548, 0.9742124,
+      0.9748504, 0.9754784, 0.9760684, 0.976684, 0.9772752, 0.9778208,
+      0.9783932, 0.9789424, 0.9794656, 0.979956, 0.9804228, 0.9808772,
+      0.9813216, 0.981772, 0.9822404, 0.9826852, 0.9831216, 0.9835116,
+      0.9839384, 0.9843256, 0.9846864, 0.9850628, 0.9854372, 0.9857852,
+      0.986106, 0.9864404, 0.9867828, 0.9871088, 0.98743, 0.9877268, 0.9880268,
+      0.988316, 0.9886016, 0.9888752, 0.989144, 0.9893928, 0.9896572, 0.989908,
+      0.990152, 0.9904028, 0.9906348, 0.99087, 0.9910796, 0.9912984, 0.9914916,
+      0.9916952, 0.99189, 0.9920808, 0.9922808, 0.9924728, 0.9926292, 0.9928076,
+      0.9929764, 0.9931364, 0.9932992, 0.9934572, 0.993612, 0.9937592,
+      0.9939132, 0.9940512, 0.9941868, 0.9943272, 0.9944576, 0.994576,
+      0.9946984, 0.9948308, 0.9949512, 0.9950776, 0.9952016, 0.9953172,
+      0.9954344, 0.9955424, 0.9956476, 0.995754, 0.9958496, 0.9959408,
+      0.9960388, 0.9961248, 0.9962164, 0.9963, 0.9963844, 0.9964692, 0.9965452,
+      0.9966252, 0.9966996, 0.9967744, 0.9968508, 0.996928, 0.9969928, 0.997066,
+      0.9971312, 0.9971912, 0.9972556, 0.997316, 0.9973828, 0.9974336, 0.997494,
+      0.997558, 0.9976208, 0.9976752, 0.9977284, 0.9977836, 0.997824, 0.9978716,
+      0.9979284, 0.9979804, 0.998024, 0.9980616, 0.9981064, 0.9981508, 0.99819,
+      0.9982256, 0.9982656, 0.9983004, 0.9983428, 0.998378, 0.9984128,
+      0.9984504, 0.9984832, 0.9985172, 0.9985508, 0.9985816, 0.9986168,
+      0.9986504, 0.9986788, 0.9987028, 0.9987356, 0.998766, 0.998798, 0.9988308,
+      0.9988568, 0.9988772, 0.9988988, 0.9989256, 0.9989504, 0.998978,
+      0.9990016, 0.9990212, 0.9990448, 0.9990676, 0.9990844, 0.9991068,
+      0.9991228, 0.999698, 0.9998944, 1
+   },
+   { // n=65
+      0, 0.0016328, 0.0959752, 0.3083312, 0.5090276, 0.6585216, 0.7629876,
+      0.7696732, 0.776282, 0.7826504, 0.7889052, 0.7949876, 0.800822, 0.8064048,
+      0.8119428, 0.8172844, 0.82248, 0.8274496, 0.8322852, 0.8369264, 0.841464,
+      0.845882, 0.8501856, 0.8543936, 0.8584724, 0.8623256, 0.8661032,
+      0.8698188, 0.8734276, 0.8769656, 0.8803044, 0.883616, 0.8868144,
+      0.8898428, 0.8928032, 0.895684, 0.8985452, 0.9013288, 0.9039664,
+      0.9065588, 0.9090812, 0.9114568, 0.9138736, 0.9162236, 0.9184972,
+      0.9206656, 0.9228184, 0.9249088, 0.9268952, 0.928762, 0.9306224,
+      0.9324628, 0.9342564, 0.9359328, 0.9376332, 0.939258, 0.9408512,
+      0.9423892, 0.94389, 0.9453648, 0.946776, 0.94821, 0.9495852, 0.9509148,
+      0.9522112, 0.9534432, 0.954668, 0.9558384, 0.9570168, 0.9581252,
+      0.9591984, 0.9602364, 0.961228, 0.9622436, 0.9632288, 0.9641412,
+      0.9650772, 0.9659504, 0.9668036, 0.9676324, 0.9684676, 0.9692696,
+      0.9700356, 0.9708236, 0.9715588, 0.9722544, 0.9729484, 0.9736216,
+      0.9742824, 0.9749432, 0.9756016, 0.9762236, 0.9768292, 0.9774184,
+      0.9779828, 0.9785468, 0.9790712, 0.9795824, 0.9800748, 0.9805748,
+      0.9810452, 0.9815292, 0.9820132, 0.9824388, 0.9828808, 0.9833136,
+      0.9837236, 0.9841224, 0.98451, 0.9849028, 0.9852588, 0.9856176, 0.985964,
+      0.9863112, 0.9866304, 0.9869592, 0.9872732, 0.987574, 0.9878756,
+      0.9881748, 0.988462, 0.988742, 0.9890168, 0.9892804, 0.989532, 0.989802,
+      0.9900536, 0.9903168, 0.9905584, 0.990788, 0.9910016, 0.9912208,
+      0.9914364, 0.99163, 0.9918204, 0.9920096, 0.9921988, 0.992386, 0.9925664,
+      0.9927348, 0.9929024, 0.9930828, 0.9932376, 0.993388, 0.9935452, 0.993692,
+      0.993846, 0.9939852, 0.9941236, 0.9942696, 0.9944088, 0.994532, 0.9946564,
+      0.9947816, 0.9949252, 0.9950376, 0.9951516, 0.9952768, 0.9953832,
+      0.9954752, 0.9955752, 0.9956676, 0.9957628, 0.9958604, 0.9959604,
+      0.9960544, 0.9961412, 0.99623, 0.9963104, 0.9963996, 0.996474, 0.996552,
+      0.9966316, 0.996712, 0.996784, 0.996846, 0.9969252, 0.9970016, 0.9970744,
+      0.9971432, 0.997206, 0.9972636, 0.9973304, 0.9973852, 0.9974364,
+      0.9974948, 0.9975652, 0.997624, 0.9976816, 0.997732, 0.9977876, 0.9978384,
+      0.9978932, 0.9979336, 0.9979796, 0.9980148, 0.998062, 0.9981008,
+      0.9981428, 0.9981796, 0.99822, 0.9982552, 0.998294, 0.9983392, 0.9983796,
+      0.9984192, 0.998456, 0.9984952, 0.998528, 0.9985592, 0.9985932, 0.9986252,
+      0.9986576, 0.9986864, 0.9987188, 0.9987512, 0.9987792, 0.9988092,
+      0.9988372, 0.9988604, 0.9988828, 0.9989092, 0.9989328, 0.9989564,
+      0.9989788, 0.9990056, 0.9990236, 0.9990476, 0.99907, 0.9990932, 0.9991136,
+      0.9991352, 0.9997076, 0.9999016, 1
+   },
+   { // n=66
+      0, 0.0015396, 0.095768, 0.308212, 0.5083924, 0.6578104, 0.7625132,
+      0.769346, 0.775934, 0.7823108, 0.7884928, 0.794548, 0.8004396, 0.8060252,
+      0.8115696, 0.8168548, 0.8219656, 0.8269472, 0.8318212, 0.8365588,
+      0.8411804, 0.8455712, 0.8498684, 0.8540436, 0.8580768, 0.8620112,
+      0.865872, 0.8696084, 0.8731708, 0.8766812, 0.880144, 0.88344, 0.8867048,
+      0.8898112, 0.8927732, 0.8956012, 0.8983972, 0.9011552, 0.9038076,
+      0.9064332, 0.9089664, 0.9114448, 0.9138136, 0.9161708, 0.9184092,
+      0.9205792, 0.92267, 0.9247344, 0.9267364, 0.9286472, 0.9305372, 0.9324028,
+      0.9342212, 0.936024, 0.937682, 0.9393028, 0.9408948, 0.9424568, 0.9439656,
+      0.9454296, 0.9468032, 0.9481664, 0.9495436, 0.9508332, 0.952118,
+      0.9533876, 0.9545988, 0.9557808, 0.956946, 0.9580384, 0.9591084,
+      0.9601832, 0.9612228, 0.96221, 0.9631592, 0.9641232, 0.9650432, 0.9659168,
+      0.966782, 0.967602, 0.9684368, 0.9692624, 0.9700216, 0.970754, 0.9715148,
+      0.9722344, 0.9729148, 0.9735956, 0.9742784, 0.974942, 0.9755436,
+      0.9761376, 0.976724, 0.9773092, 0.9778776, 0.9784624, 0.9789868, 0.979512,
+      0.9800204, 0.9805124, 0.9809808, 0.9814648, 0.981924, 0.982386, 0.9828072,
+      0.9832472, 0.9836444, 0.9840472, 0.9844396, 0.9848396, 0.9851908,
+      0.985558, 0.985918, 0.986276, 0.986602, 0.9869332, 0.9872512, 0.987552,
+      0.9878708, 0.988162, 0.9884464, 0.9887252, 0.9890072, 0.9892732, 0.98954,
+      0.9897896, 0.9900396, 0.9902768, 0.9905304, 0.990768, 0.9909856,
+      0.9912132, 0.9914232, 0.991648, 0.9918524, 0.992044, 0.9922404, 0.9924292,
+      0.9926048, 0.9927804, 0.9929592, 0.9931256, 0.9932788, 0.9934412,
+      0.9935852, 0.9937492, 0.9938864, 0.9940388, 0.9941824, 0.994322,
+      0.9944644, 0.9945812, 0.9946944, 0.9948156, 0.9949348, 0.9950528,
+      0.995164, 0.9952772, 0.9953864, 0.9954872, 0.9955956, 0.995702, 0.9958048,
+      0.9958996, 0.9959852, 0.9960688, 0.9961576, 0.9962476, 0.9963388, 0.99641,
+      0.9964848, 0.9965656, 0.9966332, 0.9967104, 0.9967832, 0.9968576, 0.99693,
+      0.9969948, 0.9970636, 0.997126, 0.9971804, 0.9972516, 0.9973068,
+      0.9973764, 0.997432, 0.9974912, 0.9975464, 0.9976008, 0.9976596,
+      0.9977112, 0.997754, 0.9978052, 0.9978596, 0.9979168, 0.9979696,
+      0.9980212, 0.998068, 0.9981092, 0.9981548, 0.9981932, 0.9982276,
+      0.9982632, 0.9983056, 0.998342, 0.9983808, 0.998426, 0.9984688, 0.9985044,
+      0.9985384, 0.9985732, 0.9986008, 0.9986356, 0.9986692, 0.9987052,
+      0.9987324, 0.9987672, 0.9987964, 0.9988228, 0.9988456, 0.9988684,
+      0.9988916, 0.998912, 0.9989396, 0.9989612, 0.998982, 0.9990064, 0.9990284,
+      0.9990476, 0.9990672, 0.9990876, 0.9991088, 0.9991272, 0.9997016,
+      0.9998912, 1
+   },
+   { // n=67
+      0, 0.001594, 0.0956364, 0.3078064, 0.5085828, 0.658506, 0.7629128,
+      0.7696916, 0.7762572, 0.7826092, 0.7887644, 0.794712, 0.800552, 0.8061028,
+      0.8115688, 0.81686, 0.8220296, 0.8270024, 0.8318316, 0.836548, 0.841126,
+      0.8455428, 0.8498032, 0.853978, 0.8580548, 0.8619608, 0.8657472,
+      0.8694356, 0.8730776, 0.8765564, 0.8800076, 0.8832928, 0.8864884,
+      0.8895744, 0.892562, 0.8955048, 0.8983528, 0.9011032, 0.9037896, 0.906392,
+      0.9089284, 0.9114212, 0.913812, 0.916158, 0.918394, 0.9206084, 0.922738,
+      0.9248108, 0.9267784, 0.9287204, 0.9306296, 0.9324272, 0.9342308,
+      0.9359536, 0.9376756, 0.9392912, 0.9408568, 0.9424292, 0.94394, 0.9453776,
+      0.9467796, 0.9481964, 0.9495492, 0.9508484, 0.9521196, 0.9533424,
+      0.9545444, 0.9557248, 0.9568504, 0.9579772, 0.9590744, 0.96013, 0.9611432,
+      0.9621348, 0.9631216, 0.9640388, 0.9649344, 0.9658516, 0.96674, 0.967592,
+      0.968466, 0.9692864, 0.970058, 0.9708264, 0.9715444, 0.9722676, 0.9729524,
+      0.9736528, 0.9742992, 0.9749456, 0.9755816, 0.9761912, 0.9768048,
+      0.9774116, 0.9779596, 0.9785176, 0.9790684, 0.9796096, 0.980124,
+      0.9806308, 0.9811232, 0.9815868, 0.9820632, 0.9824776, 0.9828884,
+      0.9833144, 0.9837452, 0.9841452, 0.9845296, 0.9849096, 0.9852936,
+      0.9856516, 0.9860068, 0.9863384, 0.9866648, 0.9869796, 0.987322, 0.987626,
+      0.9879276, 0.9882204, 0.988494, 0.9887484, 0.9890196, 0.9892736,
+      0.9895208, 0.9897636, 0.9899984, 0.9902308, 0.9904696, 0.9906916,
+      0.9909156, 0.991142, 0.9913564, 0.9915576, 0.9917516, 0.991946, 0.9921496,
+      0.9923268, 0.9925204, 0.992696, 0.9928716, 0.9930464, 0.993216, 0.9933672,
+      0.9935184, 0.9936684, 0.9938324, 0.9939724, 0.9941236, 0.9942684,
+      0.9944036, 0.9945412, 0.9946724, 0.9948028, 0.9949172, 0.9950356,
+      0.9951528, 0.995272, 0.9953856, 0.9954872, 0.9955912, 0.9956952,
+      0.9957976, 0.995894, 0.9959868, 0.996072, 0.9961596, 0.9962444, 0.996332,
+      0.9964188, 0.9964888, 0.9965764, 0.9966484, 0.9967192, 0.9967904,
+      0.9968584, 0.9969352, 0.9970056, 0.997064, 0.997126, 0.9971972, 0.997264,
+      0.9973264, 0.9973908, 0.9974544, 0.9975244, 0.997584, 0.9976412,
+      0.9976928, 0.9977452, 0.9978016, 0.9978468, 0.9978964, 0.9979468,
+      0.9980008, 0.9980352, 0.99808, 0.9981224, 0.998168, 0.9982028, 0.9982484,
+      0.9982888, 0.998332, 0.9983768, 0.9984156, 0.998452, 0.998484, 0.9985216,
+      0.9985572, 0.998586, 0.9986172, 0.9986496, 0.9986776, 0.9987072, 0.998734,
+      0.9987636, 0.9987884, 0.9988128, 0.9988372, 0.9988648, 0.9988896,
+      0.9989096, 0.9989348, 0.9989584, 0.9989796, 0.999002, 0.9990216,
+      0.9990432, 0.9990704, 0.9990912, 0.9991084, 0.999126, 0.9996928,
+      0.9999068, 1
+   },
+   { // n=68
+      0, 0.0015532, 0.0959712, 0.3083912, 0.508094, 0.6579868, 0.7626532,
+      0.769442, 0.775984, 0.7824108, 0.7886128, 0.79462, 0.8004304, 0.8060884,
+      0.8115696, 0.8169324, 0.8221184, 0.827102, 0.8320376, 0.8368336,
+      0.8414068, 0.8458644, 0.8500812, 0.8542188, 0.8582204, 0.8621776,
+      0.865992, 0.8696572, 0.8732352, 0.876676, 0.8801176, 0.8833988, 0.8866304,
+      0.8897524, 0.8927452, 0.8957044, 0.8985352, 0.9013448, 0.9040284,
+      0.9065948, 0.9091388, 0.9116044, 0.9140236, 0.9163072, 0.9185268,
+      0.9207372, 0.9228656, 0.9249436, 0.9269452, 0.928842, 0.9307492,
+      0.9325712, 0.934366, 0.9360944, 0.9378056, 0.9394336, 0.9409908,
+      0.9425448, 0.9440704, 0.9455748, 0.946986, 0.9483864, 0.9497096,
+      0.9510072, 0.9522968, 0.9535064, 0.9547104, 0.955868, 0.95699, 0.9580652,
+      0.9591284, 0.9601508, 0.961188, 0.9621796, 0.9631252, 0.9640424, 0.964966,
+      0.9658436, 0.9667016, 0.9675412, 0.9683368, 0.9691672, 0.969982, 0.970702,
+      0.9714464, 0.9721784, 0.972872, 0.9735388, 0.974184, 0.9748304, 0.9754508,
+      0.9760728, 0.9766772, 0.9772568, 0.9778416, 0.978394, 0.9789244,
+      0.9794176, 0.97994, 0.9804236, 0.980908, 0.9813752, 0.9818348, 0.9822752,
+      0.9827112, 0.9831424, 0.9835504, 0.9839536, 0.9843356, 0.9847196,
+      0.9850944, 0.9854576, 0.9858248, 0.9861456, 0.9864916, 0.9868356,
+      0.987158, 0.9874836, 0.9877776, 0.9880748, 0.9883872, 0.988672, 0.988948,
+      0.9892356, 0.9894756, 0.9897276, 0.989988, 0.9902408, 0.990474, 0.99069,
+      0.990912, 0.9911376, 0.9913396, 0.9915652, 0.9917808, 0.9919648,
+      0.9921592, 0.9923512, 0.9925348, 0.99272, 0.9928892, 0.9930568, 0.9932232,
+      0.9933996, 0.9935556, 0.993726, 0.9938756, 0.99403, 0.9941624, 0.9943028,
+      0.9944336, 0.9945584, 0.9946856, 0.9948108, 0.994922, 0.9950424, 0.995154,
+      0.9952716, 0.9953856, 0.995502, 0.9956092, 0.9957072, 0.9958056,
+      0.9959052, 0.9959924, 0.9960792, 0.9961708, 0.9962636, 0.9963456,
+      0.9964336, 0.9965184, 0.9965928, 0.9966724, 0.9967488, 0.9968272,
+      0.996898, 0.9969656, 0.9970412, 0.9971044, 0.9971692, 0.9972316,
+      0.9973052, 0.9973612, 0.9974236, 0.9974864, 0.9975452, 0.9976048,
+      0.9976528, 0.997706, 0.9977504, 0.9977988, 0.9978496, 0.9978956,
+      0.9979428, 0.9979952, 0.998044, 0.9980832, 0.9981188, 0.998158, 0.9982068,
+      0.9982484, 0.998284, 0.9983208, 0.9983536, 0.9983932, 0.9984228,
+      0.9984632, 0.9984996, 0.998532, 0.9985688, 0.9986024, 0.9986292,
+      0.9986652, 0.9986928, 0.9987292, 0.9987532, 0.99878, 0.9988, 0.9988268,
+      0.998848, 0.9988684, 0.9988968, 0.9989128, 0.9989372, 0.9989628,
+      0.9989832, 0.9990048, 0.9990244, 0.99905, 0.999068, 0.9990868, 0.9991092,
+      0.9997144, 0.9999072, 1
+   },
+   { // n=69
+      0, 0.0015416, 0.0957784, 0.307866, 0.5084116, 0.6580216, 0.762684,
+      0.7694204, 0.7760164, 0.7824128, 0.7885984, 0.7945884, 0.8003452,
+      0.8059912, 0.8114256, 0.816718, 0.8218152, 0.826842, 0.8317256, 0.8364552,
+      0.8410948, 0.8456024, 0.8499108, 0.8540756, 0.8580852, 0.8620116,
+      0.8658268, 0.8695808, 0.8731708, 0.8766316, 0.8800184, 0.8832984,
+      0.8864708, 0.8896532, 0.892642, 0.8954752, 0.8983532, 0.9011252,
+      0.9037832, 0.9064276, 0.9088916, 0.9113916, 0.9137976, 0.9161108,
+      0.9183308, 0.9204516, 0.9225852, 0.9246616, 0.926646, 0.9285728,
+      0.9305004, 0.932312, 0.9341164, 0.9358948, 0.9375948, 0.9392064,
+      0.9407796, 0.9423688, 0.943852, 0.9452748, 0.9466912, 0.9480792, 0.949434,
+      0.950756, 0.9520004, 0.953258, 0.9544852, 0.9556768, 0.9568704, 0.958018,
+      0.9591264, 0.9601664, 0.9611664, 0.9621552, 0.963146, 0.964114, 0.96508,
+      0.965976, 0.9668624, 0.9676828, 0.9685056, 0.969292, 0.9700444, 0.9707808,
+      0.9715332, 0.9722344, 0.9729172, 0.9736164, 0.9742816, 0.9749348,
+      0.9755528, 0.976136, 0.9767392, 0.9773116, 0.9778796, 0.9784264,
+      0.9789504, 0.9794708, 0.9799668, 0.9804728, 0.980968, 0.9814488, 0.981924,
+      0.9823676, 0.9828208, 0.9832484, 0.9836612, 0.984034, 0.9844384,
+      0.9848272, 0.9852004, 0.9855528, 0.985888, 0.9862128, 0.986532, 0.9868404,
+      0.9871584, 0.9874808, 0.987794, 0.9881028, 0.9884028, 0.9886904, 0.988948,
+      0.9892188, 0.9894872, 0.9897568, 0.9899924, 0.9902276, 0.9904476,
+      0.9906836, 0.9909124, 0.9911204, 0.9913444, 0.9915488, 0.9917548,
+      0.9919532, 0.9921576, 0.9923488, 0.9925288, 0.9927032, 0.992872,
+      0.9930528, 0.9932128, 0.9933804, 0.9935296, 0.9937028, 0.9938592, 0.994,
+      0.994148, 0.9942856, 0.9944236, 0.9945552, 0.9946736, 0.9948108,
+      0.9949336, 0.9950544, 0.9951768, 0.99529, 0.9953844, 0.995492, 0.9956,
+      0.9956996, 0.995796, 0.9958976, 0.995994, 0.9960924, 0.9961828, 0.9962676,
+      0.9963504, 0.996438, 0.9965224, 0.9966004, 0.9966884, 0.9967692, 0.99684,
+      0.9969028, 0.9969776, 0.9970372, 0.9971056, 0.997174, 0.9972436,
+      0.9973156, 0.9973792, 0.9974372, 0.997488, 0.9975408, 0.9975936,
+      0.9976556, 0.9977028, 0.9977556, 0.9978108, 0.997856, 0.9979072,
+      0.9979524, 0.9979964, 0.9980424, 0.9980932, 0.9981408, 0.9981864,
+      0.9982348, 0.998284, 0.9983228, 0.998358, 0.9983936, 0.9984356, 0.998472,
+      0.998506, 0.9985344, 0.9985656, 0.9986048, 0.9986356, 0.9986652,
+      0.9986976, 0.9987224, 0.9987552, 0.998782, 0.9988092, 0.9988348,
+      0.9988576, 0.9988836, 0.9989064, 0.998932, 0.998954, 0.9989772, 0.998996,
+      0.9990144, 0.9990308, 0.9990564, 0.9990812, 0.9990996, 0.9991164,
+      0.9991348, 0.9997156, 0.999904, 1
+   },
+   { // n=70
+      0, 0.0015532, 0.0957032, 0.3078804, 0.508002, 0.6578472, 0.7621704,
+      0.7689416, 0.7755484, 0.781938, 0.7879868, 0.7940068, 0.7998976,
+      0.8055916, 0.8110228, 0.8163232, 0.8214928, 0.8265084, 0.8313612,
+      0.8360992, 0.8406256, 0.845074, 0.8494052, 0.8535904, 0.8577004,
+      0.8616396, 0.8654728, 0.8691796, 0.872772, 0.8762444, 0.879704, 0.8829436,
+      0.8862048, 0.889318, 0.892292, 0.8952392, 0.898068, 0.9008176, 0.9034672,
+      0.9060276, 0.9085804, 0.911038, 0.9134216, 0.91578, 0.9179772, 0.9201392,
+      0.9222896, 0.9243628, 0.9263264, 0.928332, 0.9302868, 0.9321292,
+      0.9339268, 0.9356816, 0.93737, 0.9389972, 0.9406164, 0.9422012, 0.943744,
+      0.9452084, 0.9466672, 0.9480628, 0.9494188, 0.9507376, 0.9520264,
+      0.9532532, 0.954482, 0.955624, 0.95675, 0.9578344, 0.9589288, 0.9599924,
+      0.9610388, 0.9620124, 0.9629876, 0.9639436, 0.964884, 0.9657916, 0.966654,
+      0.967492, 0.9683052, 0.9691096, 0.969884, 0.9706216, 0.9713604, 0.9720792,
+      0.9727824, 0.9734848, 0.9741528, 0.974808, 0.9754372, 0.9760704,
+      0.9766864, 0.9772652, 0.9777984, 0.9783444, 0.9788828, 0.9793964,
+      0.9799136, 0.9804028, 0.9808964, 0.981356, 0.981822, 0.982244, 0.9826772,
+      0.983092, 0.9835076, 0.98393, 0.984326, 0.9846884, 0.9850804, 0.985446,
+      0.9857904, 0.986136, 0.9864736, 0.9868048, 0.9871288, 0.9874336,
+      0.9877492, 0.9880272, 0.9883136, 0.9885908, 0.9888704, 0.989124, 0.989384,
+      0.9896368, 0.9898864, 0.9901492, 0.9903892, 0.9906292, 0.9908676,
+      0.9910868, 0.9913076, 0.9914936, 0.9917136, 0.991914, 0.9921016, 0.992294,
+      0.9924648, 0.9926416, 0.9928296, 0.9929924, 0.9931544, 0.9933136,
+      0.9934604, 0.9936176, 0.9937632, 0.9939224, 0.9940596, 0.994208,
+      0.9943416, 0.9944724, 0.9946128, 0.9947456, 0.994868, 0.9950068,
+      0.9951268, 0.9952496, 0.9953608, 0.9954828, 0.9955912, 0.9957, 0.9957992,
+      0.9958928, 0.9959828, 0.9960764, 0.9961604, 0.9962416, 0.99633, 0.9964156,
+      0.9965028, 0.9965756, 0.9966464, 0.9967128, 0.9967836, 0.9968624,
+      0.9969332, 0.997002, 0.9970676, 0.9971392, 0.9972068, 0.997274, 0.9973372,
+      0.9973968, 0.997446, 0.9974964, 0.9975476, 0.9976024, 0.997658, 0.9977056,
+      0.997758, 0.9978116, 0.9978672, 0.9979116, 0.9979576, 0.9980064,
+      0.9980512, 0.998096, 0.9981392, 0.998186, 0.99823, 0.9982712, 0.9983152,
+      0.9983596, 0.9984028, 0.9984412, 0.99848, 0.9985108, 0.998548, 0.998578,
+      0.9986092, 0.9986448, 0.9986784, 0.9987152, 0.9987432, 0.998774,
+      0.9987976, 0.9988224, 0.9988452, 0.9988792, 0.9989052, 0.9989316,
+      0.9989592, 0.9989852, 0.9990068, 0.999024, 0.9990444, 0.9990648,
+      0.9990868, 0.9991048, 0.9991216, 0.9991416, 0.9997052, 0.999906, 1
+   },
+   { // n=71
+      0, 0.001586, 0.0958292, 0.3078668, 0.5087728, 0.658162, 0.7624836,
+      0.7692628, 0.7758348, 0.7821568, 0.7883492, 0.7943732, 0.8001332,
+      0.8058456, 0.8113288, 0.8166996, 0.8218704, 0.8269492, 0.831762,
+      0.8364152, 0.84098, 0.8454008, 0.8496704, 0.8538424, 0.8579436, 0.861878,
+      0.865686, 0.8694192, 0.8729812, 0.87642, 0.8798712, 0.8831384, 0.8863084,
+      0.8894336, 0.892392, 0.895302, 0.898186, 0.9009116, 0.9035912, 0.9062304,
+      0.9087712, 0.9112272, 0.913602, 0.9159532, 0.9181968, 0.9203876,
+      0.9224748, 0.9245176, 0.926538, 0.9284964, 0.930392, 0.9322364, 0.9340308,
+      0.9357096, 0.9374052, 0.9390196, 0.9406412, 0.9422012, 0.9437304,
+      0.945206, 0.9466108, 0.9480232, 0.949426, 0.9507656, 0.9520356, 0.95326,
+      0.954476, 0.9556468, 0.9567936, 0.957918, 0.9589816, 0.9600312, 0.9610608,
+      0.9621084, 0.9630752, 0.9639836, 0.9649116, 0.965782, 0.9666488,
+      0.9674904, 0.9683216, 0.9691404, 0.96995, 0.9707312, 0.9714624, 0.9721632,
+      0.9728504, 0.9735248, 0.9742012, 0.9748656, 0.9754776, 0.976064,
+      0.9766648, 0.9772452, 0.977824, 0.978384, 0.9789088, 0.979436, 0.97997,
+      0.9804984, 0.980976, 0.9814436, 0.9819204, 0.9823796, 0.9828224, 0.98324,
+      0.9836432, 0.9840532, 0.9844656, 0.9848312, 0.9851968, 0.985544,
+      0.9859036, 0.9862344, 0.9865808, 0.9869212, 0.9872368, 0.987554,
+      0.9878448, 0.9881432, 0.9884184, 0.988704, 0.9889628, 0.9892364,
+      0.9894952, 0.989766, 0.9900216, 0.9902632, 0.9905064, 0.9907488,
+      0.9909796, 0.99119, 0.9913932, 0.991596, 0.991798, 0.991988, 0.9921656,
+      0.9923632, 0.992526, 0.9926932, 0.992864, 0.9930372, 0.993198, 0.9933496,
+      0.9935108, 0.9936636, 0.9938092, 0.9939532, 0.9940952, 0.9942284,
+      0.9943676, 0.9945104, 0.994646, 0.9947832, 0.994904, 0.9950228, 0.9951396,
+      0.9952488, 0.9953636, 0.9954688, 0.9955784, 0.9956804, 0.99578, 0.995874,
+      0.9959572, 0.9960464, 0.9961272, 0.9962292, 0.9963264, 0.9964184,
+      0.9965004, 0.9965816, 0.9966544, 0.9967228, 0.9967948, 0.9968692,
+      0.9969388, 0.9970088, 0.9970772, 0.9971448, 0.9972172, 0.997284,
+      0.9973464, 0.9974128, 0.997482, 0.997548, 0.9975996, 0.9976548, 0.9977096,
+      0.9977652, 0.997814, 0.9978596, 0.9979044, 0.9979516, 0.9979992,
+      0.9980484, 0.9980936, 0.9981256, 0.998166, 0.9982048, 0.9982456,
+      0.9982796, 0.9983164, 0.998356, 0.99839, 0.9984244, 0.9984604, 0.9984896,
+      0.9985228, 0.998554, 0.9985828, 0.9986128, 0.9986464, 0.9986856,
+      0.9987152, 0.998746, 0.9987744, 0.9988, 0.998822, 0.9988516, 0.9988728,
+      0.9988964, 0.998926, 0.9989496, 0.9989632, 0.9989856, 0.9990068,
+      0.9990308, 0.9990488, 0.9990696, 0.9990948, 0.9991164, 0.9997012,
+      0.9998932, 1
+   },
+   { // n=72
+      0, 0.0015748, 0.0960024, 0.3078324, 0.508086, 0.6581288, 0.7622148,
+      0.7689796, 0.7756316, 0.7820564, 0.788306, 0.7943592, 0.8001276,
+      0.8057932, 0.8113684, 0.8166356, 0.8218968, 0.8269488, 0.8317728,
+      0.8365272, 0.8410592, 0.8454196, 0.8496848, 0.853872, 0.8579748, 0.861876,
+      0.8657228, 0.8694124, 0.8730756, 0.8765292, 0.87996, 0.883234, 0.886444,
+      0.8895856, 0.8926032, 0.8955432, 0.8983872, 0.901184, 0.903858, 0.9065008,
+      0.9090084, 0.9114488, 0.9138108, 0.91609, 0.9183984, 0.9205852, 0.9227376,
+      0.9248172, 0.9268304, 0.9287408, 0.9306372, 0.9324608, 0.9342732,
+      0.9360132, 0.9376984, 0.9393372, 0.940954, 0.942506, 0.9439936, 0.9454456,
+      0.94685, 0.9482844, 0.9496712, 0.9509856, 0.9522648, 0.9534544, 0.9546628,
+      0.9558076, 0.9569416, 0.9580388, 0.9590972, 0.9601508, 0.9611296,
+      0.9621724, 0.9631124, 0.9640744, 0.9649764, 0.9658876, 0.9667448,
+      0.9675764, 0.968396, 0.9691864, 0.9699972, 0.9707452, 0.9714744,
+      0.9721912, 0.9729112, 0.9736108, 0.9742844, 0.974942, 0.9755956, 0.97623,
+      0.9768372, 0.9774248, 0.9780096, 0.9785652, 0.9790892, 0.97962, 0.9801384,
+      0.9806228, 0.9811, 0.9815984, 0.9820708, 0.9825076, 0.9829508, 0.9833668,
+      0.9837728, 0.9841768, 0.9845772, 0.98494, 0.985302, 0.9856576, 0.9859996,
+      0.9863276, 0.9866804, 0.987002, 0.9873192, 0.98764, 0.9879444, 0.988254,
+      0.9885472, 0.9888212, 0.9890852, 0.9893632, 0.9896432, 0.9898932,
+      0.990124, 0.99037, 0.9906124, 0.990838, 0.9910628, 0.9912664, 0.9914796,
+      0.9916984, 0.9918912, 0.9920748, 0.992278, 0.992456, 0.992628, 0.9928052,
+      0.992974, 0.993132, 0.9933028, 0.9934568, 0.9935996, 0.993744, 0.993904,
+      0.9940368, 0.9941784, 0.9943036, 0.9944428, 0.9945648, 0.9946972,
+      0.9948028, 0.9949164, 0.9950312, 0.995138, 0.995248, 0.9953616, 0.9954788,
+      0.9955964, 0.9956992, 0.9957992, 0.9958864, 0.9959776, 0.9960704,
+      0.9961584, 0.9962428, 0.996334, 0.99642, 0.9965068, 0.9965948, 0.996674,
+      0.9967456, 0.9968216, 0.996896, 0.9969632, 0.9970324, 0.9971, 0.9971748,
+      0.9972344, 0.997302, 0.9973584, 0.9974136, 0.9974704, 0.9975328, 0.99759,
+      0.9976512, 0.9977148, 0.9977632, 0.9978124, 0.9978592, 0.9979108,
+      0.9979576, 0.9980012, 0.9980404, 0.998086, 0.9981344, 0.998172, 0.9982132,
+      0.9982596, 0.998302, 0.998344, 0.9983768, 0.9984072, 0.9984416, 0.9984752,
+      0.998508, 0.9985448, 0.9985764, 0.9986044, 0.9986344, 0.9986652,
+      0.9986948, 0.9987172, 0.9987484, 0.9987728, 0.9987992, 0.9988272,
+      0.9988556, 0.9988876, 0.9989124, 0.9989368, 0.9989588, 0.9989748,
+      0.998998, 0.9990224, 0.9990424, 0.9990644, 0.999084, 0.9991064, 0.9991256,
+      0.999708, 0.9998972, 1
+   },
+   { // n=73
+      0, 0.00157, 0.0961616, 0.3077956, 0.5084268, 0.6574772, 0.762116,
+      0.7688652, 0.7754128, 0.7817752, 0.7879848, 0.7939896, 0.7997492,
+      0.8054744, 0.8109256, 0.8162492, 0.821394, 0.826388, 0.8312548, 0.8359968,
+      0.8405252, 0.844988, 0.8493004, 0.8534264, 0.8575148, 0.861478, 0.8652912,
+      0.8689992, 0.872602, 0.8760884, 0.8795176, 0.8827936, 0.8859916,
+      0.8890972, 0.8920952, 0.894974, 0.8977948, 0.9005124, 0.9031696,
+      0.9057756, 0.9083684, 0.910808, 0.91317, 0.9155552, 0.917808, 0.9199388,
+      0.9220932, 0.924204, 0.9261964, 0.9281476, 0.9300788, 0.9319416,
+      0.9337732, 0.9355328, 0.9372696, 0.9389436, 0.9405136, 0.9420576,
+      0.9435788, 0.9450404, 0.946478, 0.9479168, 0.949296, 0.9506132, 0.9518544,
+      0.9531056, 0.9543152, 0.955524, 0.9566412, 0.9577804, 0.9588628,
+      0.9599084, 0.9609548, 0.9619708, 0.9629472, 0.9638984, 0.964798,
+      0.9656924, 0.9665496, 0.9674112, 0.968248, 0.9690312, 0.9697996,
+      0.9705876, 0.9713388, 0.9720688, 0.972768, 0.9734492, 0.974126, 0.9747728,
+      0.9754072, 0.9760268, 0.9766592, 0.9772268, 0.9777896, 0.9783272, 0.97885,
+      0.9793768, 0.9798756, 0.9803592, 0.9808552, 0.9813256, 0.9817996,
+      0.982228, 0.982648, 0.9830724, 0.983482, 0.983862, 0.98426, 0.9846504,
+      0.9850108, 0.985372, 0.9857212, 0.9860788, 0.9864136, 0.9867504,
+      0.9870872, 0.9873908, 0.9877064, 0.9880224, 0.9883124, 0.9885836,
+      0.9888664, 0.989136, 0.989412, 0.9896536, 0.9899184, 0.9901768, 0.9903992,
+      0.9906616, 0.9908812, 0.9911192, 0.9913188, 0.9915316, 0.9917288,
+      0.9919208, 0.9921144, 0.9922848, 0.9924772, 0.9926556, 0.9928272,
+      0.9929844, 0.993148, 0.9933052, 0.993454, 0.9936144, 0.9937684, 0.9939228,
+      0.9940736, 0.9942112, 0.9943376, 0.9944756, 0.9946004, 0.9947184,
+      0.994842, 0.994958, 0.9950716, 0.9951812, 0.9953024, 0.9954076, 0.995516,
+      0.9956204, 0.9957232, 0.9958276, 0.9959244, 0.9960224, 0.9961092,
+      0.9962008, 0.996282, 0.9963704, 0.99646, 0.9965428, 0.9966328, 0.9967152,
+      0.9967892, 0.99687, 0.9969564, 0.9970268, 0.997098, 0.9971648, 0.9972276,
+      0.9972932, 0.997368, 0.99743, 0.997486, 0.9975504, 0.9976128, 0.9976692,
+      0.9977236, 0.9977748, 0.9978296, 0.997874, 0.997924, 0.9979748, 0.9980128,
+      0.9980572, 0.9981024, 0.9981408, 0.9981804, 0.9982176, 0.9982592,
+      0.9982964, 0.9983368, 0.9983676, 0.9984072, 0.998444, 0.9984804, 0.998522,
+      0.9985548, 0.9985848, 0.9986144, 0.9986412, 0.9986712, 0.9986988,
+      0.9987276, 0.9987532, 0.9987804, 0.9988104, 0.998836, 0.998864, 0.9988836,
+      0.9989064, 0.9989284, 0.998954, 0.9989784, 0.9990068, 0.9990332,
+      0.9990532, 0.9990724, 0.9990952, 0.9991164, 0.9991368, 0.9997216,
+      0.9998964, 1
+   },
+   { // n=74
+      0, 0.001618, 0.095688, 0.3073872, 0.5077956, 0.6576064, 0.7619736,
+      0.7688008, 0.7753992, 0.7817568, 0.7879724, 0.7940152, 0.7998352,
+      0.8054796, 0.8110232, 0.81643, 0.821496, 0.8264452, 0.831314, 0.8361504,
+      0.8407728, 0.8452184, 0.849516, 0.8537204, 0.8577976, 0.8616964, 0.865444,
+      0.8691464, 0.8727392, 0.8761356, 0.87949, 0.882786, 0.8859812, 0.88904,
+      0.8921076, 0.8950396, 0.8978984, 0.900708, 0.903422, 0.9060376, 0.9085864,
+      0.9110292, 0.9133904, 0.915688, 0.9179728, 0.9201688, 0.9222964,
+      0.9244032, 0.9264196, 0.928388, 0.930272, 0.9321204, 0.9339456, 0.9356928,
+      0.9373672, 0.93901, 0.940662, 0.94223, 0.9437708, 0.9452296, 0.9466556,
+      0.9480548, 0.9493844, 0.9506992, 0.9519684, 0.9532556, 0.9544432,
+      0.9556164, 0.9567872, 0.9579152, 0.9589956, 0.9600396, 0.9610972,
+      0.9620724, 0.9630676, 0.9639984, 0.96488, 0.9657816, 0.9666492, 0.9675012,
+      0.9683096, 0.969114, 0.9699216, 0.9707012, 0.971464, 0.9722048, 0.97294,
+      0.9736008, 0.9742892, 0.9749268, 0.9755604, 0.9761956, 0.9767772,
+      0.9773812, 0.9779376, 0.9784828, 0.9790492, 0.9795512, 0.9800588,
+      0.9805548, 0.9810444, 0.9815072, 0.9819672, 0.9823988, 0.9828376,
+      0.9832688, 0.9836728, 0.9840788, 0.984442, 0.9848152, 0.9851852, 0.98556,
+      0.9859188, 0.986254, 0.986588, 0.9869072, 0.9872412, 0.987542, 0.9878612,
+      0.9881508, 0.9884452, 0.9887388, 0.9890164, 0.9892876, 0.9895512,
+      0.9897896, 0.99003, 0.9902672, 0.990502, 0.9907292, 0.9909572, 0.991178,
+      0.9913908, 0.9916052, 0.9918092, 0.992002, 0.9922016, 0.9923872,
+      0.9925832, 0.992762, 0.9929268, 0.9930828, 0.993238, 0.993394, 0.9935556,
+      0.9937012, 0.9938576, 0.9940044, 0.9941468, 0.9942944, 0.9944232,
+      0.9945328, 0.994654, 0.9947784, 0.9948944, 0.995008, 0.995126, 0.9952448,
+      0.9953628, 0.995472, 0.9955756, 0.995672, 0.9957736, 0.9958728, 0.995962,
+      0.99605, 0.9961496, 0.9962336, 0.9963212, 0.9964056, 0.99649, 0.9965732,
+      0.9966604, 0.9967312, 0.9968112, 0.996886, 0.9969488, 0.997024, 0.997084,
+      0.9971484, 0.9972176, 0.9972712, 0.9973236, 0.9973808, 0.9974388, 0.9975,
+      0.9975568, 0.9976104, 0.9976596, 0.9977128, 0.9977692, 0.997812,
+      0.9978668, 0.9979088, 0.997956, 0.9980024, 0.9980472, 0.9980928,
+      0.9981336, 0.9981744, 0.9982124, 0.9982536, 0.9983, 0.9983364, 0.998372,
+      0.998406, 0.9984428, 0.9984792, 0.9985148, 0.9985452, 0.9985796,
+      0.9986068, 0.9986384, 0.9986632, 0.9986944, 0.9987216, 0.9987508,
+      0.998778, 0.9988068, 0.9988328, 0.998862, 0.998884, 0.9989156, 0.9989404,
+      0.9989608, 0.9989832, 0.9990056, 0.9990288, 0.9990472, 0.999072,
+      0.9990908, 0.9991112, 0.999712, 0.999894, 1
+   },
+   { // n=75
+      0, 0.0015588, 0.0956944, 0.3073796, 0.5077308, 0.6575804, 0.7618496,
+      0.768612, 0.7752088, 0.7815952, 0.787818, 0.7938316, 0.79963, 0.8053744,
+      0.8108756, 0.816166, 0.82136, 0.8263988, 0.8312224, 0.8359888, 0.840656,
+      0.8451964, 0.8494656, 0.853616, 0.8576776, 0.861518, 0.8653564, 0.8691184,
+      0.8727596, 0.8762288, 0.8795972, 0.8829016, 0.8861284, 0.8892768,
+      0.8922432, 0.8951572, 0.8980048, 0.9007588, 0.903418, 0.9060348, 0.908598,
+      0.9110816, 0.913454, 0.9157336, 0.9180568, 0.9202432, 0.9223888, 0.924442,
+      0.9263968, 0.9283732, 0.9302864, 0.9321532, 0.9339396, 0.93567, 0.9373472,
+      0.939008, 0.9405508, 0.9420784, 0.9435784, 0.945046, 0.946464, 0.9478524,
+      0.9492256, 0.9505484, 0.9518288, 0.9531024, 0.9543312, 0.9555308,
+      0.9566608, 0.9577696, 0.9588696, 0.9599164, 0.960946, 0.961946, 0.9629288,
+      0.9639024, 0.9647912, 0.9656784, 0.9665772, 0.9674068, 0.9682372,
+      0.9690504, 0.9698184, 0.9705768, 0.9713236, 0.972056, 0.9727444,
+      0.9734196, 0.974084, 0.9747304, 0.9753668, 0.9759772, 0.976586, 0.9771628,
+      0.9777292, 0.9782564, 0.9787864, 0.9792992, 0.9798016, 0.9803012,
+      0.9807956, 0.981268, 0.981728, 0.982172, 0.9826008, 0.9830268, 0.9834332,
+      0.983832, 0.9842144, 0.9845984, 0.9849692, 0.9853328, 0.9856812,
+      0.9860372, 0.9863892, 0.9867156, 0.9870428, 0.9873376, 0.9876352,
+      0.9879448, 0.9882312, 0.9885144, 0.98879, 0.9890724, 0.989354, 0.9896096,
+      0.9898696, 0.9901088, 0.9903552, 0.9905928, 0.9908264, 0.99103, 0.9912512,
+      0.9914676, 0.9916724, 0.9918784, 0.9920736, 0.9922596, 0.9924508,
+      0.9926172, 0.9927972, 0.992962, 0.9931184, 0.9932772, 0.9934428,
+      0.9935944, 0.99375, 0.9938952, 0.9940352, 0.9941696, 0.9943108, 0.9944368,
+      0.9945624, 0.9946932, 0.9948372, 0.9949568, 0.9950804, 0.9951956,
+      0.9953064, 0.9954196, 0.9955248, 0.995628, 0.995734, 0.9958236, 0.995926,
+      0.99603, 0.996122, 0.9962188, 0.9963036, 0.9963832, 0.9964672, 0.996562,
+      0.9966424, 0.9967172, 0.996798, 0.9968668, 0.9969384, 0.9970072, 0.997076,
+      0.997142, 0.9972116, 0.9972744, 0.9973408, 0.9974012, 0.9974588,
+      0.9975084, 0.9975584, 0.997618, 0.9976796, 0.9977256, 0.9977764, 0.99783,
+      0.997882, 0.9979256, 0.99797, 0.9980164, 0.9980672, 0.9981172, 0.998164,
+      0.998198, 0.9982436, 0.9982816, 0.998318, 0.9983532, 0.9983836, 0.998418,
+      0.9984528, 0.9984812, 0.998516, 0.9985504, 0.9985764, 0.9986088, 0.998638,
+      0.99867, 0.9986976, 0.9987256, 0.9987548, 0.9987876, 0.9988128, 0.9988372,
+      0.9988636, 0.9988852, 0.9989128, 0.998938, 0.9989584, 0.99898, 0.9990064,
+      0.999028, 0.9990536, 0.9990748, 0.999098, 0.9991212, 0.9997136, 0.9999008,
+      1
+   }
+};
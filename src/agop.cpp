@@ -51,7 +51,16 @@ static const R_CallMethodDef cCallMethods[] = {
    MAKE_CALL_METHOD(index_w,                    1),
    MAKE_CALL_METHOD(index_rp,                   2),
    MAKE_CALL_METHOD(index_lp,                   2),
+   MAKE_CALL_METHOD(index_stream,               6),
+   MAKE_CALL_METHOD(citation_store_write,       4),
+   MAKE_CALL_METHOD(citation_store_open,        1),
+   MAKE_CALL_METHOD(citation_store_close,       1),
+   MAKE_CALL_METHOD(citation_store_authors,     1),
+   MAKE_CALL_METHOD(citation_store_index,       3),
+   MAKE_CALL_METHOD(owa_weights_prepare,        1),
    MAKE_CALL_METHOD(d2owa_checkwts,             1),
+   MAKE_CALL_METHOD(d2owa,                      2),
+   MAKE_CALL_METHOD(aggregate_grouped,          7),
 
    MAKE_CALL_METHOD(check_comonotonicity,       3),
    MAKE_CALL_METHOD(pord_weakdom,               2),
@@ -83,36 +92,67 @@ static const R_CallMethodDef cCallMethods[] = {
    MAKE_CALL_METHOD(rel_closure_symmetric,      1),
 
    MAKE_CALL_METHOD(exp_test_statistic,         1),
+   MAKE_CALL_METHOD(exp_test_ad,                3),
+   MAKE_CALL_METHOD(exp_test_ad_simulate,       3),
+   MAKE_CALL_METHOD(pareto2_test_f_simulate,    4),
    MAKE_CALL_METHOD(ppareto2,                   4),
-
-   MAKE_CALL_METHOD(tnorm_minimum,              2),
-   MAKE_CALL_METHOD(tnorm_product,              2),
-   MAKE_CALL_METHOD(tnorm_lukasiewicz,          2),
-   MAKE_CALL_METHOD(tnorm_drastic,              2),
-   MAKE_CALL_METHOD(tnorm_fodor,                2),
-
-   MAKE_CALL_METHOD(tconorm_minimum,            2),
-   MAKE_CALL_METHOD(tconorm_product,            2),
-   MAKE_CALL_METHOD(tconorm_lukasiewicz,        2),
-   MAKE_CALL_METHOD(tconorm_drastic,            2),
-   MAKE_CALL_METHOD(tconorm_fodor,              2),
-
-   MAKE_CALL_METHOD(fnegation_classic,          1),
-   MAKE_CALL_METHOD(fnegation_yager,            1),
-   MAKE_CALL_METHOD(fnegation_minimal,          1),
-   MAKE_CALL_METHOD(fnegation_maximal,          1),
-
-   MAKE_CALL_METHOD(fimplication_maximal,       2),
-   MAKE_CALL_METHOD(fimplication_minimal,       2),
-   MAKE_CALL_METHOD(fimplication_kleene,        2),
-   MAKE_CALL_METHOD(fimplication_lukasiewicz,   2),
-   MAKE_CALL_METHOD(fimplication_reichenbach,   2),
-   MAKE_CALL_METHOD(fimplication_fodor,         2),
-   MAKE_CALL_METHOD(fimplication_goguen,        2),
-   MAKE_CALL_METHOD(fimplication_goedel,        2),
-   MAKE_CALL_METHOD(fimplication_rescher,       2),
-   MAKE_CALL_METHOD(fimplication_weber,         2),
-   MAKE_CALL_METHOD(fimplication_yager,         2),
+   MAKE_CALL_METHOD(dpareto2,                   3),
+   MAKE_CALL_METHOD(qpareto2,                   4),
+   MAKE_CALL_METHOD(rpareto2,                   5),
+   MAKE_CALL_METHOD(pdpareto2,                  4),
+   MAKE_CALL_METHOD(ddpareto2,                  3),
+   MAKE_CALL_METHOD(qdpareto2,                  4),
+   MAKE_CALL_METHOD(rdpareto2,                  5),
+   MAKE_CALL_METHOD(pareto2_estimate_mle,       6),
+   MAKE_CALL_METHOD(pareto2_estimate_mmse,      2),
+   MAKE_CALL_METHOD(dpareto2_estimate_mle,      8),
+
+   MAKE_CALL_METHOD(tnorm_minimum,              4),
+   MAKE_CALL_METHOD(tnorm_product,              4),
+   MAKE_CALL_METHOD(tnorm_lukasiewicz,          4),
+   MAKE_CALL_METHOD(tnorm_drastic,              4),
+   MAKE_CALL_METHOD(tnorm_fodor,                4),
+   MAKE_CALL_METHOD(tnorm_hamacher,             5),
+   MAKE_CALL_METHOD(tnorm_frank,                5),
+   MAKE_CALL_METHOD(tnorm_yager,                5),
+   MAKE_CALL_METHOD(tnorm_schweizersklar,       5),
+   MAKE_CALL_METHOD(tnorm_dombi,                5),
+
+   MAKE_CALL_METHOD(tconorm_minimum,            4),
+   MAKE_CALL_METHOD(tconorm_product,            4),
+   MAKE_CALL_METHOD(tconorm_lukasiewicz,        4),
+   MAKE_CALL_METHOD(tconorm_drastic,            4),
+   MAKE_CALL_METHOD(tconorm_fodor,              4),
+   MAKE_CALL_METHOD(tconorm_hamacher,           5),
+   MAKE_CALL_METHOD(tconorm_frank,              5),
+   MAKE_CALL_METHOD(tconorm_yager,              5),
+   MAKE_CALL_METHOD(tconorm_schweizersklar,     5),
+   MAKE_CALL_METHOD(tconorm_dombi,              5),
+
+   MAKE_CALL_METHOD(fnegation_classic,          2),
+   MAKE_CALL_METHOD(fnegation_yager,            2),
+   MAKE_CALL_METHOD(fnegation_minimal,          2),
+   MAKE_CALL_METHOD(fnegation_maximal,          2),
+
+   MAKE_CALL_METHOD(fimplication_maximal,       4),
+   MAKE_CALL_METHOD(fimplication_minimal,       4),
+   MAKE_CALL_METHOD(fimplication_kleene,        4),
+   MAKE_CALL_METHOD(fimplication_lukasiewicz,   4),
+   MAKE_CALL_METHOD(fimplication_reichenbach,   4),
+   MAKE_CALL_METHOD(fimplication_fodor,         4),
+   MAKE_CALL_METHOD(fimplication_goguen,        4),
+   MAKE_CALL_METHOD(fimplication_goedel,        4),
+   MAKE_CALL_METHOD(fimplication_rescher,       4),
+   MAKE_CALL_METHOD(fimplication_weber,         4),
+   MAKE_CALL_METHOD(fimplication_yager,         4),
+   MAKE_CALL_METHOD(fimplication_r_hamacher,    5),
+   MAKE_CALL_METHOD(fimplication_r_frank,       5),
+   MAKE_CALL_METHOD(fimplication_r_yager,       5),
+   MAKE_CALL_METHOD(fimplication_r_schweizersklar,5),
+   MAKE_CALL_METHOD(fimplication_r_dombi,       5),
+   MAKE_CALL_METHOD(fuzzylogic_program_compile, 2),
+   MAKE_CALL_METHOD(fuzzylogic_program_eval,    5),
+   MAKE_CALL_METHOD(fuzzylogic_quantized,       5),
 
    // the list must be NULL-terminated:
    {NULL,                           NULL,       0}
@@ -75,6 +75,12 @@ using namespace std;
 #define MSG__ARG_EXPECTED_NOT_NA \
    "missing value in argument `%s` is not supported"
 
+#define MSG__ARG_EXPECTED_FINITE \
+   "all elements in `%s` should be finite"
+
+#define MSG__ARG_EXPECTED_INTEGER_VALUES \
+   "all elements in `%s` should be integers"
+
 #define MSG__ARG_EXPECTED_NOT_EMPTY \
    "argument `%s` should be a non-empty vector"
 
@@ -117,6 +123,9 @@ using namespace std;
 #define MSG__EXPECTED_ACYCLIC \
    "%s should be acyclic"
 
+#define MSG__ARG_EXPECTED_DOUBLE_N \
+   "argument `%s` should be a numeric vector of type double and length %.0f"
+
 struct double2 {
    double v1;
    double v2;
@@ -137,6 +146,7 @@ void check_range(double* x, double n, double xmin, double xmax, const char* argn
 SEXP prepare_arg_numeric(SEXP x, const char* argname);
 SEXP prepare_arg_numeric_sorted_dec(SEXP x, const char* argname);
 SEXP prepare_arg_numeric_sorted_inc(SEXP x, const char* argname);
+SEXP prepare_arg_numeric_partially_sorted_inc(SEXP x, R_len_t from, R_len_t to, const char* argname);
 
 SEXP prepare_arg_string(SEXP x, const char* argname);
 SEXP prepare_arg_double(SEXP x, const char* argname);
@@ -155,6 +165,13 @@ SEXP index_maxprod(SEXP x);
 SEXP index_w(SEXP x);
 SEXP index_rp(SEXP x, SEXP p);
 SEXP index_lp(SEXP x, SEXP p);
+SEXP index_stream(SEXP infile, SEXP outfile, SEXP op, SEXP p,
+   SEXP format, SEXP chunk_size);
+SEXP citation_store_write(SEXP x, SEXP names, SEXP file, SEXP type);
+SEXP citation_store_open(SEXP file);
+SEXP citation_store_close(SEXP store);
+SEXP citation_store_authors(SEXP store);
+SEXP citation_store_index(SEXP store, SEXP op, SEXP p);
 
 SEXP owa(SEXP x, SEXP w);
 SEXP wam(SEXP x, SEXP w);
@@ -163,7 +180,27 @@ SEXP wmax(SEXP x, SEXP w);
 SEXP owmin(SEXP x, SEXP w);
 SEXP wmin(SEXP x, SEXP w);
 
+/* elements of the list returned by owa_weights_prepare() */
+#define OWA_WEIGHTS_W        0
+#define OWA_WEIGHTS_WNORM    1
+#define OWA_WEIGHTS_CUMSUM   2
+#define OWA_WEIGHTS_SUPPORT  3
+#define OWA_WEIGHTS_ORNESS   4
+#define OWA_WEIGHTS_ENTROPY  5
+#define OWA_WEIGHTS_D2OWA    6
+#define OWA_WEIGHTS_NELEM    7
+
+SEXP owa_weights_prepare(SEXP w);
+bool __owa_weights_check(SEXP w); // internal
+
 SEXP d2owa_checkwts(SEXP w);
+SEXP d2owa(SEXP x, SEXP w);
+double __d2owa(double* x, const double* w, double ws, R_len_t n); // internal
+bool __d2owa_checkwts(const double* wd, R_len_t wn,
+   R_len_t* vp=NULL, R_len_t* vi=NULL); // internal
+
+SEXP aggregate_grouped(SEXP x, SEXP g, SEXP ngroups, SEXP op,
+   SEXP w, SEXP widx, SEXP p);
 
 SEXP check_comonotonicity(SEXP x, SEXP y, SEXP incompatible_lengths);
 SEXP pord_weakdom(SEXP x, SEXP y);
@@ -195,82 +232,69 @@ SEXP rel_reduction_transitive(SEXP x);
 SEXP rel_reduction_hasse(SEXP x);
 
 SEXP exp_test_statistic(SEXP x);
+SEXP exp_test_ad(SEXP x, SEXP s, SEXP offsets);
+SEXP exp_test_ad_simulate(SEXP n, SEXP R, SEXP nthreads);
+SEXP pareto2_test_f_simulate(SEXP nx, SEXP ny, SEXP R, SEXP nthreads);
 SEXP ppareto2(SEXP q, SEXP k, SEXP s, SEXP lower_tail);
-
-
-#define macro_apply_binaryop_x_y(op) \
-   x = PROTECT(prepare_arg_double(x, "x")); \
-   y = PROTECT(prepare_arg_double(y, "y")); \
-   R_len_t x_length = LENGTH(x);   \
-   R_len_t y_length = LENGTH(y);   \
-   double* x_tab = REAL(x);        \
-   double* y_tab = REAL(y);        \
-   if (x_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");  \
-   if (y_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "y");  \
-   if (x_length != y_length)                             \
-      Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "y"); \
-   SEXP res;                                             \
-   PROTECT(res = Rf_allocVector(REALSXP, x_length));     \
-   double* res_tab = REAL(res);                          \
-   for (R_len_t i=0; i<x_length; ++i) {                  \
-      if (ISNA(x_tab[i]) || ISNA(y_tab[i]))              \
-         res_tab[i] = NA_REAL;                           \
-      else if (x_tab[i] < 0.0 || x_tab[i] > 1.0)         \
-         Rf_error(MSG__ARG_NOT_IN_AB, "x", 0.0, 1.0);    \
-      else if (y_tab[i] < 0.0 || y_tab[i] > 1.0)         \
-         Rf_error(MSG__ARG_NOT_IN_AB, "y", 0.0, 1.0);    \
-      else                                               \
-         res_tab[i] = (op);                              \
-   }                                                     \
-   UNPROTECT(3);                                         \
-   return res;
-
-#define macro_apply_unaryop_x(op)  \
-   x = PROTECT(prepare_arg_double(x, "x")); \
-   R_len_t x_length = LENGTH(x);   \
-   double* x_tab = REAL(x);        \
-   if (x_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");  \
-   SEXP res;                                             \
-   PROTECT(res = Rf_allocVector(REALSXP, x_length));     \
-   double* res_tab = REAL(res);                          \
-   for (R_len_t i=0; i<x_length; ++i) {                  \
-      if (ISNA(x_tab[i]))                                \
-         res_tab[i] = NA_REAL;                           \
-      else if (x_tab[i] < 0.0 || x_tab[i] > 1.0)         \
-         Rf_error(MSG__ARG_NOT_IN_AB, "x", 0.0, 1.0);    \
-      else                                               \
-         res_tab[i] = (op);                              \
-   }                                                     \
-   UNPROTECT(2);                                         \
-   return res;
-
-SEXP tnorm_minimum(SEXP x, SEXP y);
-SEXP tnorm_lukasiewicz(SEXP x, SEXP y);
-SEXP tnorm_fodor(SEXP x, SEXP y);
-SEXP tnorm_product(SEXP x, SEXP y);
-SEXP tnorm_drastic(SEXP x, SEXP y);
-
-SEXP tconorm_minimum(SEXP x, SEXP y);
-SEXP tconorm_lukasiewicz(SEXP x, SEXP y);
-SEXP tconorm_fodor(SEXP x, SEXP y);
-SEXP tconorm_product(SEXP x, SEXP y);
-SEXP tconorm_drastic(SEXP x, SEXP y);
-
-SEXP fnegation_classic(SEXP x);
-SEXP fnegation_yager(SEXP x);
-SEXP fnegation_minimal(SEXP x);
-SEXP fnegation_maximal(SEXP x);
-
-SEXP fimplication_minimal(SEXP x, SEXP y);
-SEXP fimplication_maximal(SEXP x, SEXP y);
-SEXP fimplication_kleene(SEXP x, SEXP y);
-SEXP fimplication_lukasiewicz(SEXP x, SEXP y);
-SEXP fimplication_reichenbach(SEXP x, SEXP y);
-SEXP fimplication_fodor(SEXP x, SEXP y);
-SEXP fimplication_goguen(SEXP x, SEXP y);
-SEXP fimplication_goedel(SEXP x, SEXP y);
-SEXP fimplication_rescher(SEXP x, SEXP y);
-SEXP fimplication_weber(SEXP x, SEXP y);
-SEXP fimplication_yager(SEXP x, SEXP y);
+SEXP dpareto2(SEXP x, SEXP k, SEXP s);
+SEXP qpareto2(SEXP p, SEXP k, SEXP s, SEXP lower_tail);
+SEXP rpareto2(SEXP n, SEXP k, SEXP s, SEXP rng, SEXP nthreads);
+SEXP pdpareto2(SEXP q, SEXP k, SEXP s, SEXP lower_tail);
+SEXP ddpareto2(SEXP x, SEXP k, SEXP s);
+SEXP qdpareto2(SEXP p, SEXP k, SEXP s, SEXP lower_tail);
+SEXP rdpareto2(SEXP n, SEXP k, SEXP s, SEXP rng, SEXP nthreads);
+SEXP pareto2_estimate_mle(SEXP x, SEXP s, SEXP smin, SEXP smax, SEXP tol, SEXP offsets);
+SEXP pareto2_estimate_mmse(SEXP x, SEXP offsets);
+SEXP dpareto2_estimate_mle(SEXP x, SEXP k0, SEXP s0, SEXP kmin, SEXP smin,
+   SEXP kmax, SEXP smax, SEXP offsets);
+
+
+SEXP tnorm_minimum(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tnorm_lukasiewicz(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tnorm_fodor(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tnorm_product(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tnorm_drastic(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tnorm_hamacher(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tnorm_frank(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tnorm_yager(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tnorm_schweizersklar(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tnorm_dombi(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+
+SEXP tconorm_minimum(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tconorm_lukasiewicz(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tconorm_fodor(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tconorm_product(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tconorm_drastic(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP tconorm_hamacher(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tconorm_frank(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tconorm_yager(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tconorm_schweizersklar(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP tconorm_dombi(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+
+SEXP fnegation_classic(SEXP x, SEXP out);
+SEXP fnegation_yager(SEXP x, SEXP out);
+SEXP fnegation_minimal(SEXP x, SEXP out);
+SEXP fnegation_maximal(SEXP x, SEXP out);
+
+SEXP fimplication_minimal(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_maximal(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_kleene(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_lukasiewicz(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_reichenbach(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_fodor(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_goguen(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_goedel(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_rescher(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_weber(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_yager(SEXP x, SEXP y, SEXP outer, SEXP out);
+SEXP fimplication_r_hamacher(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP fimplication_r_frank(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP fimplication_r_yager(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP fimplication_r_schweizersklar(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+SEXP fimplication_r_dombi(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out);
+
+SEXP fuzzylogic_program_compile(SEXP op, SEXP param);
+SEXP fuzzylogic_program_eval(SEXP code, SEXP arg, SEXP param, SEXP data, SEXP out);
+SEXP fuzzylogic_quantized(SEXP connective, SEXP x, SEXP y, SEXP lambda, SEXP levels);
 
 #endif
@@ -21,21 +21,62 @@
 
 
 #include "agop.h"
+#include "summation.h"
 
 
 
 
 
+/** Get the indices of the first and the last nonzero weight [internal]
+ *
+ * @param w numeric or prepared weights, see owa_weights_prepare()
+ * @param from [out] 0-based index
+ * @param to [out] 0-based index
+ * @return false if all the weights should be considered
+ */
+static bool __owa_weights_support(SEXP w, R_len_t* from, R_len_t* to)
+{
+   if (__owa_weights_check(w)) {
+      SEXP support = VECTOR_ELT(w, OWA_WEIGHTS_SUPPORT);
+      if (Rf_isNull(support)) return false;
+      *from = INTEGER(support)[0]-1;
+      *to   = INTEGER(support)[1]-1;
+      return true;
+   }
+
+   if (!Rf_isReal(w)) return false; // will be coerced by wam()
+   R_len_t n = LENGTH(w);
+   const double* w_tab = REAL(w);
+   R_len_t i = 0;
+   while (i < n && w_tab[i] == 0.0) ++i; // NaNs are nonzero
+   if (i == n) return false;
+   R_len_t j = n-1;
+   while (w_tab[j] == 0.0) --j;
+   *from = i;
+   *to   = j;
+   return true;
+}
+
+
+
 /** OWA operator
+ *
+ * Only the order statistics corresponding to nonzero weights
+ * are determined, e.g., for trimmed means or medians
+ * this takes O(n + k log k) instead of O(n log n) time.
  *
  * @param x numeric
- * @param w numeric
+ * @param w numeric or prepared weights, see owa_weights_prepare()
  * @return numeric of length 1
  */
 SEXP owa(SEXP x, SEXP w)
 {
    SEXP res;
-   x   = PROTECT(prepare_arg_numeric_sorted_inc(x, "x"));
+   R_len_t from, to;
+   if (__owa_weights_support(w, &from, &to))
+      x = PROTECT(prepare_arg_numeric_partially_sorted_inc(x, from, to, "x"));
+   else
+      x = PROTECT(prepare_arg_numeric_sorted_inc(x, "x"));
    res = PROTECT(wam(x, w));
    UNPROTECT(2);
    return res;
@@ -46,7 +87,7 @@ SEXP owa(SEXP x, SEXP w)
 /** OWMax operator
  *
  * @param x numeric
- * @param w numeric
+ * @param w numeric or prepared weights, see owa_weights_prepare()
  * @return numeric of length 1
  */
 SEXP owmax(SEXP x, SEXP w)
@@ -64,7 +105,7 @@ SEXP owmax(SEXP x, SEXP w)
 /** OWMin operator
  *
  * @param x numeric
- * @param w numeric
+ * @param w numeric or prepared weights, see owa_weights_prepare()
  * @return numeric of length 1
  */
 SEXP owmin(SEXP x, SEXP w)
@@ -79,14 +120,52 @@ SEXP owmin(SEXP x, SEXP w)
 
 
 
+/** WAM operator with prepared weights [internal]
+ *
+ * @param x numeric
+ * @param w prepared weights, see owa_weights_prepare()
+ * @return numeric of length 1
+ */
+static SEXP __wam_prepared(SEXP x, SEXP w)
+{
+   SEXP wnorm = VECTOR_ELT(w, OWA_WEIGHTS_WNORM);
+   if (Rf_isNull(wnorm))
+      Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
+
+   x = PROTECT(prepare_arg_numeric(x, "x"));
+
+   R_len_t x_length = LENGTH(x);
+   double* x_tab = REAL(x);
+   const double* w_tab = REAL(wnorm);
+
+   if (x_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
+
+   if (ISNA(x_tab[0])) {
+      UNPROTECT(1);
+      return Rf_ScalarReal(NA_REAL);
+   }
+   if (x_length != LENGTH(wnorm))
+      Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "w");
+
+   double ret_val = sum_terms(summation_term_wx(w_tab, x_tab), x_length, summation_mode_get());
+
+   UNPROTECT(1);
+   return Rf_ScalarReal(ret_val);
+}
+
+
+
 /** WAM operator
  *
  * @param x numeric
- * @param w numeric
+ * @param w numeric or prepared weights, see owa_weights_prepare()
  * @return numeric of length 1
  */
 SEXP wam(SEXP x, SEXP w)
 {
+   if (__owa_weights_check(w))
+      return __wam_prepared(x, w);
+
    x = PROTECT(prepare_arg_numeric(x, "x"));
    w = PROTECT(prepare_arg_numeric(w, "w"));
 
@@ -106,14 +185,15 @@ SEXP wam(SEXP x, SEXP w)
       Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "w");
 
 
-   double w_sum = 0.0;
-   double ret_val = 0.0;
-   for (R_len_t i=0; i<x_length; ++i) {
-      if (w_tab[i] < 0)
-         Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
-      w_sum = w_sum + w_tab[i];
-      ret_val += w_tab[i]*x_tab[i];
-   }
+   bool w_neg = false;
+   for (R_len_t i=0; i<x_length; ++i)
+      w_neg |= (w_tab[i] < 0);
+   if (w_neg)
+      Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
+
+   summation_mode mode = summation_mode_get();
+   double w_sum   = sum_terms(summation_term_x(w_tab), x_length, mode);
+   double ret_val = sum_terms(summation_term_wx(w_tab, x_tab), x_length, mode);
 
    if (w_sum > 1.0+EPS || w_sum < 1.0-EPS)
       Rf_warning("elements in `w` does not sum up to 1; correcting.");
@@ -128,11 +208,14 @@ SEXP wam(SEXP x, SEXP w)
 /** WMax operator
  *
  * @param x numeric
- * @param w numeric
+ * @param w numeric or prepared weights, see owa_weights_prepare()
  * @return numeric of length 1
  */
 SEXP wmax(SEXP x, SEXP w)
 {
+   if (__owa_weights_check(w))
+      w = VECTOR_ELT(w, OWA_WEIGHTS_W);
+
    x = PROTECT(prepare_arg_numeric(x, "x"));
    w = PROTECT(prepare_arg_numeric(w, "w"));
 
@@ -166,11 +249,14 @@ SEXP wmax(SEXP x, SEXP w)
 /** WMin operator
  *
  * @param x numeric
- * @param w numeric
+ * @param w numeric or prepared weights, see owa_weights_prepare()
  * @return numeric of length 1
  */
 SEXP wmin(SEXP x, SEXP w)
 {
+   if (__owa_weights_check(w))
+      w = VECTOR_ELT(w, OWA_WEIGHTS_W);
+
    x = PROTECT(prepare_arg_numeric(x, "x"));
    w = PROTECT(prepare_arg_numeric(w, "w"));
 
@@ -200,6 +286,145 @@ SEXP wmin(SEXP x, SEXP w)
 }
 
 
+/** Is w a prepared weighting vector? [internal]
+ *
+ * As the object is a list that may have been modified in R,
+ * the types and lengths of all the elements accessed by
+ * the native code are checked here.
+ *
+ * @param w R object
+ * @return true if w is a valid object of class owa_weights
+ */
+bool __owa_weights_check(SEXP w)
+{
+   if (!Rf_inherits(w, "owa_weights"))
+      return false;
+   if (TYPEOF(w) != VECSXP || LENGTH(w) != OWA_WEIGHTS_NELEM)
+      Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   SEXP wv      = VECTOR_ELT(w, OWA_WEIGHTS_W);
+   SEXP wnorm   = VECTOR_ELT(w, OWA_WEIGHTS_WNORM);
+   SEXP cumsum  = VECTOR_ELT(w, OWA_WEIGHTS_CUMSUM);
+   SEXP support = VECTOR_ELT(w, OWA_WEIGHTS_SUPPORT);
+   SEXP d2owa   = VECTOR_ELT(w, OWA_WEIGHTS_D2OWA);
+
+   bool ok = (TYPEOF(wv) == REALSXP && LENGTH(wv) > 0);
+   ok = ok && (TYPEOF(d2owa) == LGLSXP && LENGTH(d2owa) == 1);
+   if (ok && Rf_isNull(wnorm))
+      ok = Rf_isNull(cumsum) && Rf_isNull(support);
+   else if (ok) {
+      R_len_t n = LENGTH(wv);
+      ok = (TYPEOF(wnorm) == REALSXP && LENGTH(wnorm) == n);
+      ok = ok && (TYPEOF(cumsum) == REALSXP && LENGTH(cumsum) == n);
+      ok = ok && (TYPEOF(support) == INTSXP && LENGTH(support) == 2);
+      ok = ok && (INTEGER(support)[0] >= 1 && INTEGER(support)[0] <= INTEGER(support)[1]
+         && INTEGER(support)[1] <= n); // NA_INTEGER < 1
+   }
+
+   if (!ok)
+      Rf_error("`w` is a corrupted owa_weights object; call owa_weights() again");
+   return true;
+}
+
+
+
+/** Prepare a weighting vector for the (O)WA, (O)WMax, (O)WMin,
+ *  and D2OWA operators
+ *
+ * All the validation and normalization is performed only here.
+ *
+ * @param w numeric
+ * @return list with elements w (as given), wnorm (w/sum(w) or NULL
+ *   if w cannot be used in WAM), cumsum (cumulative sums of wnorm),
+ *   support (the indices of the first and last nonzero weight),
+ *   orness, entropy, d2owa (result of d2owa_checkwts());
+ *   see the OWA_WEIGHTS_* constants
+ */
+SEXP owa_weights_prepare(SEXP w)
+{
+   w = PROTECT(prepare_arg_double(w, "w"));
+   R_len_t n = LENGTH(w);
+   double* w_tab = REAL(w);
+
+   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "w");
+
+   bool nonneg = true;
+   double w_sum = 0.0;
+   for (R_len_t i=0; i<n; ++i) {
+      if (ISNAN(w_tab[i]))
+         Rf_error(MSG__ARG_EXPECTED_NOT_NA, "w");
+      if (w_tab[i] < 0.0)
+         nonneg = false;
+      w_sum += w_tab[i];
+   }
+
+   SEXP wnorm = R_NilValue, cumsum = R_NilValue, support = R_NilValue;
+   double orness = NA_REAL, entropy = NA_REAL;
+   int d2owa_valid = NA_LOGICAL;
+   if (nonneg && w_sum > 0.0 && R_FINITE(w_sum)) {
+      wnorm  = PROTECT(Rf_allocVector(REALSXP, n));
+      cumsum = PROTECT(Rf_allocVector(REALSXP, n));
+      double* wnorm_tab  = REAL(wnorm);
+      double* cumsum_tab = REAL(cumsum);
+
+      R_len_t first = n, last = -1;
+      double cur = 0.0;
+      entropy = 0.0;
+      orness = 0.0;
+      for (R_len_t i=0; i<n; ++i) {
+         double wi = w_tab[i]/w_sum;
+         wnorm_tab[i] = wi;
+         cur += wi;
+         cumsum_tab[i] = cur;
+         if (wi > 0.0) {
+            if (first == n) first = i;
+            last = i;
+            entropy -= wi*log(wi);
+         }
+         orness += wi*i;
+      }
+      orness = (n > 1) ? orness/(n-1) : NA_REAL;
+
+      support = PROTECT(Rf_allocVector(INTSXP, 2));
+      INTEGER(support)[0] = first+1;
+      INTEGER(support)[1] = last+1;
+
+      if (n > 1)
+         d2owa_valid = __d2owa_checkwts(wnorm_tab, n);
+   }
+   else {
+      // placeholders so that the number of PROTECTs is fixed
+      PROTECT(wnorm);
+      PROTECT(cumsum);
+      PROTECT(support);
+   }
+
+   SEXP ret, names;
+   PROTECT(ret = Rf_allocVector(VECSXP, OWA_WEIGHTS_NELEM));
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_W,       w);
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_WNORM,   wnorm);
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_CUMSUM,  cumsum);
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_SUPPORT, support);
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_ORNESS,  Rf_ScalarReal(orness));
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_ENTROPY, Rf_ScalarReal(entropy));
+   SET_VECTOR_ELT(ret, OWA_WEIGHTS_D2OWA,   Rf_ScalarLogical(d2owa_valid));
+
+   PROTECT(names = Rf_allocVector(STRSXP, OWA_WEIGHTS_NELEM));
+   SET_STRING_ELT(names, OWA_WEIGHTS_W,       Rf_mkChar("w"));
+   SET_STRING_ELT(names, OWA_WEIGHTS_WNORM,   Rf_mkChar("wnorm"));
+   SET_STRING_ELT(names, OWA_WEIGHTS_CUMSUM,  Rf_mkChar("cumsum"));
+   SET_STRING_ELT(names, OWA_WEIGHTS_SUPPORT, Rf_mkChar("support"));
+   SET_STRING_ELT(names, OWA_WEIGHTS_ORNESS,  Rf_mkChar("orness"));
+   SET_STRING_ELT(names, OWA_WEIGHTS_ENTROPY, Rf_mkChar("entropy"));
+   SET_STRING_ELT(names, OWA_WEIGHTS_D2OWA,   Rf_mkChar("d2owa"));
+   Rf_setAttrib(ret, R_NamesSymbol, names);
+
+   UNPROTECT(6);
+   return ret;
+}
+
+
+
 ///** Function to compute the S-statistic for kappa=id, O(log n) time.
 // *  @param x vector of numbers, 0<=x[i]<=1, sorted non-increasingly
 // *  @param n pointer to the number of observations
@@ -21,6 +21,93 @@
 
 
 #include "agop.h"
+#include <stdint.h>
+
+
+
+/** Check weights for the D2OWA operator [internal]
+ *
+ * The weights are valid iff f(p, i) >= 0 for all 1 <= p < i < wn
+ * such that (i-p)^2 >= 4p(wn-i), where
+ * f(p, i) = (wn-i)(1-zeta_p) + (wn zeta_p-wn+p) zeta_i.
+ *
+ * As zeta is non-increasing, f(p, i) can only be negative
+ * if c_p = wn zeta_p-wn+p < 0 and zeta_i > 0,
+ * and then f(p, i) < 0 iff g(i) = (wn-i)/zeta_i < wn-p/(1-zeta_p).
+ * Moreover, for fixed p, the constraint holds for all i in
+ * [i0(p), wn-1], where i0(p) is approximately 2sqrt(p wn)-p.
+ * Therefore, it suffices to compare against the suffix minima of g,
+ * which gives O(wn) time instead of O(wn^2).
+ *
+ * @param wd non-negative, NA-free weights
+ * @param wn length of wd, wn >= 2
+ * @param vp [out] if not NULL and the weights are invalid,
+ *    the first (in lexicographic order, with decreasing i)
+ *    violating p is stored here
+ * @param vi [out] the corresponding i
+ * @return true if wd generates a spread measure
+ */
+bool __d2owa_checkwts(const double* wd, R_len_t wn, R_len_t* vp, R_len_t* vi)
+{
+   double ws = 0.0;
+   for (R_len_t i=0; i<wn; ++i)
+      ws += wd[i];
+
+   vector<double> zeta(wn-1);
+   zeta[wn-2] = wd[wn-1]/ws;
+   for (int i=wn-3; i>=0; --i)
+      zeta[i] = min(1.0, zeta[i+1] + wd[i+1]/ws); // guard against round-off
+
+   // gmin[i-1] = argmin of g(j) for j=i,...,wn-1
+   vector<R_len_t> gmin(wn-1);
+   double gbest = R_PosInf;
+   R_len_t ibest = wn-1;
+   for (R_len_t i=wn-1; i>=1; --i) {
+      if (zeta[i-1] > 0.0) {
+         double g = (wn-i)/zeta[i-1];
+         if (g < gbest) {
+            gbest = g;
+            ibest = i;
+         }
+      }
+      gmin[i-1] = ibest;
+   }
+
+   for (R_len_t p=1; p<=wn-2; ++p) {
+      double zp = zeta[p-1];
+      if (wn*zp-wn+p >= 0.0)
+         continue; // f(p, i) >= 0 for all i
+
+      // the smallest i > p such that (i-p)^2 >= 4p(wn-i)
+      R_len_t i0 = (R_len_t)ceil(2.0*sqrt((double)p*wn)-p);
+      if (i0 < p+1) i0 = p+1;
+      while (i0 > p+1 &&
+            (int64_t)(i0-1-p)*(i0-1-p) >= (int64_t)4*p*(wn-i0+1))
+         --i0;
+      while (i0 <= wn-1 &&
+            (int64_t)(i0-p)*(i0-p) < (int64_t)4*p*(wn-i0))
+         ++i0;
+      if (i0 > wn-1)
+         continue;
+
+      R_len_t i = gmin[i0-1];
+      if ((wn-i)*(1.0-zp) + (wn*zp-wn+p)*zeta[i-1] >= 0.0)
+         continue;
+
+      if (vp && vi) {
+         // find the first violating i (as in a naive loop)
+         for (i=wn-1; i>=i0; --i) {
+            if ((wn-i)*(1.0-zp) + (wn*zp-wn+p)*zeta[i-1] < 0.0)
+               break;
+         }
+         *vp = p;
+         *vi = i;
+      }
+      return false;
+   }
+
+   return true;
+}
 
 
 
@@ -40,29 +127,174 @@ SEXP d2owa_checkwts(SEXP w) {
       return Rf_ScalarLogical(NA_LOGICAL);
    }
 
-   double ws = 0.0;
    for (R_len_t i=0; i<wn; ++i) {
       if (wd[i] < 0)
          Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
-      ws += wd[i];
    }
 
-   vector<double> zeta(wn-1);
-   zeta[wn-2] = wd[wn-1]/ws;
-   for (int i=wn-3; i>=0; --i)
-      zeta[i] = zeta[i+1] + wd[i+1]/ws;
-
-   for (int p=1; p<=wn-2; ++p) {
-      for (int i=wn-1; i>p; --i) {
-         if ((i-p)*(i-p) < 4*p*(wn-i))
-            break;
-         if ((wn-i)*(1.0-zeta[p-1]) + (wn*zeta[p-1]-wn+p)*zeta[i-1] < 0.0) {
-            UNPROTECT(1);
-            return Rf_ScalarLogical(FALSE);
-         }
+   R_len_t vp, vi;
+   if (__d2owa_checkwts(wd, wn, &vp, &vi)) {
+      UNPROTECT(1);
+      return Rf_ScalarLogical(TRUE);
+   }
+
+   SEXP ret, violation, names;
+   PROTECT(ret = Rf_ScalarLogical(FALSE));
+   PROTECT(violation = Rf_allocVector(INTSXP, 2));
+   INTEGER(violation)[0] = vp;
+   INTEGER(violation)[1] = vi;
+   PROTECT(names = Rf_allocVector(STRSXP, 2));
+   SET_STRING_ELT(names, 0, Rf_mkChar("p"));
+   SET_STRING_ELT(names, 1, Rf_mkChar("i"));
+   Rf_setAttrib(violation, R_NamesSymbol, names);
+   Rf_setAttrib(ret, Rf_install("violation"), violation);
+   UNPROTECT(4);
+   return ret;
+}
+
+
+
+/* The weighting vector most recently accepted by d2owa();
+ * comparing weights is much cheaper than checking them again,
+ * and d2owa() is typically called many times with the same w.
+ */
+static vector<double> __d2owa_valid_wts;
+
+
+
+/** Check weights for the D2OWA operator, with caching [internal]
+ *
+ * Throws an error if wd does not generate a spread measure.
+ *
+ * @param wd non-negative, NA-free weights
+ * @param wn length of wd, wn >= 2
+ */
+static void __d2owa_checkwts_cached(const double* wd, R_len_t wn)
+{
+   if ((R_len_t)__d2owa_valid_wts.size() == wn &&
+         std::equal(wd, wd+wn, __d2owa_valid_wts.begin()))
+      return;
+
+   if (!__d2owa_checkwts(wd, wn))
+      Rf_error("given weighting vector does not generate a spread measure");
+
+   __d2owa_valid_wts.assign(wd, wd+wn);
+}
+
+
+
+/** Compute the D2OWA operator
+ *
+ * The OWA operator and the squared deviations from it are
+ * computed in a single pass over the sorted data.
+ * The data are shifted by their median to avoid catastrophic
+ * cancellation.
+ *
+ * @param x [in/out] NA-free data; will be sorted
+ * @param w weights
+ * @param ws sum of weights
+ * @param n length of x and w, n >= 1
+ * @return value of the D2OWA operator
+ */
+double __d2owa(double* x, const double* w, double ws, R_len_t n)
+{
+   std::sort(x, x+n);
+   double c = x[n/2];
+
+   double sw = 0.0, s1 = 0.0, s2 = 0.0;
+   for (R_len_t i=0; i<n; ++i) {
+      double d = x[i]-c;
+      sw += w[i]*d;
+      s1 += d;
+      s2 += d*d;
+   }
+
+   double a = sw/ws; // owa(x, w)-c
+   double v = (s2-2.0*a*s1)/(double)n+a*a; // mean((x-owa(x, w))^2)
+   return sqrt(max(v, 0.0));
+}
+
+
+
+/** D2OWA operator
+ *
+ * If x is a matrix, the operator is applied on each column.
+ *
+ * @param x numeric vector or matrix
+ * @param w numeric or prepared weights, see owa_weights_prepare()
+ * @return numeric vector of length 1 or ncol(x)
+ */
+SEXP d2owa(SEXP x, SEXP w)
+{
+   SEXP w_prepared = R_NilValue;
+   if (__owa_weights_check(w)) {
+      w_prepared = w;
+      w = VECTOR_ELT(w_prepared, OWA_WEIGHTS_WNORM);
+      if (Rf_isNull(w)) Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
+   }
+
+   x = PROTECT(prepare_arg_double(x, "x"));
+   w = PROTECT(prepare_arg_double(w, "w"));
+
+   R_len_t n = LENGTH(x);
+   R_len_t m = 1;
+   bool is_matrix = Rf_isMatrix(x);
+   if (is_matrix) {
+      n = Rf_nrows(x);
+      m = Rf_ncols(x);
+   }
+
+   R_len_t wn = LENGTH(w);
+   double* wd = REAL(w);
+   if (wn <= 1) Rf_error(MSG_ARG_TOO_SHORT, "w");
+   if (n != wn) Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "w");
+
+   double ws = 0.0;
+   if (!Rf_isNull(w_prepared)) {
+      // normalized and validated by owa_weights_prepare()
+      ws = 1.0;
+      if (LOGICAL(VECTOR_ELT(w_prepared, OWA_WEIGHTS_D2OWA))[0] != TRUE)
+         Rf_error("given weighting vector does not generate a spread measure");
+      // the flag could have been set in R; re-checking is cheap
+      // as the result is cached
+      __d2owa_checkwts_cached(wd, wn);
+   }
+   else {
+      for (R_len_t i=0; i<wn; ++i) {
+         if (ISNAN(wd[i]))
+            Rf_error(MSG__ARG_EXPECTED_NOT_NA, "w");
+         if (wd[i] < 0)
+            Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
+         ws += wd[i];
+      }
+
+      __d2owa_checkwts_cached(wd, wn);
+
+      if (ws > 1.0+EPS || ws < 1.0-EPS)
+         Rf_warning("elements in `w` does not sum up to 1; correcting.");
+   }
+
+   SEXP ret;
+   PROTECT(ret = Rf_allocVector(REALSXP, m));
+   double* pret = REAL(ret);
+   const double* xd = REAL(x);
+   double* buf = (double*)R_alloc(n, sizeof(double));
+   for (R_len_t j=0; j<m; ++j) {
+      const double* xj = xd+(size_t)j*n;
+      bool has_na = false;
+      for (R_len_t i=0; i<n; ++i) {
+         if (ISNAN(xj[i])) { has_na = true; break; }
+         buf[i] = xj[i];
       }
+      pret[j] = has_na ? NA_REAL : __d2owa(buf, wd, ws, n);
+   }
+
+   if (is_matrix) {
+      SEXP dimnames = Rf_getAttrib(x, R_DimNamesSymbol);
+      if (!Rf_isNull(dimnames) && !Rf_isNull(VECTOR_ELT(dimnames, 1)))
+         Rf_setAttrib(ret, R_NamesSymbol, VECTOR_ELT(dimnames, 1));
    }
 
-   UNPROTECT(1);
-   return Rf_ScalarLogical(TRUE);
+   UNPROTECT(3);
+   return ret;
 }
@@ -0,0 +1,263 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "agops_impact.h"
+#include <cstring>
+#include <functional>
+
+
+
+/* Operators supported by aggregate_grouped() */
+enum __grouped_op {
+   GROUPED_OWA, GROUPED_WAM, GROUPED_OWMAX, GROUPED_OWMIN,
+   GROUPED_WMAX, GROUPED_WMIN, GROUPED_D2OWA,
+   GROUPED_INDEX_H, GROUPED_INDEX_G, GROUPED_INDEX_G_ZI,
+   GROUPED_INDEX_MAXPROD, GROUPED_INDEX_W,
+   GROUPED_INDEX_RP, GROUPED_INDEX_LP,
+   GROUPED_NUM_OPS
+};
+
+static const char* __grouped_op_names[GROUPED_NUM_OPS] = {
+   "owa", "wam", "owmax", "owmin",
+   "wmax", "wmin", "d2owa",
+   "index_h", "index_g", "index_g_zi",
+   "index_maxprod", "index_w",
+   "index_rp", "index_lp"
+};
+
+
+
+/** Apply an aggregation operator on each group of observations
+ *
+ * The observations are sorted by group (stable counting sort, O(n+G))
+ * and then each group is sorted by value, if needed, in place.
+ * This is much faster than calling, e.g., owa() via tapply()
+ * for many small groups.
+ *
+ * The (O)WA operators and d2owa use the weights normalized
+ * so that they sum up to 1 (no warning is generated).
+ *
+ * @param x numeric vector
+ * @param g integer vector of the same length as x, group codes
+ *    in 1..ngroups; observations with g == NA are ignored
+ * @param ngroups number of groups, G
+ * @param op operator name, see __grouped_op_names
+ * @param w NULL (for the impact indices), a list of numeric vectors,
+ *    or (for wam, wmax, wmin only) a numeric vector of the same length as x
+ * @param widx if w is a list, integer vector of length G: 1-based indices
+ *    of the weighting vectors to use for each group
+ * @param p for index_rp and index_lp, see index_rp()
+ * @return numeric vector of length G, NA for empty groups or groups
+ *    with missing values; for index_lp, a G*2 matrix
+ */
+SEXP aggregate_grouped(SEXP x, SEXP g, SEXP ngroups, SEXP op,
+   SEXP w, SEXP widx, SEXP p)
+{
+   x = PROTECT(prepare_arg_double(x, "x"));
+   g = PROTECT(prepare_arg_integer(g, "g"));
+   ngroups = PROTECT(prepare_arg_integer_1(ngroups, "ngroups"));
+   op = PROTECT(prepare_arg_string_1(op, "op"));
+
+   R_len_t n = LENGTH(x);
+   if (LENGTH(g) != n) Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "g");
+   R_len_t G = INTEGER(ngroups)[0];
+   if (G == NA_INTEGER || G < 0) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   int opi = 0;
+   const char* op_name = CHAR(STRING_ELT(op, 0));
+   while (opi < GROUPED_NUM_OPS && strcmp(op_name, __grouped_op_names[opi]))
+      ++opi;
+   if (opi == GROUPED_NUM_OPS) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   bool is_index = (opi >= GROUPED_INDEX_H);
+   bool is_normalized = (opi == GROUPED_OWA || opi == GROUPED_WAM
+      || opi == GROUPED_D2OWA);
+   bool is_ordered = (opi == GROUPED_OWA || opi == GROUPED_OWMAX
+      || opi == GROUPED_OWMIN || opi == GROUPED_D2OWA);
+   bool w_per_obs = (!is_index && Rf_isReal(w));
+
+   double p_val = 1.0;
+   if (opi == GROUPED_INDEX_RP || opi == GROUPED_INDEX_LP)
+      p_val = __index_p_prepare(p);
+
+   const double* xd = REAL(x);
+   const int* gd = INTEGER(g);
+
+   // counting sort by group: group k occupies [start[k], start[k+1])
+   vector<R_len_t> start(G+1, 0);
+   for (R_len_t i=0; i<n; ++i) {
+      if (gd[i] == NA_INTEGER) continue;
+      if (gd[i] < 1 || gd[i] > G) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      ++start[gd[i]];
+   }
+   for (R_len_t k=0; k<G; ++k)
+      start[k+1] += start[k];
+
+   R_len_t m = start[G];
+   double* xs = (double*)R_alloc(m+1, sizeof(double));
+   double* ws = NULL;
+   vector<R_len_t> pos(start.begin(), start.end()-1);
+   if (w_per_obs) {
+      if (opi != GROUPED_WAM && opi != GROUPED_WMAX && opi != GROUPED_WMIN)
+         Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      if (LENGTH(w) != n) Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "w");
+      const double* wd = REAL(w);
+      ws = (double*)R_alloc(m+1, sizeof(double));
+      for (R_len_t i=0; i<n; ++i) {
+         if (gd[i] == NA_INTEGER) continue;
+         if (ISNAN(wd[i])) Rf_error(MSG__ARG_EXPECTED_NOT_NA, "w");
+         if (is_normalized && wd[i] < 0) Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
+         ws[pos[gd[i]-1]] = wd[i];
+         xs[pos[gd[i]-1]++] = xd[i];
+      }
+   }
+   else {
+      for (R_len_t i=0; i<n; ++i) {
+         if (gd[i] == NA_INTEGER) continue;
+         xs[pos[gd[i]-1]++] = xd[i];
+      }
+   }
+
+   // each distinct weighting vector is validated only once
+   R_len_t nw = 0;
+   vector<double> wsum;
+   const int* widxd = NULL;
+   if (!is_index && !w_per_obs) {
+      if (TYPEOF(w) != VECSXP) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      widx = PROTECT(prepare_arg_integer(widx, "widx"));
+      if (LENGTH(widx) != G) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      widxd = INTEGER(widx);
+      nw = LENGTH(w);
+      wsum.resize(nw, 0.0);
+      for (R_len_t j=0; j<nw; ++j) {
+         SEXP wj = VECTOR_ELT(w, j);
+         if (!Rf_isReal(wj)) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+         R_len_t wn = LENGTH(wj);
+         const double* wjd = REAL(wj);
+         for (R_len_t i=0; i<wn; ++i) {
+            if (ISNAN(wjd[i])) Rf_error(MSG__ARG_EXPECTED_NOT_NA, "w");
+            if (is_normalized && wjd[i] < 0) Rf_error(MSG__ARG_NOT_GE_A, "w", 0.0);
+            wsum[j] += wjd[i];
+         }
+         if (is_normalized && !(wsum[j] > 0.0))
+            Rf_error(MSG__ARG_NOT_GT_A, "sum(w)", 0.0);
+         if (opi == GROUPED_D2OWA && wn >= 2 && !__d2owa_checkwts(wjd, wn))
+            Rf_error("given weighting vector does not generate a spread measure");
+      }
+   }
+   else
+      PROTECT(widx = R_NilValue);
+
+   summation_mode mode = summation_mode_get();
+
+   SEXP ret;
+   if (opi == GROUPED_INDEX_LP)
+      PROTECT(ret = Rf_allocMatrix(REALSXP, G, 2));
+   else
+      PROTECT(ret = Rf_allocVector(REALSXP, G));
+   double* pret = REAL(ret);
+
+   for (R_len_t k=0; k<G; ++k) {
+      R_len_t nk = start[k+1]-start[k];
+      double* xk = xs+start[k];
+      double res = NA_REAL, res2 = NA_REAL;
+
+      bool has_na = (nk == 0);
+      for (R_len_t i=0; !has_na && i<nk; ++i)
+         has_na = ISNAN(xk[i]);
+
+      if (has_na) {
+         pret[k] = NA_REAL;
+         if (opi == GROUPED_INDEX_LP) pret[k+G] = NA_REAL;
+         continue;
+      }
+
+      const double* wk = NULL;
+      double wsumk = 1.0;
+      if (w_per_obs) {
+         wk = ws+start[k];
+         if (is_normalized) {
+            wsumk = sum_terms(summation_term_x(wk), nk, mode);
+            if (!(wsumk > 0.0)) Rf_error(MSG__ARG_NOT_GT_A, "sum(w)", 0.0);
+         }
+      }
+      else if (!is_index) {
+         R_len_t j = widxd[k];
+         if (j == NA_INTEGER || j < 1 || j > nw)
+            Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+         SEXP wj = VECTOR_ELT(w, j-1);
+         if (LENGTH(wj) != nk) Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "x", "w");
+         wk = REAL(wj);
+         wsumk = wsum[j-1];
+      }
+
+      if (is_ordered)
+         std::sort(xk, xk+nk);
+      else if (is_index) {
+         std::sort(xk, xk+nk, std::greater<double>());
+         if (xk[nk-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
+      }
+
+      switch (opi) {
+         case GROUPED_OWA:
+         case GROUPED_WAM:
+            res = sum_terms(summation_term_wx(wk, xk), nk, mode)/wsumk;
+            break;
+
+         case GROUPED_OWMAX:
+         case GROUPED_WMAX:
+            res = DBL_MIN;
+            for (R_len_t i=0; i<nk; ++i) {
+               double tmp = min(wk[i], xk[i]);
+               if (res < tmp) res = tmp;
+            }
+            break;
+
+         case GROUPED_OWMIN:
+         case GROUPED_WMIN:
+            res = DBL_MAX;
+            for (R_len_t i=0; i<nk; ++i) {
+               double tmp = max(wk[i], xk[i]);
+               if (res > tmp) res = tmp;
+            }
+            break;
+
+         case GROUPED_D2OWA:
+            res = (nk >= 2) ? __d2owa(xk, wk, wsumk, nk) : 0.0;
+            break;
+
+         default: {
+            double2 ab = __index_apply(__index_op_get(op_name), xk, nk, p_val, mode);
+            res = ab.v1;
+            res2 = ab.v2;
+            break;
+         }
+      }
+
+      pret[k] = res;
+      if (opi == GROUPED_INDEX_LP) pret[k+G] = res2;
+   }
+
+   UNPROTECT(6);
+   return ret;
+}
@@ -20,7 +20,8 @@
 
 
 
-#include "agop.h"
+#include "agops_impact.h"
+#include <cstring>
 
 
 /** Compute the h-index, O(n) time for sorted data
@@ -32,7 +33,23 @@
  * @param x numeric vector
  * @return real scalar (vector of length == 1)
  */
-SEXP index_h(SEXP x)
+double __index_h(const double* xd, R_len_t n)
+{
+   R_len_t i = 0;
+   while (i < n)	{
+   	if (xd[i] < (double)i+1) break;
+   	++i;
+   }
+   return (double) i;
+}
+
+
+/** Prepare the x argument of the impact functions [internal]
+ *
+ * @param x R object
+ * @return numeric vector, sorted non-increasingly, or NA
+ */
+static SEXP __index_prepare_x(SEXP x)
 {
    x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
 
@@ -40,21 +57,20 @@ SEXP index_h(SEXP x)
    if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
 
    double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(1);
-      return Rf_ScalarReal(NA_REAL);
-   }
+   if (!ISNA(xd[0]) && xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
 
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
+   UNPROTECT(1);
+   return x;
+}
 
-   R_len_t i = 0;
-   while (i < n)	{
-   	if (xd[i] < (double)i+1) break;
-   	++i;
-   }
 
+SEXP index_h(SEXP x)
+{
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   double ret = ISNA(xd[0]) ? NA_REAL : __index_h(xd, LENGTH(x));
    UNPROTECT(1);
-   return Rf_ScalarReal((double) i);
+   return Rf_ScalarReal(ret);
 }
 
 
@@ -67,31 +83,26 @@ SEXP index_h(SEXP x)
  *  @param x vector of non-negative reals, sorted non-increasingly
  *  @return scalar real
  */
-SEXP index_g(SEXP x)
+double __index_g(const double* xd, R_len_t n, summation_mode mode)
 {
-   x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
-
-   R_len_t n = LENGTH(x);
-   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
-
-   double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(1);
-      return Rf_ScalarReal(NA_REAL);
-   }
-
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
-
-   double sum = 0.0;
+   summation_running sum(mode);
    R_len_t i = 0;
    while (i < n)	{
-   	sum += xd[i];
-   	if (sum < (double)(i+1)*(double)(i+1)) break;
+   	sum.add(xd[i]);
+   	if (sum.get() < (double)(i+1)*(double)(i+1)) break;
    	++i;
    }
+   return (double) i;
+}
+
 
+SEXP index_g(SEXP x)
+{
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   double ret = ISNA(xd[0]) ? NA_REAL : __index_g(xd, LENGTH(x), summation_mode_get());
    UNPROTECT(1);
-   return Rf_ScalarReal((double) i);
+   return Rf_ScalarReal(ret);
 }
 
 
@@ -102,31 +113,26 @@ SEXP index_g(SEXP x)
  *  @param x vector of non-negative reals, sorted non-increasingly
  *  @return scalar real
  */
-SEXP index_g_zi(SEXP x)
+double __index_g_zi(const double* xd, R_len_t n, summation_mode mode)
 {
-   x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
-
-   R_len_t n = LENGTH(x);
-   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
-
-   double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(1);
-      return Rf_ScalarReal(NA_REAL);
-   }
-
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
-
-   double sum = 0.0;
+   summation_running sum(mode);
    R_len_t i = 0;
    while (TRUE)   {
-   	if (i < n) sum += xd[i];
-      if (sum < (double)(i+1)*(double)(i+1)) break;
+   	if (i < n) sum.add(xd[i]);
+      if (sum.get() < (double)(i+1)*(double)(i+1)) break;
    	++i;
    }
+   return (double) i;
+}
+
 
+SEXP index_g_zi(SEXP x)
+{
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   double ret = ISNA(xd[0]) ? NA_REAL : __index_g_zi(xd, LENGTH(x), summation_mode_get());
    UNPROTECT(1);
-   return Rf_ScalarReal((double) i);
+   return Rf_ScalarReal(ret);
 }
 
 
@@ -138,21 +144,8 @@ SEXP index_g_zi(SEXP x)
  *  @param x vector of non-negative reals, sorted non-increasingly
  *  @return scalar real
  */
-SEXP index_w(SEXP x)
+double __index_w(const double* xd, R_len_t n)
 {
-   x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
-
-   R_len_t n = LENGTH(x);
-   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
-
-   double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(1);
-      return Rf_ScalarReal(NA_REAL);
-   }
-
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
-
    R_len_t w = min(xd[0],(double)n);
    for (R_len_t i=1; i < n; ++i) {
       if (xd[i] < w-i) {
@@ -163,9 +156,17 @@ SEXP index_w(SEXP x)
          break;
       }
    }
+   return (double) w;
+}
+
 
+SEXP index_w(SEXP x)
+{
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   double ret = ISNA(xd[0]) ? NA_REAL : __index_w(xd, LENGTH(x));
    UNPROTECT(1);
-   return Rf_ScalarReal((double) w);
+   return Rf_ScalarReal(ret);
 }
 
 
@@ -177,28 +178,23 @@ SEXP index_w(SEXP x)
  * @param x numeric vector
  * @return real scalar
  */
-SEXP index_maxprod(SEXP x)
+double __index_maxprod(const double* xd, R_len_t n)
 {
-   x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
-
-   R_len_t n = LENGTH(x);
-   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
-
-   double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(1);
-      return Rf_ScalarReal(NA_REAL);
-   }
-
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
-
    double out = 0.0;
    for (R_len_t i = 0; i < n && xd[i] > 0; ++i)
       if (out < xd[i]*(double)(i+1))
          out = xd[i]*(double)(i+1);
+   return out;
+}
 
+
+SEXP index_maxprod(SEXP x)
+{
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   double ret = ISNA(xd[0]) ? NA_REAL : __index_maxprod(xd, LENGTH(x));
    UNPROTECT(1);
-   return Rf_ScalarReal(out);
+   return Rf_ScalarReal(ret);
 }
 
 
@@ -231,33 +227,50 @@ SEXP index_maxprod(SEXP x)
 
 
 
-/** Function to compute the r_p-index
+/** Prepare the p argument of index_rp() and index_lp() [internal]
  *
- *  @param x numeric
- *  @param p numeric, >=1, length 1
- *  @param single numeric
+ * @param p R object
+ * @return numeric vector with elements >= 1 (possibly Inf)
  */
-SEXP index_rp(SEXP x, SEXP p)
+static SEXP __index_p_prepare_vector(SEXP p)
+{
+   p = PROTECT(prepare_arg_numeric(p, "p"));
+   R_len_t np = LENGTH(p);
+   if (np <= 0) Rf_error(MSG_ARG_TOO_SHORT, "p");
+
+   const double* pd = REAL(p);
+   bool large = false;
+   for (R_len_t j=0; j<np; ++j) {
+      if (ISNA(pd[j]) || pd[j] < 1)
+         Rf_error("`p` should be >= 1");
+      if (R_FINITE(pd[j]) && pd[j] > 50)
+         large = true;
+   }
+
+   if (large)
+      Rf_warning("p is large but finite. possible accuracy problems.");
+
+   UNPROTECT(1);
+   return p;
+}
+
+
+
+double __index_p_prepare(SEXP p)
 {
    p = PROTECT(prepare_arg_numeric(p, "p"));
    if (LENGTH(p) != 1)
       Rf_error("`p` should be a single numeric value");
+   p = PROTECT(__index_p_prepare_vector(p));
    double p_val = REAL(p)[0];
-   if (ISNA(p_val) || p_val < 1)
-      Rf_error("`p` should be >= 1");
-
-   x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
-   R_len_t n = LENGTH(x);
-   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
+   UNPROTECT(2);
+   return p_val;
+}
 
-   double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(2);
-      return Rf_ScalarReal(NA_REAL);
-   }
 
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
 
+double __index_rp(const double* xd, R_len_t n, double p_val)
+{
    if (!R_FINITE(p_val))
    {
       // this is OWMax for w=1,2,3,....
@@ -266,86 +279,205 @@ SEXP index_rp(SEXP x, SEXP p)
          double tmp = min((double)(i+1), xd[i]);
          if (ret_val < tmp) ret_val = tmp;
       }
-      UNPROTECT(2);
-      return Rf_ScalarReal(ret_val);
+      return ret_val;
    }
    else {
-      if (p_val > 50)
-         Rf_warning("p is large but finite. possible accuracy problems.");
-
       double r2p = pow((double)n, p_val);
       R_len_t i;
 
    	for (i=0; i<n; ++i)
    	{
-   		double xip = pow(xd[i], p_val);
    		double ip  = pow((double)i, p_val);
+   		if (ip >= r2p) break; // ip increases, so r2p cannot decrease any more
+   		double xip = pow(xd[i], p_val);
    		if (r2p-ip > xip)
    			r2p = ip + xip;
    	}
 
-   	UNPROTECT(2);
-   	return Rf_ScalarReal(pow(r2p, 1.0/p_val));
+   	return pow(r2p, 1.0/p_val);
    }
 }
 
 
 
+/* Number of p values processed together by __index_rp_multi() */
+#define INDEX_RP_BLOCK 8
 
 
-/** internal **/
-double2 __index_lp_finite_getAB(double p, double ui, double vi, double uj, double vj)
+/** Compute the r_p-index for many p
+ *
+ * log(x_i) and log(i) are determined only once, and
+ * x_i^p = exp(p*log(x_i)) is computed in blocks of p values,
+ * which the compiler can vectorise.
+ *
+ * @param x non-negative, NA-free, sorted non-increasingly
+ * @param n length of x, n >= 1
+ * @param p values >= 1
+ * @param np length of p
+ * @param out [out] array of length np
+ */
+void __index_rp_multi(const double* x, R_len_t n, const double* p, R_len_t np, double* out)
 {
-   double uip = pow(ui,p);
-   double ujp = pow(uj,p);
-   double vip = pow(vi,p);
-   double vjp = pow(vj,p);
-   double c = uip*vjp-ujp*vip;
-   return double2(c/(vjp-vip), -c/(ujp-uip));
-}
+   vector<R_len_t> finite;
+   for (R_len_t j=0; j<np; ++j) {
+      if (R_FINITE(p[j])) finite.push_back(j);
+      else out[j] = __index_rp(x, n, p[j]);
+   }
 
+   // logarithms are computed lazily, as the loop usually stops early
+   vector<double> lx, li;
+   double ln = log((double)n);
 
-/** internal **/
-bool __index_lp_finite_testContains(double uk, double vk, double p, double ui, double vi, double uj, double vj)
-{
-   // check if L^p ellipse interpolating (ui,vi) and (uj,vj) contains (uk,vk)
-   double2 ab = __index_lp_finite_getAB(p,ui,vi,uj,vj);
-   return (ab.v2*(1.0 - pow(uk,p)/ab.v1) >= pow(vk,p));
+   for (size_t b=0; b<finite.size(); b+=INDEX_RP_BLOCK) {
+      R_len_t m = (R_len_t)min((size_t)INDEX_RP_BLOCK, finite.size()-b);
+      double pb[INDEX_RP_BLOCK], r2p[INDEX_RP_BLOCK];
+      for (R_len_t j=0; j<m; ++j) {
+         pb[j] = p[finite[b+j]];
+         r2p[j] = exp(pb[j]*ln);
+      }
+
+      for (R_len_t i=0; i<n; ++i) {
+         if (i == (R_len_t)lx.size()) {
+            lx.push_back(log(x[i]));
+            li.push_back(log((double)i));
+         }
+
+         bool active = false;
+         for (R_len_t j=0; j<m; ++j) {
+            double ip = exp(pb[j]*li[i]);
+            if (ip >= r2p[j]) continue;
+            active = true;
+            double xip = exp(pb[j]*lx[i]);
+            if (r2p[j]-ip > xip)
+               r2p[j] = ip + xip;
+         }
+         if (!active) break;
+      }
+
+      for (R_len_t j=0; j<m; ++j)
+         out[finite[b+j]] = pow(r2p[j], 1.0/pb[j]);
+   }
 }
 
 
-/** Function to compute the l_p-index
+/** Function to compute the r_p-index
  *
  *  @param x numeric
- *  @param p numeric, >=1, length 1
- *  @param  numeric vector of length 2
+ *  @param p numeric, >=1
+ *  @return numeric vector of length(p)
  */
-SEXP index_lp(SEXP x, SEXP p)
+SEXP index_rp(SEXP x, SEXP p)
 {
-   p = PROTECT(prepare_arg_numeric(p, "p"));
-   if (LENGTH(p) != 1)
-      Rf_error("`p` should be a single numeric value");
-   double p_val = REAL(p)[0];
-   if (ISNA(p_val) || p_val < 1)
-      Rf_error("`p` should be >= 1");
+   p = PROTECT(__index_p_prepare_vector(p));
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   R_len_t np = LENGTH(p);
 
-   x = PROTECT(prepare_arg_numeric_sorted_dec(x, "x"));
-   R_len_t n = LENGTH(x);
-   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
+   SEXP ret = PROTECT(Rf_allocVector(REALSXP, np));
+   double* pret = REAL(ret);
+   if (ISNA(xd[0])) {
+      for (R_len_t j=0; j<np; ++j) pret[j] = NA_REAL;
+   }
+   else if (np == 1)
+      pret[0] = __index_rp(xd, LENGTH(x), REAL(p)[0]);
+   else
+      __index_rp_multi(xd, LENGTH(x), REAL(p), np, pret);
 
+   UNPROTECT(3);
+   return ret;
+}
 
-   double* xd = REAL(x);
-   if (ISNA(xd[0])) {
-      UNPROTECT(2);
-      return (double2(NA_REAL, NA_REAL).toR());
+
+
+
+
+/** Vertices of the staircase of x, which do not depend on p [internal]
+ *
+ * These are (0, x_1) and the points (i, x_{i+1}) such that
+ * x_{i+1} < x_i, for i = 1, ..., n, where x_{n+1} = 0.
+ * Only these can be the vertices of the hull in __index_lp_scan().
+ *
+ * @param x non-negative, NA-free, sorted non-increasingly, x_2 > 0
+ * @param n length of x, n >= 2
+ * @param c [out] vertices
+ */
+static void __index_lp_staircase(const double* x, R_len_t n, vector<double2>& c)
+{
+   c.clear();
+   c.push_back(double2(0.0, x[0]));
+   for (R_len_t i=1; i<=n; ++i) {
+      double vi = (i<n)?x[i]:0.0;
+      if (vi < c.back().v2)
+         c.push_back(double2((double)i, vi));
    }
+}
 
-   if (xd[n-1] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
 
-   if (xd[1] <= 0.0) {
-      UNPROTECT(2);
-      return (double2(0.0, 0.0).toR());
+/** The L^p ellipse interpolating vertices i and j [internal]
+ *
+ * @param up u^p for each vertex
+ * @param vp v^p for each vertex
+ * @param i vertex index
+ * @param j vertex index
+ * @return the p-th powers of the semi-axes
+ */
+static inline double2 __index_lp_ab(const double* up, const double* vp, R_len_t i, R_len_t j)
+{
+   double c = up[i]*vp[j]-up[j]*vp[i];
+   return double2(c/(vp[j]-vp[i]), -c/(up[j]-up[i]));
+}
+
+
+/** The l_p-index for finite p, given the p-th powers of the coordinates
+ *  of the staircase vertices [internal]
+ *
+ * The procedure bases on Graham's scan for determining the convex hull
+ * of a planar set, see (Gagolewski, Debski, Nowakiewicz, 2009b).
+ * The stack is a contiguous array of vertex indices.  The ellipse
+ * interpolating each pair of adjacent vertices on the stack is stored
+ * when the upper vertex is pushed (it is the one determined in the last
+ * containment test), so selecting the best pair needs no recomputation.
+ *
+ * @param up u^p for each vertex
+ * @param vp v^p for each vertex
+ * @param m number of vertices, m >= 2
+ * @param stack [tmp] array of length m
+ * @param edge [tmp] array of length m
+ * @return the p-th powers of the l_p-index
+ */
+static double2 __index_lp_scan(const double* up, const double* vp, R_len_t m,
+   R_len_t* stack, double2* edge)
+{
+   // edge[t] interpolates stack[t-1] and stack[t]
+   R_len_t top = 0;
+   stack[top++] = 0;
+   for (R_len_t k=1; k<m; ++k) {
+      double2 ab = __index_lp_ab(up, vp, stack[top-1], k);
+      // pop while the ellipse interpolating the top vertex and k
+      // contains the vertex below the top one
+      while (top >= 2) {
+         R_len_t l = stack[top-2];
+         if (!(ab.v2*(1.0 - up[l]/ab.v1) >= vp[l])) break;
+         --top;
+         ab = __index_lp_ab(up, vp, stack[top-1], k);
+      }
+      edge[top] = ab;
+      stack[top++] = k;
+   }
+
+   double2 ab = edge[1];
+   for (R_len_t t=2; t<top; ++t) {
+      if (ab.v1*ab.v2 < edge[t].v1*edge[t].v2)
+         ab = edge[t];
    }
+   return ab;
+}
+
+
+double2 __index_lp(const double* xd, R_len_t n, double p_val)
+{
+   if (n < 2 || xd[1] <= 0.0)
+      return double2(0.0, 0.0);
 
    if (!R_FINITE(p_val))
    {
@@ -359,55 +491,136 @@ SEXP index_lp(SEXP x, SEXP p)
             ab.v2 = xd[i];
          }
       }
-      UNPROTECT(2);
-      return ab.toR();
+      return ab;
    }
    else {
-      if (p_val > 50)
-         Rf_warning("p is large but finite. possible accuracy problems.");
-
-
-// * Function to compute the l_p-index, O(n) time, p<Inf
-// *  The procedure bases on Graham's scan for determining the convex hull
-// *  of a planar set, see (Gagolewski,Debski,Nowakiewicz,2009b).
-
-      deque<double2> stack;
-      stack.push_back(double2(0.0, xd[0]));
-      R_len_t i = 0;
-      while (i<n && xd[i] >= xd[0]) ++i;
-      stack.push_back(double2((double)i, xd[i]));
-
-      for (++i; i<=n; ++i)
-      {
-   		double vi = (i<n)?xd[i]:0.0;
-   		if (vi >= stack.back().v2) continue;
-
-   		while (stack.size()>=2 && __index_lp_finite_testContains(
-               stack.at(stack.size()-2).v1, stack.at(stack.size()-2).v2,
-               p_val,
-               stack.back().v1, stack.back().v2,
-               (double)i, vi))
-         {
-   			stack.pop_back();
-         }
-         stack.push_back(double2((double)i, vi));
-   	}
+      // O(n) time, p<Inf; the powers are computed once per vertex
+      vector<double2> c;
+      __index_lp_staircase(xd, n, c);
+      R_len_t m = (R_len_t)c.size();
+
+      vector<double> up(m), vp(m);
+      for (R_len_t k=0; k<m; ++k) {
+         up[k] = pow(c[k].v1, p_val);
+         vp[k] = pow(c[k].v2, p_val);
+      }
 
-      /*  now, selectMaxPair()  */
-   	double2 ab = __index_lp_finite_getAB(p_val,
-         stack.at(0).v1, stack.at(0).v2,
-         stack.at(1).v1, stack.at(1).v2);
-   	for (i=1; i<(R_len_t)stack.size()-1; ++i)
-   	{
-   		double2 ab2 = __index_lp_finite_getAB(p_val,
-            stack.at(i).v1, stack.at(i).v2,
-            stack.at(i+1).v1, stack.at(i+1).v2);
+      vector<R_len_t> stack(m);
+      vector<double2> edge(m);
+      double2 ab = __index_lp_scan(up.data(), vp.data(), m, stack.data(), edge.data());
+      return double2(pow(ab.v1, 1.0/p_val), pow(ab.v2, 1.0/p_val));
+   }
+}
 
-   		if (ab.v1*ab.v2 < ab2.v1*ab2.v2)
-            ab = ab2;
-   	}
 
+/** Compute the l_p-index for many p
+ *
+ * The staircase vertices and the logarithms of their coordinates
+ * are determined only once; then, for each finite p, the powers are
+ * computed once per vertex (as exp(p*log(u))), and not in each test.
+ *
+ * @param x non-negative, NA-free, sorted non-increasingly
+ * @param n length of x, n >= 1
+ * @param p values >= 1
+ * @param np length of p
+ * @param out [out] array of length np
+ */
+void __index_lp_multi(const double* x, R_len_t n, const double* p, R_len_t np, double2* out)
+{
+   if (n < 2 || x[1] <= 0.0) {
+      for (R_len_t j=0; j<np; ++j) out[j] = double2(0.0, 0.0);
+      return;
+   }
+
+   vector<double2> c;
+   __index_lp_staircase(x, n, c);
+   R_len_t m = (R_len_t)c.size();
+
+   vector<double> lu(m), lv(m), up(m), vp(m);
+   vector<R_len_t> stack(m);
+   vector<double2> edge(m);
+   for (R_len_t k=0; k<m; ++k) {
+      lu[k] = log(c[k].v1);
+      lv[k] = log(c[k].v2);
+   }
+
+   for (R_len_t j=0; j<np; ++j) {
+      if (!R_FINITE(p[j])) {
+         out[j] = __index_lp(x, n, p[j]);
+         continue;
+      }
+
+      for (R_len_t k=0; k<m; ++k) {
+         up[k] = exp(p[j]*lu[k]);
+         vp[k] = exp(p[j]*lv[k]);
+      }
+      double2 ab = __index_lp_scan(up.data(), vp.data(), m, stack.data(), edge.data());
+      out[j] = double2(pow(ab.v1, 1.0/p[j]), pow(ab.v2, 1.0/p[j]));
+   }
+}
+
+
+/** Function to compute the l_p-index
+ *
+ *  @param x numeric
+ *  @param p numeric, >=1
+ *  @return numeric vector of length 2 or a length(p)*2 matrix
+ */
+SEXP index_lp(SEXP x, SEXP p)
+{
+   p = PROTECT(__index_p_prepare_vector(p));
+   x = PROTECT(__index_prepare_x(x));
+   double* xd = REAL(x);
+   R_len_t np = LENGTH(p);
+
+   if (np == 1) {
+      double2 ret = ISNA(xd[0]) ? double2(NA_REAL, NA_REAL) : __index_lp(xd, LENGTH(x), REAL(p)[0]);
       UNPROTECT(2);
-      return double2(pow(ab.v1, 1.0/p_val), pow(ab.v2, 1.0/p_val)).toR();
+      return ret.toR();
+   }
+
+   vector<double2> res(np, double2(NA_REAL, NA_REAL));
+   if (!ISNA(xd[0]))
+      __index_lp_multi(xd, LENGTH(x), REAL(p), np, res.data());
+
+   SEXP ret = PROTECT(Rf_allocMatrix(REALSXP, np, 2));
+   double* pret = REAL(ret);
+   for (R_len_t j=0; j<np; ++j) {
+      pret[j] = res[j].v1;
+      pret[j+np] = res[j].v2;
+   }
+   UNPROTECT(3);
+   return ret;
+}
+
+
+
+static const char* __index_op_names[INDEX_NUM_OPS] = {
+   "index_h", "index_g", "index_g_zi", "index_maxprod", "index_w",
+   "index_rp", "index_lp"
+};
+
+
+index_op __index_op_get(const char* name)
+{
+   int op = 0;
+   while (op < INDEX_NUM_OPS && strcmp(name, __index_op_names[op]))
+      ++op;
+   return (index_op)op;
+}
+
+
+double2 __index_apply(index_op op, const double* x, R_len_t n,
+   double p, summation_mode mode)
+{
+   switch (op) {
+      case INDEX_H:       return double2(__index_h(x, n));
+      case INDEX_G:       return double2(__index_g(x, n, mode));
+      case INDEX_G_ZI:    return double2(__index_g_zi(x, n, mode));
+      case INDEX_MAXPROD: return double2(__index_maxprod(x, n));
+      case INDEX_W:       return double2(__index_w(x, n));
+      case INDEX_RP:      return double2(__index_rp(x, n, p));
+      case INDEX_LP:      return __index_lp(x, n, p);
+      default:            return double2(NA_REAL, NA_REAL);
    }
 }
@@ -0,0 +1,86 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#ifndef __agops_impact_h
+#define __agops_impact_h
+
+#include "agop.h"
+#include "summation.h"
+
+
+/* Impact index kernels.
+ *
+ * They all assume that x is NA-free, non-negative,
+ * sorted non-increasingly, and that n >= 1;
+ * they do not call the R API, so they can be used anywhere,
+ * e.g., on slices of a grouped or a memory-mapped vector.
+ */
+
+double __index_h(const double* x, R_len_t n);
+double __index_g(const double* x, R_len_t n, summation_mode mode);
+double __index_g_zi(const double* x, R_len_t n, summation_mode mode);
+double __index_w(const double* x, R_len_t n);
+double __index_maxprod(const double* x, R_len_t n);
+double __index_rp(const double* x, R_len_t n, double p);
+double2 __index_lp(const double* x, R_len_t n, double p);
+void __index_rp_multi(const double* x, R_len_t n, const double* p, R_len_t np, double* out);
+void __index_lp_multi(const double* x, R_len_t n, const double* p, R_len_t np, double2* out);
+
+
+/* Impact indices by name, see __index_op_get() */
+enum index_op {
+   INDEX_H, INDEX_G, INDEX_G_ZI, INDEX_MAXPROD, INDEX_W,
+   INDEX_RP, INDEX_LP,
+   INDEX_NUM_OPS
+};
+
+
+/** Get an impact index by name
+ *
+ * @param name e.g., "index_h"
+ * @return index identifier or INDEX_NUM_OPS if name is unknown
+ */
+index_op __index_op_get(const char* name);
+
+
+/** Compute an impact index, see the kernels above
+ *
+ * @param op index identifier
+ * @param x non-negative, NA-free, sorted non-increasingly
+ * @param n length of x, n >= 1
+ * @param p for INDEX_RP and INDEX_LP
+ * @param mode for INDEX_G and INDEX_G_ZI
+ * @return index value (for INDEX_LP, both coordinates; otherwise, v2 == 0)
+ */
+double2 __index_apply(index_op op, const double* x, R_len_t n,
+   double p, summation_mode mode);
+
+
+/** Validate the p argument of index_rp() and index_lp()
+ *
+ * @param p R object
+ * @return single value >= 1 (possibly Inf)
+ */
+double __index_p_prepare(SEXP p);
+
+#endif
@@ -0,0 +1,561 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "agops_impact.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdint.h>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+
+/* Citation store file layout (native byte order):
+ *
+ * header (64 bytes), see below;
+ * int64 offsets[n_authors+1]: author k's papers are at
+ *    positions offsets[k], ..., offsets[k+1]-1;
+ * values[n_values]: citations, each author's sorted non-increasingly;
+ *    uint32 or float64, see type; padded to a multiple of 8 bytes;
+ * names: n_authors NUL-terminated UTF-8 strings.
+ */
+#define CITATION_STORE_MAGIC   "AGOPCIT"
+#define CITATION_STORE_ENDIAN  0x01020304
+#define CITATION_STORE_UINT32  1
+#define CITATION_STORE_DOUBLE  2
+
+struct __citation_store_header {
+   char magic[8];
+   uint32_t endian;
+   uint32_t type;
+   int64_t n_authors;
+   int64_t n_values;
+   int64_t names_offset;
+   int64_t names_size;
+   char reserved[16];
+};
+
+
+/* Elements of the list returned by citation_store_open() */
+#define CITATION_STORE_PTR        0
+#define CITATION_STORE_FILE       1
+#define CITATION_STORE_TYPE       2
+#define CITATION_STORE_NAUTHORS   3
+#define CITATION_STORE_NVALUES    4
+#define CITATION_STORE_NELEM      5
+
+
+
+/** A read-only memory-mapped file [internal] */
+struct __citation_store {
+   const char* base;
+   size_t size;
+#ifdef _WIN32
+   HANDLE hfile;
+   HANDLE hmap;
+#endif
+
+   const __citation_store_header* header() const {
+      return (const __citation_store_header*)base;
+   }
+
+   const int64_t* offsets() const {
+      return (const int64_t*)(base+sizeof(__citation_store_header));
+   }
+
+   const char* values() const {
+      return (const char*)(offsets()+header()->n_authors+1);
+   }
+};
+
+
+
+/** Unmap a file [internal]
+ *
+ * @param s mapped file or NULL
+ */
+static void __citation_store_close(__citation_store* s)
+{
+   if (!s) return;
+#ifdef _WIN32
+   if (s->base) UnmapViewOfFile((LPCVOID)s->base);
+   if (s->hmap) CloseHandle(s->hmap);
+   if (s->hfile != INVALID_HANDLE_VALUE) CloseHandle(s->hfile);
+#else
+   if (s->base) munmap((void*)s->base, s->size);
+#endif
+   delete s;
+}
+
+
+
+/** Map a file into memory [internal]
+ *
+ * @param fname path
+ * @param error [out] error message
+ * @return mapped file or NULL on error
+ */
+static __citation_store* __citation_store_map(const char* fname, std::string& error)
+{
+   __citation_store* s = new __citation_store;
+   s->base = NULL;
+   s->size = 0;
+#ifdef _WIN32
+   s->hmap = NULL;
+   s->hfile = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_DELETE, NULL,
+      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   LARGE_INTEGER size;
+   if (s->hfile == INVALID_HANDLE_VALUE || !GetFileSizeEx(s->hfile, &size)) {
+      error = std::string("cannot open file ") + fname;
+      __citation_store_close(s);
+      return NULL;
+   }
+   s->size = (size_t)size.QuadPart;
+   if (s->size > 0) {
+      s->hmap = CreateFileMappingA(s->hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (s->hmap)
+         s->base = (const char*)MapViewOfFile(s->hmap, FILE_MAP_READ, 0, 0, 0);
+   }
+#else
+   int fd = open(fname, O_RDONLY);
+   struct stat st;
+   if (fd < 0 || fstat(fd, &st) != 0) {
+      if (fd >= 0) close(fd);
+      error = std::string("cannot open file ") + fname;
+      __citation_store_close(s);
+      return NULL;
+   }
+   s->size = (size_t)st.st_size;
+   if (s->size > 0) {
+      void* base = mmap(NULL, s->size, PROT_READ, MAP_SHARED, fd, 0);
+      if (base != MAP_FAILED)
+         s->base = (const char*)base;
+   }
+   close(fd); // the mapping stays valid
+#endif
+
+   if (s->size > 0 && !s->base) {
+      error = std::string("cannot map file ") + fname;
+      __citation_store_close(s);
+      return NULL;
+   }
+
+   // validate the header and the offsets, so that later accesses are safe
+   const __citation_store_header* h = s->header();
+   const char* msg = NULL;
+   if (s->size < sizeof(__citation_store_header) || memcmp(h->magic, CITATION_STORE_MAGIC, 8) != 0)
+      msg = "not a citation store file";
+   else if (h->endian != CITATION_STORE_ENDIAN)
+      msg = "citation store file was created on a platform with different byte order";
+   else if (h->type != CITATION_STORE_UINT32 && h->type != CITATION_STORE_DOUBLE)
+      msg = "unsupported citation store value type";
+   else if (h->n_authors < 0 || h->n_values < 0
+         || h->n_authors > (int64_t)(s->size/sizeof(int64_t))
+         || h->n_authors > (int64_t)R_LEN_T_MAX
+         || h->n_values > (int64_t)s->size
+         || h->names_offset < 0 || h->names_size < 0
+         || h->names_offset > (int64_t)s->size
+         || h->names_size > (int64_t)s->size-h->names_offset
+         || (h->n_authors > 0 && (h->names_size == 0 || s->base[h->names_offset+h->names_size-1] != '\0')))
+      msg = "corrupted citation store file";
+   else {
+      size_t vsize = (h->type == CITATION_STORE_UINT32) ? sizeof(uint32_t) : sizeof(double);
+      size_t need = sizeof(__citation_store_header) + sizeof(int64_t)*(h->n_authors+1)
+         + vsize*h->n_values;
+      if (need > (size_t)h->names_offset)
+         msg = "corrupted citation store file";
+      else {
+         const int64_t* off = s->offsets();
+         if (off[0] != 0 || off[h->n_authors] != h->n_values)
+            msg = "corrupted citation store file";
+         for (int64_t k=0; !msg && k<h->n_authors; ++k)
+            if (off[k+1] < off[k] || off[k+1]-off[k] > (int64_t)R_LEN_T_MAX)
+               msg = "corrupted citation store file";
+      }
+   }
+
+   if (msg) {
+      error = msg;
+      __citation_store_close(s);
+      return NULL;
+   }
+
+   return s;
+}
+
+
+
+static void __citation_store_finalizer(SEXP ptr)
+{
+   __citation_store_close((__citation_store*)R_ExternalPtrAddr(ptr));
+   R_ClearExternalPtr(ptr);
+}
+
+
+
+/** Get the mapped file from a citation store object [internal]
+ *
+ * @param store list returned by citation_store_open()
+ * @return mapped file
+ */
+static const __citation_store* __citation_store_get(SEXP store)
+{
+   if (!Rf_inherits(store, "citation_store") || TYPEOF(store) != VECSXP
+         || LENGTH(store) != CITATION_STORE_NELEM)
+      Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+   SEXP ptr = VECTOR_ELT(store, CITATION_STORE_PTR);
+   if (TYPEOF(ptr) != EXTPTRSXP || !R_ExternalPtrAddr(ptr))
+      Rf_error("citation store is no longer valid; reopen the file");
+   return (const __citation_store*)R_ExternalPtrAddr(ptr);
+}
+
+
+
+/** Create a new temporary file next to a given one [internal]
+ *
+ * @param fname path to the target file
+ * @param tmpname [out] path to the temporary file
+ * @return file opened for writing or NULL on error
+ */
+static FILE* __citation_store_tmpfile(const std::string& fname, std::string& tmpname)
+{
+   char suffix[64];
+   for (int i=0; i<100; ++i) {
+#ifdef _WIN32
+      snprintf(suffix, sizeof(suffix), ".tmp%lu_%d", (unsigned long)GetCurrentProcessId(), i);
+      tmpname = fname+suffix;
+      HANDLE hfile = CreateFileA(tmpname.c_str(), GENERIC_WRITE, 0, NULL,
+         CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL);
+      if (hfile != INVALID_HANDLE_VALUE) {
+         CloseHandle(hfile);
+         return fopen(tmpname.c_str(), "wb");
+      }
+      if (GetLastError() != ERROR_FILE_EXISTS) return NULL;
+#else
+      snprintf(suffix, sizeof(suffix), ".tmp%ld_%d", (long)getpid(), i);
+      tmpname = fname+suffix;
+      int fd = open(tmpname.c_str(), O_WRONLY|O_CREAT|O_EXCL, 0666);
+      if (fd >= 0) {
+         FILE* f = fdopen(fd, "wb");
+         if (!f) { close(fd); remove(tmpname.c_str()); }
+         return f;
+      }
+      if (errno != EEXIST) return NULL;
+#endif
+   }
+   return NULL;
+}
+
+
+
+/** Replace a file with another one [internal]
+ *
+ * On POSIX systems, the existing mappings of the old file
+ * (see citation_store_open()) stay intact, as they refer to
+ * the old inode.  On Windows, this fails if the old file is mapped.
+ *
+ * @param from path to the new file
+ * @param to path to the file to replace
+ * @return true on success
+ */
+static bool __citation_store_replace(const std::string& from, const std::string& to)
+{
+#ifdef _WIN32
+   return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+   return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+
+
+/** Write a list of citation vectors to a citation store file
+ *
+ * Each vector is sorted non-increasingly.
+ * The data are written to a temporary file first, which then replaces
+ * the target one; hence, citation stores already open on the same path
+ * remain valid (they give access to the previous contents).
+ *
+ * @param x list of non-negative, NA-free numeric vectors
+ * @param names author names (character vector of length(x))
+ * @param file path
+ * @param type "uint32" or "double"
+ * @return R_NilValue
+ */
+SEXP citation_store_write(SEXP x, SEXP names, SEXP file, SEXP type)
+{
+   file = PROTECT(prepare_arg_string_1(file, "file"));
+   type = PROTECT(prepare_arg_string_1(type, "type"));
+   if (TYPEOF(x) != VECSXP) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+   if (!Rf_isString(names) || LENGTH(names) != LENGTH(x))
+      Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+   if (STRING_ELT(file, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "file");
+
+   __citation_store_header h;
+   memset(&h, 0, sizeof(h));
+   memcpy(h.magic, CITATION_STORE_MAGIC, 8);
+   h.endian = CITATION_STORE_ENDIAN;
+   if (!strcmp(CHAR(STRING_ELT(type, 0)), "uint32")) h.type = CITATION_STORE_UINT32;
+   else if (!strcmp(CHAR(STRING_ELT(type, 0)), "double")) h.type = CITATION_STORE_DOUBLE;
+   else Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   // validate everything first, so that no R errors occur while writing
+   R_len_t n_authors = LENGTH(x);
+   vector<int64_t> offsets(n_authors+1, 0);
+   h.names_size = 0;
+   R_len_t maxn = 0;
+   vector<std::string> names_utf8(n_authors);
+   for (R_len_t k=0; k<n_authors; ++k) {
+      SEXP xk = VECTOR_ELT(x, k);
+      if (!Rf_isReal(xk)) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      R_len_t nk = LENGTH(xk);
+      const double* xkd = REAL(xk);
+      for (R_len_t i=0; i<nk; ++i) {
+         if (ISNAN(xkd[i])) Rf_error(MSG__ARG_EXPECTED_NOT_NA, "x");
+         if (xkd[i] < 0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
+         if (h.type == CITATION_STORE_UINT32 && !(xkd[i] <= 4294967295.0 && xkd[i] == floor(xkd[i])))
+            Rf_error("`x` cannot be stored as uint32");
+      }
+      offsets[k+1] = offsets[k]+nk;
+      maxn = max(maxn, nk);
+      if (STRING_ELT(names, k) == NA_STRING) Rf_error(MSG__ARG_EXPECTED_NOT_NA, "names");
+      names_utf8[k] = Rf_translateCharUTF8(STRING_ELT(names, k));
+      h.names_size += names_utf8[k].size()+1;
+   }
+   h.n_authors = n_authors;
+   h.n_values = offsets[n_authors];
+   size_t vsize = (h.type == CITATION_STORE_UINT32) ? sizeof(uint32_t) : sizeof(double);
+   size_t vbytes = vsize*h.n_values;
+   size_t vpad = (8-vbytes%8)%8;
+   h.names_offset = sizeof(h)+sizeof(int64_t)*(n_authors+1)+vbytes+vpad;
+
+   std::string fname(R_ExpandFileName(Rf_translateChar(STRING_ELT(file, 0))));
+   double* buf = (double*)R_alloc(maxn+1, sizeof(double));
+   uint32_t* buf32 = (uint32_t*)R_alloc(maxn+1, sizeof(uint32_t));
+
+   // no R API functions that may throw errors below
+   std::string tmpname;
+   FILE* f = __citation_store_tmpfile(fname, tmpname);
+   if (!f) Rf_error("cannot create a temporary file next to %s", fname.c_str());
+
+   bool ok = (fwrite(&h, sizeof(h), 1, f) == 1);
+   ok = ok && (fwrite(offsets.data(), sizeof(int64_t), n_authors+1, f) == (size_t)n_authors+1);
+   for (R_len_t k=0; ok && k<n_authors; ++k) {
+      SEXP xk = VECTOR_ELT(x, k);
+      R_len_t nk = LENGTH(xk);
+      memcpy(buf, REAL(xk), nk*sizeof(double));
+      std::sort(buf, buf+nk, std::greater<double>());
+      if (h.type == CITATION_STORE_UINT32) {
+         for (R_len_t i=0; i<nk; ++i) buf32[i] = (uint32_t)buf[i];
+         ok = (fwrite(buf32, sizeof(uint32_t), nk, f) == (size_t)nk);
+      }
+      else
+         ok = (fwrite(buf, sizeof(double), nk, f) == (size_t)nk);
+   }
+   const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+   ok = ok && (fwrite(zeros, 1, vpad, f) == vpad);
+   for (R_len_t k=0; ok && k<n_authors; ++k)
+      ok = (fwrite(names_utf8[k].c_str(), 1, names_utf8[k].size()+1, f) == names_utf8[k].size()+1);
+   ok = (fclose(f) == 0) && ok;
+
+   if (!ok) {
+      remove(tmpname.c_str());
+      Rf_error("error writing file %s", fname.c_str());
+   }
+
+   if (!__citation_store_replace(tmpname, fname)) {
+      remove(tmpname.c_str());
+      Rf_error("cannot replace file %s (is it open?)", fname.c_str());
+   }
+
+   UNPROTECT(2);
+   return R_NilValue;
+}
+
+
+
+/** Open a citation store file
+ *
+ * @param file path
+ * @return list, see CITATION_STORE_NELEM
+ */
+SEXP citation_store_open(SEXP file)
+{
+   file = PROTECT(prepare_arg_string_1(file, "file"));
+   if (STRING_ELT(file, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "file");
+   std::string fname(R_ExpandFileName(Rf_translateChar(STRING_ELT(file, 0))));
+
+   std::string error;
+   __citation_store* s = __citation_store_map(fname.c_str(), error);
+   if (!s) Rf_error("%s", error.c_str());
+
+   SEXP ptr = PROTECT(R_MakeExternalPtr(s, R_NilValue, R_NilValue));
+   R_RegisterCFinalizerEx(ptr, __citation_store_finalizer, TRUE);
+
+   SEXP ret = PROTECT(Rf_allocVector(VECSXP, CITATION_STORE_NELEM));
+   SET_VECTOR_ELT(ret, CITATION_STORE_PTR, ptr);
+   SET_VECTOR_ELT(ret, CITATION_STORE_FILE, file);
+   SET_VECTOR_ELT(ret, CITATION_STORE_TYPE, Rf_mkString(
+      (s->header()->type == CITATION_STORE_UINT32) ? "uint32" : "double"));
+   SET_VECTOR_ELT(ret, CITATION_STORE_NAUTHORS, Rf_ScalarReal((double)s->header()->n_authors));
+   SET_VECTOR_ELT(ret, CITATION_STORE_NVALUES, Rf_ScalarReal((double)s->header()->n_values));
+
+   SEXP names = PROTECT(Rf_allocVector(STRSXP, CITATION_STORE_NELEM));
+   SET_STRING_ELT(names, CITATION_STORE_PTR, Rf_mkChar("ptr"));
+   SET_STRING_ELT(names, CITATION_STORE_FILE, Rf_mkChar("file"));
+   SET_STRING_ELT(names, CITATION_STORE_TYPE, Rf_mkChar("type"));
+   SET_STRING_ELT(names, CITATION_STORE_NAUTHORS, Rf_mkChar("n_authors"));
+   SET_STRING_ELT(names, CITATION_STORE_NVALUES, Rf_mkChar("n_values"));
+   Rf_setAttrib(ret, R_NamesSymbol, names);
+
+   SEXP cls = PROTECT(Rf_mkString("citation_store"));
+   Rf_setAttrib(ret, R_ClassSymbol, cls);
+
+   UNPROTECT(5);
+   return ret;
+}
+
+
+
+/** Close a citation store
+ *
+ * Unmaps the file; the store cannot be used afterwards.
+ * Closing a store more than once is a no-op.
+ *
+ * @param store list returned by citation_store_open()
+ * @return R_NilValue
+ */
+SEXP citation_store_close(SEXP store)
+{
+   if (!Rf_inherits(store, "citation_store") || TYPEOF(store) != VECSXP
+         || LENGTH(store) != CITATION_STORE_NELEM)
+      Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+   SEXP ptr = VECTOR_ELT(store, CITATION_STORE_PTR);
+   if (TYPEOF(ptr) != EXTPTRSXP) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+   __citation_store_finalizer(ptr);
+   return R_NilValue;
+}
+
+
+
+/** Get the author names from a citation store
+ *
+ * @param store list returned by citation_store_open()
+ * @return character vector
+ */
+SEXP citation_store_authors(SEXP store)
+{
+   const __citation_store* s = __citation_store_get(store);
+   const __citation_store_header* h = s->header();
+   R_len_t n_authors = (R_len_t)h->n_authors;
+
+   SEXP ret = PROTECT(Rf_allocVector(STRSXP, n_authors));
+   const char* nm = s->base+h->names_offset;
+   const char* end = nm+h->names_size;
+   for (R_len_t k=0; k<n_authors; ++k) {
+      if (nm >= end) Rf_error("corrupted citation store file");
+      SET_STRING_ELT(ret, k, Rf_mkCharCE(nm, CE_UTF8));
+      nm += strlen(nm)+1; // the last name is NUL-terminated, see __citation_store_map
+   }
+   UNPROTECT(1);
+   return ret;
+}
+
+
+
+/** Compute an impact index for each author in a citation store
+ *
+ * The data are already sorted, hence the kernels operate directly
+ * on the mapped memory (float64 data) or on a single buffer
+ * to which each author's citations are converted (uint32 data).
+ *
+ * @param store list returned by citation_store_open()
+ * @param op name of the impact index, e.g., "index_h"
+ * @param p for index_rp and index_lp
+ * @return numeric vector with one element per author (NA for authors
+ *    with no papers); for index_lp, an n_authors*2 matrix
+ */
+SEXP citation_store_index(SEXP store, SEXP op, SEXP p)
+{
+   const __citation_store* s = __citation_store_get(store);
+   op = PROTECT(prepare_arg_string_1(op, "op"));
+   index_op opi = __index_op_get(CHAR(STRING_ELT(op, 0)));
+   if (opi == INDEX_NUM_OPS) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   double p_val = 1.0;
+   if (opi == INDEX_RP || opi == INDEX_LP)
+      p_val = __index_p_prepare(p);
+
+   summation_mode mode = summation_mode_get();
+
+   const __citation_store_header* h = s->header();
+   R_len_t n_authors = (R_len_t)h->n_authors;
+   const int64_t* off = s->offsets();
+
+   SEXP ret;
+   if (opi == INDEX_LP)
+      PROTECT(ret = Rf_allocMatrix(REALSXP, n_authors, 2));
+   else
+      PROTECT(ret = Rf_allocVector(REALSXP, n_authors));
+   double* pret = REAL(ret);
+
+   double* buf = NULL;
+   if (h->type == CITATION_STORE_UINT32) {
+      int64_t maxn = 0;
+      for (R_len_t k=0; k<n_authors; ++k)
+         maxn = max(maxn, off[k+1]-off[k]);
+      buf = (double*)R_alloc(maxn+1, sizeof(double));
+   }
+
+   for (R_len_t k=0; k<n_authors; ++k) {
+      R_len_t nk = (R_len_t)(off[k+1]-off[k]);
+      double2 res(NA_REAL, NA_REAL);
+      if (nk > 0) {
+         const double* xk;
+         if (h->type == CITATION_STORE_UINT32) {
+            const uint32_t* vk = (const uint32_t*)s->values()+off[k];
+            for (R_len_t i=0; i<nk; ++i) buf[i] = (double)vk[i];
+            xk = buf;
+         }
+         else
+            xk = (const double*)s->values()+off[k];
+         res = __index_apply(opi, xk, nk, p_val, mode);
+      }
+      pret[k] = res.v1;
+      if (opi == INDEX_LP) pret[k+n_authors] = res.v2;
+   }
+
+   UNPROTECT(2);
+   return ret;
+}
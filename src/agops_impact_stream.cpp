@@ -0,0 +1,329 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "agops_impact.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <stdint.h>
+
+
+
+/* Record size in the binary format: int64 author id, float64 citations */
+#define INDEX_STREAM_RECORD_SIZE 16
+
+
+
+/** Reads (author_id, citations) records from a file chunk by chunk
+ *
+ * Author ids are returned as raw bytes, which are only valid
+ * until the next call to next(): the token itself in the text format
+ * (fields separated by whitespace, commas, or semicolons, one record
+ * per line), or 8 bytes of an int64 in the binary one (native byte order).
+ *
+ * No R API functions are called, so that the file is always closed.
+ */
+class __citation_reader
+{
+private:
+   FILE* f;
+   bool binary;
+   vector<char> buf;
+   size_t len;    // number of bytes in buf
+   size_t pos;    // current position in buf
+   bool eof;
+
+   /** Read more data, keeping the bytes from pos onwards
+    *
+    * @return false if nothing could be read
+    */
+   bool refill()
+   {
+      if (eof) return false;
+      if (pos > 0) {
+         memmove(buf.data(), buf.data()+pos, len-pos);
+         len -= pos;
+         pos = 0;
+      }
+      if (len == buf.size())
+         buf.resize(2*buf.size()); // a line longer than the chunk
+      size_t k = fread(buf.data()+len, 1, buf.size()-len, f);
+      if (k < buf.size()-len) {
+         eof = true;
+         if (ferror(f)) error = "error reading the input file";
+      }
+      len += k;
+      return k > 0;
+   }
+
+public:
+   std::string error;
+   uint64_t line;  // current line (text) or record (binary) number
+
+   __citation_reader(const char* fname, bool _binary, size_t chunk_size)
+      : binary(_binary), buf(max(chunk_size, (size_t)2*INDEX_STREAM_RECORD_SIZE)),
+        len(0), pos(0), eof(false), line(0)
+   {
+      f = fopen(fname, binary?"rb":"r");
+      if (!f) error = std::string("cannot open file ") + fname;
+   }
+
+   ~__citation_reader()
+   {
+      if (f) fclose(f);
+   }
+
+   bool ok() const { return error.empty(); }
+
+
+   /** Get the next record
+    *
+    * @param id [out] author id (raw bytes)
+    * @param idlen [out] length of id
+    * @param value [out] number of citations, NA_REAL for NA
+    * @return false at the end of file or on error, see ok()
+    */
+   bool next(const char*& id, size_t& idlen, double& value)
+   {
+      if (!ok()) return false;
+
+      if (binary) {
+         if (len-pos < INDEX_STREAM_RECORD_SIZE && !refill() && len == pos)
+            return false;
+         if (len-pos < INDEX_STREAM_RECORD_SIZE) {
+            error = "truncated record at the end of the input file";
+            return false;
+         }
+         ++line;
+         id = buf.data()+pos;
+         idlen = 8;
+         memcpy(&value, buf.data()+pos+8, sizeof(double));
+         if (ISNAN(value)) value = NA_REAL;
+         pos += INDEX_STREAM_RECORD_SIZE;
+         return true;
+      }
+
+      while (true) {
+         char* start = buf.data()+pos;
+         char* end = (char*)memchr(start, '\n', len-pos);
+         if (!end) {
+            if (refill()) continue;
+            if (!ok() || len == pos) return false;
+            if (len == buf.size()) buf.resize(len+1);
+            buf[len++] = '\n'; // the last line lacks a newline
+            continue;
+         }
+         ++line;
+         pos = (end-buf.data())+1;
+         *end = '\0';
+
+         char* s = start;
+         while (*s == ' ' || *s == '\t' || *s == '\r') ++s;
+         if (*s == '\0' || *s == '#') continue; // empty line or comment
+
+         id = s;
+         while (*s && !strchr(" \t\r,;", *s)) ++s;
+         idlen = s-id;
+         while (*s && strchr(" \t\r,;", *s)) ++s;
+
+         char* vend;
+         value = strtod(s, &vend);
+         if (vend == s) {
+            if (strncmp(s, "NA", 2) != 0) {
+               error = "cannot parse line " + std::to_string(line);
+               return false;
+            }
+            value = NA_REAL;
+            vend = s+2;
+         }
+         if (ISNAN(value)) value = NA_REAL; // strtod accepts "NaN"
+         while (*vend == ' ' || *vend == '\t' || *vend == '\r') ++vend;
+         if (*vend != '\0') {
+            error = "unexpected data in line " + std::to_string(line);
+            return false;
+         }
+         return true;
+      }
+   }
+};
+
+
+
+static void __index_stream_check_interrupt(void*)
+{
+   R_CheckUserInterrupt();
+}
+
+
+
+/** Compute an impact index for each author and write it out [internal]
+ *
+ * @return empty string on success, error message otherwise
+ */
+static std::string __index_stream(__citation_reader& in, FILE* out,
+   bool binary, index_op op, double p, summation_mode mode, double* nauthors)
+{
+   std::string cur_id;
+   vector<double> x;
+   bool in_run = false, has_na = false;
+   const char* id = NULL;
+   size_t idlen = 0;
+   double value;
+
+   *nauthors = 0.0;
+   bool more = in.next(id, idlen, value);
+   while (more || in_run) {
+      if (in_run && (!more || idlen != cur_id.size()
+            || memcmp(id, cur_id.data(), idlen) != 0)) {
+         // a run has ended
+         double2 res(NA_REAL, NA_REAL);
+         if (!has_na) {
+            std::sort(x.begin(), x.end(), std::greater<double>());
+            res = __index_apply(op, x.data(), (R_len_t)x.size(), p, mode);
+         }
+
+         int ret;
+         if (binary) {
+            int64_t idi;
+            memcpy(&idi, cur_id.data(), sizeof(int64_t));
+            ret = fprintf(out, "%lld", (long long)idi);
+         }
+         else
+            ret = fprintf(out, "%s", cur_id.c_str());
+         if (ret >= 0 && ISNA(res.v1))
+            ret = fprintf(out, (op == INDEX_LP)?"\tNA\tNA\n":"\tNA\n");
+         else if (ret >= 0 && op == INDEX_LP)
+            ret = fprintf(out, "\t%.15g\t%.15g\n", res.v1, res.v2);
+         else if (ret >= 0)
+            ret = fprintf(out, "\t%.15g\n", res.v1);
+         if (ret < 0)
+            return "error writing the output file";
+
+         x.clear();
+         in_run = has_na = false;
+         *nauthors += 1.0;
+
+         if (fmod(*nauthors, 65536.0) == 0.0
+               && !R_ToplevelExec(__index_stream_check_interrupt, NULL))
+            return "interrupted";
+      }
+
+      if (!more) break;
+
+      if (!in_run) {
+         cur_id.assign(id, idlen);
+         in_run = true;
+      }
+      if (ISNA(value))
+         has_na = true;
+      else if (value < 0)
+         return "negative number of citations in line/record "
+            + std::to_string(in.line);
+      else
+         x.push_back(value);
+
+      more = in.next(id, idlen, value);
+   }
+
+   if (!in.ok()) return in.error;
+   return "";
+}
+
+
+
+/** Compute an impact index for each author in a file, in a streaming manner
+ *
+ * The input file consists of (author_id, citations) records that are
+ * grouped by author, see __citation_reader. It is read in chunks,
+ * so that the memory use is bounded by the chunk size and the number
+ * of papers of the most prolific author, not by the file size.
+ * The results are written to the output file as they are computed,
+ * one tab-separated line per author.
+ *
+ * @param infile path to the input file
+ * @param outfile path to the output file
+ * @param op name of the impact index, e.g., "index_h"
+ * @param p for index_rp and index_lp
+ * @param format "text" or "binary"
+ * @param chunk_size size of the input buffer, in bytes
+ * @return number of authors processed
+ */
+SEXP index_stream(SEXP infile, SEXP outfile, SEXP op, SEXP p,
+   SEXP format, SEXP chunk_size)
+{
+   infile = PROTECT(prepare_arg_string_1(infile, "infile"));
+   outfile = PROTECT(prepare_arg_string_1(outfile, "outfile"));
+   op = PROTECT(prepare_arg_string_1(op, "op"));
+   format = PROTECT(prepare_arg_string_1(format, "format"));
+   chunk_size = PROTECT(prepare_arg_double_1(chunk_size, "chunk_size"));
+
+   if (STRING_ELT(infile, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "infile");
+   if (STRING_ELT(outfile, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "outfile");
+
+   index_op opi = __index_op_get(CHAR(STRING_ELT(op, 0)));
+   if (opi == INDEX_NUM_OPS) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   double p_val = 1.0;
+   if (opi == INDEX_RP || opi == INDEX_LP)
+      p_val = __index_p_prepare(p);
+
+   bool binary;
+   if (!strcmp(CHAR(STRING_ELT(format, 0)), "binary")) binary = true;
+   else if (!strcmp(CHAR(STRING_ELT(format, 0)), "text")) binary = false;
+   else Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   double chunk_size_val = REAL(chunk_size)[0];
+   if (ISNA(chunk_size_val) || chunk_size_val < 1)
+      Rf_error(MSG__ARG_NOT_GE_A, "chunk_size", 1.0);
+
+   summation_mode mode = summation_mode_get();
+
+   // copies, as no R API functions may be called while the files are open
+   std::string infname(R_ExpandFileName(Rf_translateChar(STRING_ELT(infile, 0))));
+   std::string outfname(R_ExpandFileName(Rf_translateChar(STRING_ELT(outfile, 0))));
+
+   std::string error;
+   double nauthors = 0.0;
+   {
+      __citation_reader in(infname.c_str(), binary, (size_t)chunk_size_val);
+      FILE* out = NULL;
+      if (!in.ok())
+         error = in.error;
+      else if (!(out = fopen(outfname.c_str(), "w")))
+         error = "cannot open file " + outfname;
+      else {
+         error = __index_stream(in, out, binary, opi, p_val, mode, &nauthors);
+         if (fclose(out) != 0 && error.empty())
+            error = "error writing the output file";
+      }
+   }
+
+   if (!error.empty())
+      Rf_error("%s", error.c_str());
+
+   UNPROTECT(5);
+   return Rf_ScalarReal(nauthors);
+}
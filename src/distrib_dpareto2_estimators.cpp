@@ -0,0 +1,206 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "distrib_pareto2.h"
+#include <R_ext/Applic.h>
+
+
+/** A sample compressed to (value, multiplicity) pairs */
+struct __dpareto2_mle_data {
+   const double* x;  ///< unique values
+   const double* w;  ///< multiplicities
+   R_len_t n;        ///< number of unique values
+};
+
+
+/** Negative log-likelihood of the discretised Pareto2 distribution
+ *
+ * log P(X=x) = -k*log1p(x/s) + log(-expm1(-k*log1p(1/(s+x)))),
+ * i.e., log((s/(s+x))^k-(s/(s+x+1))^k) evaluated without cancellation.
+ *
+ * @param npar 2
+ * @param par c(k, s)
+ * @param ex pointer to __dpareto2_mle_data
+ * @return negative log-likelihood
+ */
+static double __dpareto2_mle_fn(int /*npar*/, double* par, void* ex)
+{
+   const __dpareto2_mle_data* data = (const __dpareto2_mle_data*)ex;
+   double k = par[0], s = par[1];
+   double ll = 0.0;
+   for (R_len_t i=0; i<data->n; ++i) {
+      double x = data->x[i];
+      double a = log1p(x/s);
+      double e = log1p(1.0/(s+x));
+      ll += data->w[i]*(-k*a + log(-expm1(-k*e)));
+   }
+   return -ll;
+}
+
+
+/** Gradient of __dpareto2_mle_fn()
+ *
+ * @param npar 2
+ * @param par c(k, s)
+ * @param df [out] gradient
+ * @param ex pointer to __dpareto2_mle_data
+ */
+static void __dpareto2_mle_gr(int /*npar*/, double* par, double* df, void* ex)
+{
+   const __dpareto2_mle_data* data = (const __dpareto2_mle_data*)ex;
+   double k = par[0], s = par[1];
+   double dk = 0.0, ds = 0.0;
+   for (R_len_t i=0; i<data->n; ++i) {
+      double x = data->x[i];
+      double a = log1p(x/s);
+      double e = log1p(1.0/(s+x));
+      double r = 1.0/expm1(k*e);       // exp(-k*e)/(1-exp(-k*e))
+      double da = -x/(s*(s+x));         // d/ds a
+      double de = -1.0/((s+x)*(s+x+1.0)); // d/ds e
+      dk += data->w[i]*(-a + e*r);
+      ds += data->w[i]*k*(-da + r*de);
+   }
+   df[0] = -dk;
+   df[1] = -ds;
+}
+
+
+/** Compress a sample to unique values and their multiplicities
+ *
+ * @param x sample, integer values >= 0
+ * @param n sample size
+ * @param buf [tmp,out] array of length >= 2*n; on output,
+ *    unique values are stored at buf[0:m], multiplicities at buf[n:n+m]
+ * @return m, number of unique values
+ */
+static R_len_t __dpareto2_compress(const double* x, R_len_t n, double* buf)
+{
+   double* v = buf;
+   double* w = buf+n;
+   for (R_len_t i=0; i<n; ++i) v[i] = x[i];
+   std::sort(v, v+n);
+   R_len_t m = 0;
+   for (R_len_t i=0; i<n; ) {
+      R_len_t j = i+1;
+      while (j < n && v[j] == v[i]) ++j;
+      v[m] = v[i];
+      w[m] = (double)(j-i);
+      ++m;
+      i = j;
+   }
+   return m;
+}
+
+
+/** Discretised Pareto2 distribution parameters' MLE
+ *
+ * The sample is compressed to (value, multiplicity) pairs;
+ * the negative log-likelihood is minimised with R's L-BFGS-B
+ * (as in optim()), using the exact gradient.
+ *
+ * @param x numeric vector, list of numeric vectors, or numeric vector
+ *    split at offsets
+ * @param k0 single numeric value
+ * @param s0 single numeric value
+ * @param kmin single numeric value
+ * @param smin single numeric value
+ * @param kmax single numeric value
+ * @param smax single numeric value
+ * @param offsets NULL or integer vector, see pareto2_prepare_samples()
+ * @return numeric vector of length 2 or a matrix with 2 columns
+ */
+SEXP dpareto2_estimate_mle(SEXP x, SEXP k0, SEXP s0, SEXP kmin, SEXP smin,
+   SEXP kmax, SEXP smax, SEXP offsets)
+{
+   pareto2_samples samples;
+   x = PROTECT(pareto2_prepare_samples(x, offsets, &samples));
+   k0   = PROTECT(prepare_arg_double_1(k0, "k0"));
+   s0   = PROTECT(prepare_arg_double_1(s0, "s0"));
+   kmin = PROTECT(prepare_arg_double_1(kmin, "kmin"));
+   smin = PROTECT(prepare_arg_double_1(smin, "smin"));
+   kmax = PROTECT(prepare_arg_double_1(kmax, "kmax"));
+   smax = PROTECT(prepare_arg_double_1(smax, "smax"));
+   double k0_val   = REAL(k0)[0];
+   double s0_val   = REAL(s0)[0];
+   double kmin_val = REAL(kmin)[0];
+   double smin_val = REAL(smin)[0];
+   double kmax_val = REAL(kmax)[0];
+   double smax_val = REAL(smax)[0];
+   if (!(kmin_val > 0.0)) Rf_error(MSG__ARG_NOT_GT_A, "kmin", 0.0);
+   if (!(smin_val > 0.0)) Rf_error(MSG__ARG_NOT_GT_A, "smin", 0.0);
+   if (!(kmax_val >= kmin_val)) Rf_error(MSG__ARG_NOT_GE_A, "kmax", kmin_val);
+   if (!(smax_val >= smin_val)) Rf_error(MSG__ARG_NOT_GE_A, "smax", smin_val);
+   if (!(k0_val >= kmin_val && k0_val <= kmax_val))
+      Rf_error(MSG__ARG_NOT_IN_AB, "k0", kmin_val, kmax_val);
+   if (!(s0_val >= smin_val && s0_val <= smax_val))
+      Rf_error(MSG__ARG_NOT_IN_AB, "s0", smin_val, smax_val);
+
+   R_len_t nmax = 0;
+   for (R_len_t i=0; i<samples.count; ++i) {
+      const double* xi = samples.x[i];
+      R_len_t ni = samples.n[i];
+      pareto2_check_sample(xi, ni, 1);
+      for (R_len_t j=0; j<ni; ++j)
+         if (xi[j] != floor(xi[j])) Rf_error(MSG__ARG_EXPECTED_INTEGER_VALUES, "x");
+      nmax = max(nmax, ni);
+   }
+   double* buf = (double*)R_alloc(2*(size_t)nmax, sizeof(double));
+
+   SEXP ret;
+   PROTECT(ret = pareto2_alloc_estimates(samples));
+   double* pk = REAL(ret);
+   double* ps = REAL(ret)+samples.count;
+
+   double lower[2] = { kmin_val, smin_val };
+   double upper[2] = { kmax_val, smax_val };
+   int nbd[2] = { 2, 2 }; // both bounds
+   char msg[60];
+
+   for (R_len_t i=0; i<samples.count; ++i) {
+      R_len_t ni = samples.n[i];
+      __dpareto2_mle_data data;
+      data.n = __dpareto2_compress(samples.x[i], ni, buf);
+      data.x = buf;
+      data.w = buf+ni;
+
+      // the same settings as optim(method="L-BFGS-B") uses by default
+      double par[2] = { k0_val, s0_val };
+      double fmin;
+      int fail = 0, fncount = 0, grcount = 0;
+      lbfgsb(2, 5, par, lower, upper, nbd, &fmin,
+         __dpareto2_mle_fn, __dpareto2_mle_gr, &fail, (void*)&data,
+         1e7, 0.0, &fncount, &grcount, 100, msg, 0, 10);
+
+      if (fail != 0 || !R_FINITE(fmin)) {
+         pk[i] = NA_REAL;
+         ps[i] = NA_REAL;
+      }
+      else {
+         pk[i] = par[0];
+         ps[i] = par[1];
+      }
+   }
+
+   UNPROTECT(8);
+   return ret;
+}
@@ -20,9 +20,84 @@
 
 
 
-#include "agop.h"
+#include "distrib_pareto2.h"
+#include "philox.h"
+#include <cstring>
 
 
+/* ------------------------------------------------------------------------- */
+/* Pareto2                                                                   */
+
+template<bool LOWER>
+struct ppareto2_op {
+   static inline double apply(double q, double k, double s)
+   { return __ppareto2<LOWER>(q, k, s); }
+};
+
+struct dpareto2_op {
+   static inline double apply(double x, double k, double s)
+   {
+      double d = k/(s+x)*exp(-k*log1p(x/s)); // k/(s+x)*(s/(s+x))^k
+      return (x > 0.0) ? d : 0.0;
+   }
+};
+
+template<bool LOWER>
+struct qpareto2_op {
+   static inline double apply(double p, double k, double s)
+   {
+      // s*((1-p)^(-1/k)-1) or s*(p^(-1/k)-1)
+      double q = s*expm1(-(LOWER ? log1p(-p) : log(p))/k);
+      return ((p >= 0.0) & (p <= 1.0)) ? q : R_NaN;
+   }
+};
+
+
+/* ------------------------------------------------------------------------- */
+/* discretised Pareto2                                                       */
+
+template<bool LOWER>
+struct pdpareto2_op {
+   static inline double apply(double q, double k, double s)
+   { return __ppareto2<LOWER>(floor(q)+1.0, k, s); } // 0 or 1 if q < 0
+};
+
+struct ddpareto2_op {
+   static inline double apply(double x, double k, double s)
+   {
+      // (s/(s+x))^k-(s/(s+x+1))^k = (s/(s+x))^k * (1-((s+x)/(s+x+1))^k)
+      double d = exp(-k*log1p(x/s))*(-expm1(-k*log1p(1.0/(s+x))));
+      return ((x >= 0.0) & (x == floor(x)) & (x < R_PosInf)) ? d : 0.0;
+   }
+};
+
+template<bool LOWER>
+struct qdpareto2_op {
+   /** P(X <= x) >= p (LOWER) or P(X > x) <= p, x integer */
+   static inline bool reached(double x, double p, double k, double s)
+   {
+      double r = __ppareto2<LOWER>(x+1.0, k, s);
+      return LOWER ? (r >= p) : (r <= p);
+   }
+
+   static inline double apply(double p, double k, double s)
+   {
+      // the smallest integer x >= 0 with P(X <= x) = P(Y < x+1) >= p,
+      // where Y ~ P2(k, s), i.e., ceil(Q_Y(p))-1, corrected for round-off
+      double y = qpareto2_op<LOWER>::apply(p, k, s);
+      if (!R_FINITE(y)) return y; // NaN or Inf
+      double x = std::max(0.0, ceil(y)-1.0);
+      if (!reached(x, p, k, s))
+         x += 1.0;
+      else if (x > 0.0 && reached(x-1.0, p, k, s))
+         x -= 1.0;
+      return x;
+   }
+};
+
+
+/* ------------------------------------------------------------------------- */
+
 /** Compute the c.d.f. of a Pareto2 distribution
  *
  * 10x+ faster than the original version:
@@ -42,103 +117,219 @@
  * @param k numeric vector
  * @param s numeric vector
  * @param lower_tail single logical value
- * @return real scalar (vector of length == 1)
+ * @return numeric vector
  */
 SEXP ppareto2(SEXP q, SEXP k, SEXP s, SEXP lower_tail)
 {
-   q = PROTECT(prepare_arg_double(q, "q"));
+   return pareto2_apply_tail<ppareto2_op>(q, k, s, lower_tail, "q");
+}
+
+
+/** Compute the density of a Pareto2 distribution
+ *
+ * @param x numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @return numeric vector
+ */
+SEXP dpareto2(SEXP x, SEXP k, SEXP s)
+{
+   return pareto2_apply<dpareto2_op>(x, k, s, "x");
+}
+
+
+/** Compute the quantile function of a Pareto2 distribution
+ *
+ * @param p numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param lower_tail single logical value
+ * @return numeric vector
+ */
+SEXP qpareto2(SEXP p, SEXP k, SEXP s, SEXP lower_tail)
+{
+   return pareto2_apply_tail<qpareto2_op>(p, k, s, lower_tail, "p");
+}
+
+
+/** Generate random deviates from a Pareto2 distribution
+ *
+ * @param n single numeric value
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param rng single string, "R" or "philox"
+ * @param nthreads single integer
+ * @return numeric vector
+ */
+SEXP rpareto2(SEXP n, SEXP k, SEXP s, SEXP rng, SEXP nthreads)
+{
+   return pareto2_random(n, k, s, rng, nthreads, false);
+}
+
+
+/** Compute the c.d.f. of a discretised Pareto2 distribution
+ *
+ * @param q numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param lower_tail single logical value
+ * @return numeric vector
+ */
+SEXP pdpareto2(SEXP q, SEXP k, SEXP s, SEXP lower_tail)
+{
+   return pareto2_apply_tail<pdpareto2_op>(q, k, s, lower_tail, "q");
+}
+
+
+/** Compute the p.m.f. of a discretised Pareto2 distribution
+ *
+ * @param x numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @return numeric vector
+ */
+SEXP ddpareto2(SEXP x, SEXP k, SEXP s)
+{
+   return pareto2_apply<ddpareto2_op>(x, k, s, "x");
+}
+
+
+/** Compute the quantile function of a discretised Pareto2 distribution
+ *
+ * @param p numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param lower_tail single logical value
+ * @return numeric vector
+ */
+SEXP qdpareto2(SEXP p, SEXP k, SEXP s, SEXP lower_tail)
+{
+   return pareto2_apply_tail<qdpareto2_op>(p, k, s, lower_tail, "p");
+}
+
+
+/** Generate random deviates from a discretised Pareto2 distribution
+ *
+ * @param n single numeric value
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param rng single string, "R" or "philox"
+ * @param nthreads single integer
+ * @return numeric vector
+ */
+SEXP rdpareto2(SEXP n, SEXP k, SEXP s, SEXP rng, SEXP nthreads)
+{
+   return pareto2_random(n, k, s, rng, nthreads, true);
+}
+
+
+/** Fill ret[from:to] with (discretised) Pareto2 deviates, Philox stream
+ *
+ * The i-th deviate is generated from the (i/2)-th block of the stream;
+ * therefore, the result does not depend on how [0:n] is partitioned.
+ *
+ * @param gen generator
+ * @param pk shape parameters
+ * @param nk number of shape parameters
+ * @param ps scale parameters
+ * @param ns number of scale parameters
+ * @param pret [out] output array
+ * @param from first index, even
+ * @param to one past the last index
+ */
+template<bool DISCRETE>
+void __pareto2_random_philox(const philox4x32& gen,
+   const double* pk, R_len_t nk, const double* ps, R_len_t ns,
+   double* pret, R_len_t from, R_len_t to)
+{
+   R_len_t ik = from%nk, is = from%ns;
+   double u[2];
+   for (R_len_t i=from; i<to; ++i) {
+      if (i%2 == 0) gen.unif2((uint64_t)(i/2), u);
+      // inverse transform: s*(U^(-1/k)-1), U ~ U(0, 1)
+      double x = ps[is]*expm1(-log(u[i%2])/pk[ik]);
+      pret[i] = DISCRETE ? floor(x) : x;
+      if (++ik == nk) ik = 0;
+      if (++is == ns) is = 0;
+   }
+}
+
+
+SEXP pareto2_random(SEXP n, SEXP k, SEXP s, SEXP rng, SEXP nthreads, bool discrete)
+{
+   n = PROTECT(prepare_arg_double_1(n, "n"));
    k = PROTECT(prepare_arg_double(k, "k"));
    s = PROTECT(prepare_arg_double(s, "s"));
-   lower_tail = PROTECT(prepare_arg_logical_1(lower_tail, "lower.tail"));
+   rng = PROTECT(prepare_arg_string_1(rng, "rng"));
+   nthreads = PROTECT(prepare_arg_integer_1(nthreads, "nthreads"));
+
+   double n_val = REAL(n)[0];
+   if (!(n_val >= 0.0 && n_val <= (double)INT_MAX)) // NA too
+      Rf_error(MSG__ARG_NOT_IN_AB, "n", 0.0, (double)INT_MAX);
+
+   if (STRING_ELT(rng, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "rng");
+   const char* rng_val = CHAR(STRING_ELT(rng, 0));
+   bool philox;
+   if (!strcmp(rng_val, "R")) philox = false;
+   else if (!strcmp(rng_val, "philox")) philox = true;
+   else Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   int nthreads_val = INTEGER(nthreads)[0];
+   if (nthreads_val == NA_INTEGER || nthreads_val < 1)
+      Rf_error(MSG__ARG_NOT_GE_A, "nthreads", 1.0);
 
-   R_len_t nq = LENGTH(q);
    R_len_t nk = LENGTH(k);
    R_len_t ns = LENGTH(s);
-   if (min(min(nq, nk), ns) <= 0) {
-      UNPROTECT(4);
-      return Rf_allocVector(REALSXP, 0);
-   }
-   int*    ptail = INTEGER(lower_tail);
-   if (ptail[0] == NA_LOGICAL)
-      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "lower.tail");
-
-   double* pq = REAL(q);
+   if (nk <= 0) Rf_error(MSG_ARG_TOO_SHORT, "k");
+   if (ns <= 0) Rf_error(MSG_ARG_TOO_SHORT, "s");
    double* pk = REAL(k);
    double* ps = REAL(s);
-   R_len_t n = max(max(nq, nk), ns);
-   if (n%nq != 0) Rf_warning(MSG__WARN_RECYCLE);
-   if (n%nk != 0) Rf_warning(MSG__WARN_RECYCLE);
-   if (n%ns != 0) Rf_warning(MSG__WARN_RECYCLE);
+   for (R_len_t i=0; i<nk; ++i)
+      if (ISNAN(pk[i])) Rf_error(MSG__ARG_EXPECTED_NOT_NA, "k");
+   for (R_len_t i=0; i<ns; ++i)
+      if (ISNAN(ps[i])) Rf_error(MSG__ARG_EXPECTED_NOT_NA, "s");
+   __pareto2_check_params(pk, nk, ps, ns);
 
+   R_len_t m = (R_len_t)n_val;
+   SEXP ret;
+   PROTECT(ret = Rf_allocVector(REALSXP, m));
+   double* pret = REAL(ret);
 
-
-   if (nk == 1 && ns == 1) { // the most typical case
-      double vs = ps[0];
-      double vk = pk[0];
-      if (ISNA(vs) || ISNA(vk)) {
-         UNPROTECT(4);
-         return vector_NA_double(n);
-      }
-
-      if (vs <= 0) Rf_error(MSG__ARG_NOT_GT_A, "s", 0.0);
-      if (vk <= 0) Rf_error(MSG__ARG_NOT_GT_A, "k", 0.0);
-
-      SEXP ret;
-      PROTECT(ret = Rf_allocVector(REALSXP, n));
-      double* pret = REAL(ret);
-      if ((bool)ptail[0]) {
-         for (R_len_t i=0; i<n; i++) {
-            pret[i] = (ISNA(pq[i]))?NA_REAL:
-               ((pq[i]>0)
-               ?(1.0-pow(vs/(vs+pq[i]), vk))
-               :(0.0));
-         }
+   if (!philox) {
+      GetRNGstate();
+      R_len_t ik = 0, is = 0;
+      for (R_len_t i=0; i<m; ++i) {
+         // inverse transform: s*(U^(-1/k)-1), U ~ U(0, 1)
+         double x = ps[is]*expm1(-log(unif_rand())/pk[ik]);
+         pret[i] = discrete ? floor(x) : x;
+         if (++ik == nk) ik = 0;
+         if (++is == ns) is = 0;
       }
-      else {
-         for (R_len_t i=0; i<n; i++) {
-            pret[i] = (ISNA(pq[i]))?NA_REAL:
-               ((pq[i])
-               ?(pow(vs/(vs+pq[i]), vk))
-               :(1.0));
-         }
-      }
-
-      UNPROTECT(5);
-      return ret;
+      PutRNGstate();
    }
    else {
-      SEXP ret;
-      PROTECT(ret = Rf_allocVector(REALSXP, n));
-      double* pret = REAL(ret);
-
-      if ((bool)ptail[0]) {
-         for (R_len_t i=0; i<n; i++) {
-            if (!ISNA(ps[i%ns]) && ps[i%ns] <= 0.0)
-               Rf_error(MSG__ARG_NOT_GT_A, "s", 0.0);
-            if (!ISNA(pk[i%nk]) && pk[i%nk] <= 0.0)
-               Rf_error(MSG__ARG_NOT_GT_A, "k", 0.0);
-
-            pret[i] = (ISNA(pq[i%nq]) || ISNA(ps[i%ns]) || ISNA(pk[i%nk]))?NA_REAL:
-               ((pq[i%nq]>0)
-               ?(1.0-pow(ps[i%ns]/(ps[i%ns]+pq[i%nq]), pk[i%nk]))
-               :(0.0));
-         }
-      }
-      else {
-         for (R_len_t i=0; i<n; i++) {
-            if (!ISNA(ps[i%ns]) && ps[i%ns] <= 0.0)
-               Rf_error(MSG__ARG_NOT_GT_A, "s", 0.0);
-            if (!ISNA(pk[i%nk]) && pk[i%nk] <= 0.0)
-               Rf_error(MSG__ARG_NOT_GT_A, "k", 0.0);
-
-            pret[i] = (ISNA(pq[i%nq]) || ISNA(ps[i%ns]) || ISNA(pk[i%nk]))?NA_REAL:
-               ((pq[i%nq])
-               ?(pow(ps[i%ns]/(ps[i%ns]+pq[i%nq]), pk[i%nk]))
-               :(1.0));
-         }
-      }
+      GetRNGstate();
+      philox4x32 gen = philox4x32::from_R_rng(); // reproducible via set.seed()
+      PutRNGstate();
 
-      UNPROTECT(5);
-      return ret;
+      // each thread fills whole chunks; the output does not depend
+      // on the number of threads used
+      const R_len_t chunk = 16384; // even
+      R_len_t nchunks = (m+chunk-1)/chunk;
+      #ifdef _OPENMP
+      #pragma omp parallel for schedule(static) num_threads(nthreads_val)
+      #endif
+      for (R_len_t c=0; c<nchunks; ++c) {
+         R_len_t from = c*chunk;
+         R_len_t to = (m-from > chunk) ? from+chunk : m;
+         if (discrete)
+            __pareto2_random_philox<true>(gen, pk, nk, ps, ns, pret, from, to);
+         else
+            __pareto2_random_philox<false>(gen, pk, nk, ps, ns, pret, from, to);
+      }
    }
+
+   UNPROTECT(6);
+   return ret;
 }
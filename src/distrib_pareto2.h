@@ -0,0 +1,244 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+#ifndef __distrib_pareto2_h
+#define __distrib_pareto2_h
+
+#include "agop.h"
+#include <climits>
+
+
+/* Distribution functions of the Pareto2 and discretised Pareto2
+ * families are defined as functors with a static `apply(x, k, s)`
+ * member, evaluated elementwise by the kernels below.
+ *
+ * All the computations are performed in the log domain, based on
+ * log(s^k/(s+x)^k) = -k*log1p(x/s); this avoids pow() calls and
+ * catastrophic cancellation for small x.
+ */
+
+
+/** The c.d.f. (or the survival function) of a Pareto2 distribution
+ *
+ * Branch-free (q <= 0 is handled by a select), so that loops calling it
+ * may be vectorised (e.g., with SIMD math libraries).
+ *
+ * @param q quantile, not NaN
+ * @param k shape, > 0
+ * @param s scale, > 0
+ * @return P(X <= q) if LOWER, P(X > q) otherwise
+ */
+template<bool LOWER>
+inline double __ppareto2(double q, double k, double s)
+{
+   double t = -k*log1p(q/s); // garbage if q <= -s
+   double r = LOWER ? -expm1(t) : exp(t);
+   return (q > 0.0) ? r : (LOWER ? 0.0 : 1.0);
+}
+
+
+/** Elementwise ret[i] = OP::apply(x[i%nx], k[i%nk], s[i%ns])
+ *
+ * Recycling is performed by means of counters, with no modulo operations;
+ * NAs (NaNs) are propagated.
+ */
+template<class OP>
+void __pareto2_apply(const double* px, R_len_t nx,
+   const double* pk, R_len_t nk, const double* ps, R_len_t ns,
+   double* pret, R_len_t n)
+{
+   if (nk == 1 && ns == 1) { // the most typical case, nx == n
+      double vk = pk[0];
+      double vs = ps[0];
+      if (ISNAN(vk) || ISNAN(vs)) {
+         for (R_len_t i=0; i<n; ++i) pret[i] = NA_REAL;
+         return;
+      }
+
+      for (R_len_t i=0; i<n; ++i) {
+         double xi = px[i];
+         double ri = OP::apply(xi, vk, vs);
+         pret[i] = ISNAN(xi) ? xi : ri; // a select, not a branch
+      }
+   }
+   else {
+      R_len_t ix = 0, ik = 0, is = 0;
+      for (R_len_t i=0; i<n; ++i) {
+         double xi = px[ix], ki = pk[ik], si = ps[is];
+         double ri = OP::apply(xi, ki, si);
+         ri = ISNAN(si) ? si : ri;
+         ri = ISNAN(ki) ? ki : ri;
+         pret[i] = ISNAN(xi) ? xi : ri;
+         if (++ix == nx) ix = 0;
+         if (++ik == nk) ik = 0;
+         if (++is == ns) is = 0;
+      }
+   }
+}
+
+
+/** Check if all the shape and scale parameters are positive (or NA)
+ *
+ * @param pk shape parameters
+ * @param nk number of shape parameters
+ * @param ps scale parameters
+ * @param ns number of scale parameters
+ */
+inline void __pareto2_check_params(const double* pk, R_len_t nk,
+   const double* ps, R_len_t ns)
+{
+   // validate the parameters once, not per element; NAs compare false
+   for (R_len_t i=0; i<nk; ++i)
+      if (pk[i] <= 0.0) Rf_error(MSG__ARG_NOT_GT_A, "k", 0.0);
+   for (R_len_t i=0; i<ns; ++i)
+      if (ps[i] <= 0.0) Rf_error(MSG__ARG_NOT_GT_A, "s", 0.0);
+}
+
+
+/** Apply a Pareto2 distribution function, with R-style recycling
+ *
+ * @param x numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param xname name of x (for error messages)
+ * @return numeric vector
+ */
+template<class OP>
+SEXP pareto2_apply(SEXP x, SEXP k, SEXP s, const char* xname)
+{
+   x = PROTECT(prepare_arg_double(x, xname));
+   k = PROTECT(prepare_arg_double(k, "k"));
+   s = PROTECT(prepare_arg_double(s, "s"));
+
+   R_len_t nx = LENGTH(x);
+   R_len_t nk = LENGTH(k);
+   R_len_t ns = LENGTH(s);
+   if (min(min(nx, nk), ns) <= 0) {
+      UNPROTECT(3);
+      return Rf_allocVector(REALSXP, 0);
+   }
+
+   double* px = REAL(x);
+   double* pk = REAL(k);
+   double* ps = REAL(s);
+   R_len_t n = max(max(nx, nk), ns);
+   if (n%nx != 0) Rf_warning(MSG__WARN_RECYCLE);
+   if (n%nk != 0) Rf_warning(MSG__WARN_RECYCLE);
+   if (n%ns != 0) Rf_warning(MSG__WARN_RECYCLE);
+   __pareto2_check_params(pk, nk, ps, ns);
+
+   SEXP ret;
+   PROTECT(ret = Rf_allocVector(REALSXP, n));
+   __pareto2_apply<OP>(px, nx, pk, nk, ps, ns, REAL(ret), n);
+   UNPROTECT(4);
+   return ret;
+}
+
+
+/** Apply a Pareto2 distribution function, lower or upper tail
+ *
+ * @param x numeric vector
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param lower_tail single logical value
+ * @param xname name of x (for error messages)
+ * @return numeric vector
+ */
+template<template<bool> class OP>
+SEXP pareto2_apply_tail(SEXP x, SEXP k, SEXP s, SEXP lower_tail, const char* xname)
+{
+   lower_tail = PROTECT(prepare_arg_logical_1(lower_tail, "lower.tail"));
+   int lower_tail_val = LOGICAL(lower_tail)[0];
+   UNPROTECT(1);
+   if (lower_tail_val == NA_LOGICAL)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "lower.tail");
+
+   if (lower_tail_val)
+      return pareto2_apply< OP<true> >(x, k, s, xname);
+   else
+      return pareto2_apply< OP<false> >(x, k, s, xname);
+}
+
+
+/** Generate random deviates from a (discretised) Pareto2 distribution
+ *
+ * Inverse transform sampling with R's RNG or a counter-based
+ * Philox stream (seeded with R's RNG, possibly multithreaded);
+ * k and s are recycled.
+ *
+ * @param n single numeric value
+ * @param k numeric vector
+ * @param s numeric vector
+ * @param rng single string, "R" or "philox"
+ * @param nthreads single integer
+ * @param discrete whether the floor of each variate is taken
+ * @return numeric vector
+ */
+SEXP pareto2_random(SEXP n, SEXP k, SEXP s, SEXP rng, SEXP nthreads, bool discrete);
+
+
+/** A batch of samples to fit a distribution to */
+struct pareto2_samples {
+   R_len_t count;     ///< number of samples
+   const double** x;  ///< x[i] is the i-th sample
+   R_len_t* n;        ///< n[i] is the size of the i-th sample
+   bool batch;        ///< false if a single numeric vector was given
+   SEXP names;        ///< R_NilValue or names of the samples
+};
+
+
+/** Prepare a batch of samples
+ *
+ * @param x numeric vector (a single sample, or many samples if offsets
+ *    is not NULL) or a list of numeric vectors
+ * @param offsets NULL or an integer vector of length count+1 such that
+ *    the i-th sample is x[offsets[i]:(offsets[i+1]-1)], with offsets[0]==0,
+ *    offsets[count]==length(x) (CSR-like layout)
+ * @param samples [out]
+ * @return an object that keeps the data referenced to by samples,
+ *    to be PROTECTed by the caller
+ */
+SEXP pareto2_prepare_samples(SEXP x, SEXP offsets, pareto2_samples* samples);
+
+
+/** Check if all the elements in a sample are finite and non-negative
+ *
+ * @param x sample
+ * @param n sample size, >= minsize is required
+ * @param minsize minimal sample size
+ */
+void pareto2_check_sample(const double* x, R_len_t n, R_len_t minsize);
+
+
+/** Allocate a vector or a matrix to store the parameter estimates
+ *
+ * The estimates of k are stored at ret[0:count], and of s
+ * at ret[count:2*count].
+ * If samples.batch is false, c(k=..., s=...) is returned;
+ * otherwise, it is a matrix with columns `k` and `s`.
+ *
+ * @param samples batch of samples
+ * @return numeric vector or matrix, not protected
+ */
+SEXP pareto2_alloc_estimates(const pareto2_samples& samples);
+
+#endif
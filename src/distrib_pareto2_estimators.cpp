@@ -0,0 +1,387 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "distrib_pareto2.h"
+
+
+SEXP pareto2_prepare_samples(SEXP x, SEXP offsets, pareto2_samples* samples)
+{
+   SEXP data;
+   samples->names = R_NilValue;
+
+   if (Rf_isVectorList(x)) {
+      if (!Rf_isNull(offsets)) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      R_len_t count = LENGTH(x);
+      PROTECT(data = Rf_allocVector(VECSXP, count));
+      samples->count = count;
+      samples->batch = true;
+      samples->names = Rf_getAttrib(x, R_NamesSymbol);
+      samples->x = (const double**)R_alloc(count, sizeof(const double*));
+      samples->n = (R_len_t*)R_alloc(count, sizeof(R_len_t));
+      for (R_len_t i=0; i<count; ++i) {
+         SEXP xi = prepare_arg_double(VECTOR_ELT(x, i), "x");
+         SET_VECTOR_ELT(data, i, xi);
+         samples->x[i] = REAL(xi);
+         samples->n[i] = LENGTH(xi);
+      }
+   }
+   else {
+      PROTECT(data = prepare_arg_double(x, "x"));
+      R_len_t nx = LENGTH(data);
+      const double* px = REAL(data);
+
+      if (Rf_isNull(offsets)) {
+         samples->count = 1;
+         samples->batch = false;
+         samples->x = (const double**)R_alloc(1, sizeof(const double*));
+         samples->n = (R_len_t*)R_alloc(1, sizeof(R_len_t));
+         samples->x[0] = px;
+         samples->n[0] = nx;
+      }
+      else {
+         offsets = PROTECT(prepare_arg_integer(offsets, "offsets"));
+         R_len_t count = LENGTH(offsets)-1;
+         const int* po = INTEGER(offsets);
+         if (count < 0 || po[0] != 0 || po[count] != nx)
+            Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+         samples->count = count;
+         samples->batch = true;
+         samples->x = (const double**)R_alloc(count, sizeof(const double*));
+         samples->n = (R_len_t*)R_alloc(count, sizeof(R_len_t));
+         for (R_len_t i=0; i<count; ++i) {
+            if (po[i+1] == NA_INTEGER || po[i+1] < po[i])
+               Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+            samples->x[i] = px+po[i];
+            samples->n[i] = po[i+1]-po[i];
+         }
+         UNPROTECT(1);
+      }
+   }
+
+   UNPROTECT(1);
+   return data;
+}
+
+
+void pareto2_check_sample(const double* x, R_len_t n, R_len_t minsize)
+{
+   if (n < minsize) Rf_error(MSG_ARG_TOO_SHORT, "x");
+   for (R_len_t i=0; i<n; ++i) {
+      if (!R_FINITE(x[i])) Rf_error(MSG__ARG_EXPECTED_FINITE, "x");
+      if (x[i] < 0.0) Rf_error(MSG__ARG_NOT_GE_A, "x", 0.0);
+   }
+}
+
+
+SEXP pareto2_alloc_estimates(const pareto2_samples& samples)
+{
+   SEXP ret, names;
+   if (!samples.batch) {
+      PROTECT(ret = Rf_allocVector(REALSXP, 2));
+      PROTECT(names = Rf_allocVector(STRSXP, 2));
+      SET_STRING_ELT(names, 0, Rf_mkChar("k"));
+      SET_STRING_ELT(names, 1, Rf_mkChar("s"));
+      Rf_setAttrib(ret, R_NamesSymbol, names);
+      UNPROTECT(2);
+   }
+   else {
+      PROTECT(ret = Rf_allocMatrix(REALSXP, samples.count, 2));
+      PROTECT(names = Rf_allocVector(VECSXP, 2));
+      SEXP colnames = Rf_allocVector(STRSXP, 2);
+      SET_VECTOR_ELT(names, 1, colnames);
+      SET_STRING_ELT(colnames, 0, Rf_mkChar("k"));
+      SET_STRING_ELT(colnames, 1, Rf_mkChar("s"));
+      SET_VECTOR_ELT(names, 0, samples.names);
+      Rf_setAttrib(ret, R_DimNamesSymbol, names);
+      UNPROTECT(2);
+   }
+   return ret;
+}
+
+
+/** Evaluate the MLE score equation for s and its derivative
+ *
+ * Each element of x is visited once; all the sums are accumulated
+ * in a single pass.
+ *
+ * @param x sample
+ * @param n sample size
+ * @param s scale parameter, > 0
+ * @param df [out] derivative of the score function w.r.t. s
+ * @param A [out] sum(log(1+x/s))
+ * @return value of the score function,
+ *    1+sum(log(1+x/s))/n-n/sum(1/(1+x/s))
+ */
+static double __pareto2_mle_score(const double* x, R_len_t n, double s,
+   double* df, double* A)
+{
+   double sa = 0.0, sb = 0.0, sda = 0.0, sdb = 0.0;
+   double s_inv = 1.0/s;
+   for (R_len_t i=0; i<n; ++i) {
+      double t = x[i]*s_inv;
+      double d_inv = 1.0/(1.0+t);
+      double td = t*d_inv;
+      sa  += log1p(t);
+      sb  += d_inv;
+      sda += td;
+      sdb += td*d_inv;
+   }
+   // d/ds log(1+x/s) = -t/(s*(1+t)), d/ds 1/(1+x/s) = t/(s*(1+t)^2)
+   double dn = (double)n;
+   *A  = sa;
+   *df = (-sda/dn + dn*sdb/(sb*sb))*s_inv;
+   return 1.0 + sa/dn - dn/sb;
+}
+
+
+/** Find the MLE of s in [smin, smax]
+ *
+ * Safeguarded Newton's method (the Newton step is replaced
+ * with a bisection step if it leaves the bracket or converges slowly).
+ *
+ * @param x sample
+ * @param n sample size
+ * @param smin lower bound
+ * @param smax upper bound
+ * @param tol convergence tolerance
+ * @param A [out] sum(log(1+x/s)) for the s found
+ * @return the root or NA_REAL if the score function has the same sign
+ *    at both ends of the interval
+ */
+static double __pareto2_mle_s(const double* x, R_len_t n,
+   double smin, double smax, double tol, double* A)
+{
+   double df;
+   double flo = __pareto2_mle_score(x, n, smin, &df, A);
+   double fhi = __pareto2_mle_score(x, n, smax, &df, A);
+   if (!(flo*fhi < 0.0)) return NA_REAL;
+
+   double lo = smin, hi = smax;  // f(lo) < 0 < f(hi)
+   if (flo > 0.0) std::swap(lo, hi);
+
+   double r = 0.5*(smin+smax);
+   double dx = fabs(smax-smin), dxold = dx;
+   double f = __pareto2_mle_score(x, n, r, &df, A);
+   for (int it=0; it<1000; ++it) {
+      if ((((r-hi)*df-f)*((r-lo)*df-f) > 0.0) || (fabs(2.0*f) > fabs(dxold*df))) {
+         dxold = dx;
+         dx = 0.5*(hi-lo);
+         r = lo+dx;
+      }
+      else {
+         dxold = dx;
+         dx = f/df;
+         r -= dx;
+      }
+      f = __pareto2_mle_score(x, n, r, &df, A);
+      if (fabs(dx) < tol || f == 0.0) break;
+      if (f < 0.0) lo = r; else hi = r;
+   }
+   return r;
+}
+
+
+/** Pareto2 distribution parameters' MLE
+ *
+ * @param x numeric vector, list of numeric vectors, or numeric vector
+ *    split at offsets
+ * @param s numeric vector, known scale parameters or NA (recycled)
+ * @param smin single numeric value
+ * @param smax single numeric value
+ * @param tol single numeric value
+ * @param offsets NULL or integer vector, see pareto2_prepare_samples()
+ * @return numeric vector of length 2 or a matrix with 2 columns
+ */
+SEXP pareto2_estimate_mle(SEXP x, SEXP s, SEXP smin, SEXP smax, SEXP tol, SEXP offsets)
+{
+   pareto2_samples samples;
+   x = PROTECT(pareto2_prepare_samples(x, offsets, &samples));
+   s = PROTECT(prepare_arg_double(s, "s"));
+   smin = PROTECT(prepare_arg_double_1(smin, "smin"));
+   smax = PROTECT(prepare_arg_double_1(smax, "smax"));
+   tol = PROTECT(prepare_arg_double_1(tol, "tol"));
+
+   R_len_t ns = LENGTH(s);
+   const double* ps = REAL(s);
+   double smin_val = REAL(smin)[0];
+   double smax_val = REAL(smax)[0];
+   double tol_val = REAL(tol)[0];
+   if (ns <= 0) Rf_error(MSG_ARG_TOO_SHORT, "s");
+   for (R_len_t i=0; i<ns; ++i)
+      if (ps[i] <= 0.0) Rf_error(MSG__ARG_NOT_GT_A, "s", 0.0);
+   if (!(smin_val > 0.0)) Rf_error(MSG__ARG_NOT_GT_A, "smin", 0.0);
+   if (!(smax_val > smin_val)) Rf_error(MSG__ARG_NOT_GT_A, "smax", smin_val);
+   if (!(tol_val > 0.0)) Rf_error(MSG__ARG_NOT_GT_A, "tol", 0.0);
+
+   for (R_len_t i=0; i<samples.count; ++i)
+      pareto2_check_sample(samples.x[i], samples.n[i], 2);
+
+   SEXP ret;
+   PROTECT(ret = pareto2_alloc_estimates(samples));
+   double* pk = REAL(ret);
+   double* pret_s = REAL(ret)+samples.count;
+
+   R_len_t nfailed = 0;
+   R_len_t is = 0;
+   for (R_len_t i=0; i<samples.count; ++i) {
+      const double* xi = samples.x[i];
+      R_len_t ni = samples.n[i];
+      double si = ps[is];
+      if (++is == ns) is = 0;
+
+      if (!ISNAN(si)) { // known s => unbiased estimator of k
+         double A = 0.0;
+         for (R_len_t j=0; j<ni; ++j) A += log1p(xi[j]/si);
+         pk[i] = (ni-1)/A;
+         pret_s[i] = si;
+      }
+      else {
+         double A;
+         si = __pareto2_mle_s(xi, ni, smin_val, smax_val, tol_val, &A);
+         if (ISNAN(si)) {
+            ++nfailed;
+            pk[i] = NA_REAL;
+            pret_s[i] = NA_REAL;
+         }
+         else {
+            pk[i] = ni/A;
+            pret_s[i] = si;
+         }
+      }
+   }
+
+   if (nfailed > 0)
+      Rf_warning("Maximum of the likelihood function could not be found");
+
+   UNPROTECT(6);
+   return ret;
+}
+
+
+/** Zhang-Stevens MMSE of the Pareto2 distribution parameters
+ *
+ * The profile log-likelihoods at all the m grid points are accumulated
+ * in a single blocked pass over x; the posterior weights are computed
+ * with the log-sum-exp trick.
+ *
+ * @param x sample, finite, non-negative
+ * @param n sample size, >= 2
+ * @param buf [tmp] array of length >= n+2*(20+floor(sqrt(n)))
+ * @param k [out] estimated shape
+ * @param s [out] estimated scale
+ */
+static void __pareto2_mmse(const double* x, R_len_t n, double* buf,
+   double* k, double* s)
+{
+   R_len_t m = 20+(R_len_t)floor(sqrt((double)n));
+   double* b = buf;       // grid
+   double* L = buf+m;     // log-likelihoods
+   double* xs = buf+2*m;  // a copy of x, for the order statistics
+
+   // only two order statistics are needed; no need to sort
+   for (R_len_t i=0; i<n; ++i) xs[i] = x[i];
+   R_len_t iq = (R_len_t)floor(n/4.0+0.5)-1;
+   std::nth_element(xs, xs+iq, xs+n);
+   double xq = xs[iq];
+   double xmax = *std::max_element(xs+iq, xs+n);
+
+   for (R_len_t j=0; j<m; ++j) {
+      b[j] = 1.0/xmax+(1.0-sqrt(m/(j+0.5)))/3.0/xq;
+      L[j] = 0.0;
+   }
+
+   // L[j] = sum(log(1-b[j]*x)); the block of x stays in the L1 cache
+   const R_len_t block = 256;
+   for (R_len_t i0=0; i0<n; i0+=block) {
+      R_len_t i1 = min(i0+block, n);
+      for (R_len_t j=0; j<m; ++j) {
+         double bj = b[j], lj = 0.0;
+         for (R_len_t i=i0; i<i1; ++i)
+            lj += log1p(-bj*x[i]);
+         L[j] += lj;
+      }
+   }
+
+   double Lmax = R_NegInf;
+   for (R_len_t j=0; j<m; ++j) {
+      double kj = -L[j]/n;
+      L[j] = n*(log(b[j]/kj)+kj-1.0);
+      if (L[j] > Lmax) Lmax = L[j];
+   }
+
+   // w[j] = 1/sum(exp(L-L[j])) = exp(L[j]-Lmax)/sum(exp(L-Lmax))
+   double wsum = 0.0, bw = 0.0;
+   for (R_len_t j=0; j<m; ++j) {
+      double wj = exp(L[j]-Lmax);
+      wsum += wj;
+      bw += b[j]*wj;
+   }
+   double bhat = bw/wsum;
+
+   double lsum = 0.0;
+   for (R_len_t i=0; i<n; ++i)
+      lsum += log1p(-bhat*x[i]);
+
+   *k = n/lsum;
+   *s = -1.0/bhat;
+}
+
+
+/** Pareto2 distribution parameters' MMSE
+ *
+ * @param x numeric vector, list of numeric vectors, or numeric vector
+ *    split at offsets
+ * @param offsets NULL or integer vector, see pareto2_prepare_samples()
+ * @return numeric vector of length 2 or a matrix with 2 columns
+ */
+SEXP pareto2_estimate_mmse(SEXP x, SEXP offsets)
+{
+   pareto2_samples samples;
+   x = PROTECT(pareto2_prepare_samples(x, offsets, &samples));
+
+   R_len_t nmax = 0;
+   for (R_len_t i=0; i<samples.count; ++i) {
+      pareto2_check_sample(samples.x[i], samples.n[i], 2);
+      nmax = max(nmax, samples.n[i]);
+   }
+
+   double* buf = (double*)R_alloc(nmax+2*(20+(R_len_t)floor(sqrt((double)nmax))), sizeof(double));
+
+   SEXP ret;
+   PROTECT(ret = pareto2_alloc_estimates(samples));
+   double* pk = REAL(ret);
+   double* ps = REAL(ret)+samples.count;
+
+   bool knonpos = false, snonpos = false;
+   for (R_len_t i=0; i<samples.count; ++i) {
+      __pareto2_mmse(samples.x[i], samples.n[i], buf, pk+i, ps+i);
+      if (pk[i] <= 0.0) knonpos = true;
+      if (ps[i] <= 0.0) snonpos = true;
+   }
+
+   if (knonpos) Rf_warning("estimated shape parameter <= 0");
+   if (snonpos) Rf_warning("estimated scale parameter <= 0");
+
+   UNPROTECT(2);
+   return ret;
+}
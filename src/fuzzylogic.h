@@ -0,0 +1,840 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+#ifndef __fuzzylogic_h
+#define __fuzzylogic_h
+
+#include "agop.h"
+
+
+/* Fuzzy logic connectives are defined as functors with an
+ * `apply()` member, and evaluated by the templated elementwise kernels
+ * below. Parametric connectives store their per-call constants
+ * in the functor object.
+ *
+ * The inputs are validated in a separate, branch-free pre-pass,
+ * so that the main loops contain neither function calls nor
+ * early exits and can be auto-vectorised by the compiler.
+ * Missing values are propagated by masking: `apply()` is evaluated
+ * for all elements and the result is replaced afterwards.
+ * Therefore, `apply()` should be branch-free too (prefer `&` and `|`
+ * over `&&` and `||` when comparing) and must not assume that
+ * its arguments are not NaN.
+ */
+
+
+/** Are all the elements in x in [0,1]?
+ *
+ * NAs and NaNs compare false and hence are ignored.
+ *
+ * @param x pointer to the data
+ * @param n number of elements
+ * @return bool
+ */
+inline bool __fuzzylogic_check_range(const double* x, R_len_t n)
+{
+   // selects instead of short-circuit operators: this loop vectorises
+   double bad = 0.0;
+   for (R_len_t i=0; i<n; ++i) {
+      double xi = x[i];
+      bad = (xi < 0.0) ? 1.0 : bad;
+      bad = (xi > 1.0) ? 1.0 : bad;
+   }
+   return (bad == 0.0);
+}
+
+
+/** Elementwise res[i] = op.apply(x[i])
+ *
+ * NaNs in x are propagated as-is.
+ */
+template<class OP>
+inline void __fuzzylogic_apply_unary(const OP& op, const double* x, double* res, R_len_t n)
+{
+   for (R_len_t i=0; i<n; ++i) {
+      double xi = x[i];
+      double ri = op.apply(xi);
+      res[i] = ISNAN(xi) ? xi : ri; // a select, not a branch
+   }
+}
+
+
+/** Elementwise res[i] = op.apply(x[i*SX], y[i*SY])
+ *
+ * The strides, SX and SY, are either 0 (a scalar is broadcast)
+ * or 1 (contiguous data); they are compile-time constants so that
+ * the scalar operand is kept in a register.
+ *
+ * If x[i] (or else y[i]) is NA/NaN, then res[i] is set to it.
+ * Only selects are used here (no conditional arithmetic), as otherwise
+ * the compiler would not be able to if-convert the loop.
+ */
+template<class OP, int SX, int SY>
+inline void __fuzzylogic_apply_binary(const OP& op, const double* x, const double* y, double* res, R_len_t n)
+{
+   for (R_len_t i=0; i<n; ++i) {
+      double xi = x[i*SX];
+      double yi = y[i*SY];
+      double ri = op.apply(xi, yi);
+      ri = ISNAN(yi) ? yi : ri;
+      res[i] = ISNAN(xi) ? xi : ri;
+   }
+}
+
+
+/** Elementwise res[i] = op.apply(x[i%nx], y[i%ny]), i=0,...,n-1
+ *
+ * R-style recycling with no temporary copies: the output is processed
+ * in contiguous runs over which neither x nor y wraps around,
+ * so no modulo operation is performed in the inner loop.
+ */
+template<class OP>
+void __fuzzylogic_apply_binary_recycle(const OP& op, const double* x, R_len_t nx,
+   const double* y, R_len_t ny, double* res, R_len_t n)
+{
+   if (nx == n && ny == n)
+      __fuzzylogic_apply_binary<OP, 1, 1>(op, x, y, res, n);
+   else if (nx == 1)
+      __fuzzylogic_apply_binary<OP, 0, 1>(op, x, y, res, n); // then ny == n
+   else if (ny == 1)
+      __fuzzylogic_apply_binary<OP, 1, 0>(op, x, y, res, n); // then nx == n
+   else {
+      R_len_t i = 0, ix = 0, iy = 0;
+      while (i < n) {
+         R_len_t m = std::min(std::min(nx-ix, ny-iy), n-i);
+         __fuzzylogic_apply_binary<OP, 1, 1>(op, x+ix, y+iy, res+i, m);
+         i += m;
+         ix += m; if (ix == nx) ix = 0;
+         iy += m; if (iy == ny) iy = 0;
+      }
+   }
+}
+
+
+/** Elementwise res[i+j*nx] = op.apply(x[i], y[j])
+ *
+ * The outer product: x is treated as a column and y as a row vector;
+ * res is a column-major nx*ny matrix.
+ */
+template<class OP>
+void __fuzzylogic_apply_binary_outer(const OP& op, const double* x, R_len_t nx,
+   const double* y, R_len_t ny, double* res)
+{
+   for (R_len_t j=0; j<ny; ++j)
+      __fuzzylogic_apply_binary<OP, 1, 0>(op, x, y+j, res+(R_xlen_t)j*nx, nx);
+}
+
+
+/** Copy the dim, dimnames, and names attributes (if any) */
+inline void __fuzzylogic_copy_dim(SEXP from, SEXP to)
+{
+   Rf_setAttrib(to, R_DimSymbol,      Rf_getAttrib(from, R_DimSymbol));
+   Rf_setAttrib(to, R_DimNamesSymbol, Rf_getAttrib(from, R_DimNamesSymbol));
+   Rf_setAttrib(to, R_NamesSymbol,    Rf_getAttrib(from, R_NamesSymbol));
+}
+
+
+/** Prepare the output buffer
+ *
+ * The result is written to `out` (if given) instead of to a newly
+ * allocated vector; `out` may be one of the inputs, as all the kernels
+ * above read the i-th input elements before writing res[i].
+ *
+ * @param out NULL or a numeric vector (of type double) of length n
+ * @param n required length
+ * @return out or a new numeric vector of length n
+ */
+inline SEXP __fuzzylogic_prepare_out(SEXP out, R_xlen_t n)
+{
+   if (Rf_isNull(out))
+      return Rf_allocVector(REALSXP, n);
+   if (TYPEOF(out) != REALSXP || XLENGTH(out) != n)
+      Rf_error(MSG__ARG_EXPECTED_DOUBLE_N, "out", (double)n);
+   return out;
+}
+
+
+/** Apply a unary fuzzy logic connective
+ *
+ * @param x numeric vector with elements in [0,1]
+ * @param out NULL or a numeric vector to store the result in
+ * @param op connective
+ * @return numeric vector
+ */
+template<class OP>
+SEXP fuzzylogic_apply_unary(SEXP x, SEXP out, const OP& op=OP())
+{
+   x = PROTECT(prepare_arg_double(x, "x"));
+   R_len_t x_length = LENGTH(x);
+   double* x_tab = REAL(x);
+   if (x_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
+   if (!__fuzzylogic_check_range(x_tab, x_length))
+      Rf_error(MSG__ARG_NOT_IN_AB, "x", 0.0, 1.0);
+
+   SEXP res;
+   PROTECT(res = __fuzzylogic_prepare_out(out, x_length));
+   __fuzzylogic_apply_unary<OP>(op, x_tab, REAL(res), x_length);
+   if (Rf_isNull(out))
+      __fuzzylogic_copy_dim(x, res);
+   UNPROTECT(2);
+   return res;
+}
+
+
+/** Apply a binary fuzzy logic connective
+ *
+ * If outer is FALSE, the shorter of x and y is recycled
+ * (with a warning if the longer length is not a multiple of the shorter);
+ * the result inherits the dim, dimnames and names attributes
+ * of the longer argument (or x, unless only y is a matrix,
+ * if they are of equal lengths).
+ *
+ * If outer is TRUE, a length(x)*length(y) matrix with
+ * res[i,j] = OP(x[i], y[j]) is returned.
+ *
+ * If out is not NULL, the result is written there (as-is,
+ * without setting any attributes) and out is returned.
+ *
+ * @param x numeric vector with elements in [0,1]
+ * @param y numeric vector with elements in [0,1]
+ * @param outer single logical value
+ * @param out NULL or a numeric vector to store the result in
+ * @param op connective
+ * @return numeric vector or matrix
+ */
+template<class OP>
+SEXP fuzzylogic_apply_binary(SEXP x, SEXP y, SEXP outer, SEXP out, const OP& op=OP())
+{
+   x = PROTECT(prepare_arg_double(x, "x"));
+   y = PROTECT(prepare_arg_double(y, "y"));
+   outer = PROTECT(prepare_arg_logical_1(outer, "outer"));
+   R_len_t x_length = LENGTH(x);
+   R_len_t y_length = LENGTH(y);
+   double* x_tab = REAL(x);
+   double* y_tab = REAL(y);
+   int outer_val = LOGICAL(outer)[0];
+   if (x_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "x");
+   if (y_length <= 0) Rf_error(MSG_ARG_TOO_SHORT, "y");
+   if (outer_val == NA_LOGICAL)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "outer");
+   if (!__fuzzylogic_check_range(x_tab, x_length))
+      Rf_error(MSG__ARG_NOT_IN_AB, "x", 0.0, 1.0);
+   if (!__fuzzylogic_check_range(y_tab, y_length))
+      Rf_error(MSG__ARG_NOT_IN_AB, "y", 0.0, 1.0);
+
+   SEXP res;
+   if (outer_val && !Rf_isNull(out)) {
+      PROTECT(res = __fuzzylogic_prepare_out(out, (R_xlen_t)x_length*y_length));
+      __fuzzylogic_apply_binary_outer<OP>(op, x_tab, x_length, y_tab, y_length, REAL(res));
+   }
+   else if (outer_val) {
+      PROTECT(res = Rf_allocMatrix(REALSXP, x_length, y_length));
+      __fuzzylogic_apply_binary_outer<OP>(op, x_tab, x_length, y_tab, y_length, REAL(res));
+
+      SEXP x_names = Rf_getAttrib(x, R_NamesSymbol);
+      SEXP y_names = Rf_getAttrib(y, R_NamesSymbol);
+      if (!Rf_isNull(x_names) || !Rf_isNull(y_names)) {
+         SEXP dimnames;
+         PROTECT(dimnames = Rf_allocVector(VECSXP, 2));
+         SET_VECTOR_ELT(dimnames, 0, x_names);
+         SET_VECTOR_ELT(dimnames, 1, y_names);
+         Rf_setAttrib(res, R_DimNamesSymbol, dimnames);
+         UNPROTECT(1);
+      }
+   }
+   else {
+      R_len_t n = std::max(x_length, y_length);
+      if (n%x_length != 0 || n%y_length != 0)
+         Rf_warning(MSG__WARN_RECYCLE);
+
+      PROTECT(res = __fuzzylogic_prepare_out(out, n));
+      __fuzzylogic_apply_binary_recycle<OP>(op, x_tab, x_length, y_tab, y_length, REAL(res), n);
+      if (Rf_isNull(out)) {
+         if (x_length == n && (y_length != n || !Rf_isNull(Rf_getAttrib(x, R_DimSymbol))))
+            __fuzzylogic_copy_dim(x, res);
+         else
+            __fuzzylogic_copy_dim(y, res);
+      }
+   }
+   UNPROTECT(4);
+   return res;
+}
+
+
+
+
+/* ------------------------------------------------------------------------- */
+/* t-norms                                                                   */
+
+struct tnorm_minimum_op {
+   static inline double apply(double x, double y)
+   { return std::min(x, y); }
+};
+
+struct tnorm_product_op {
+   static inline double apply(double x, double y)
+   { return x*y; }
+};
+
+struct tnorm_lukasiewicz_op {
+   static inline double apply(double x, double y)
+   { return std::max(x+y-1.0, 0.0); }
+};
+
+struct tnorm_drastic_op {
+   static inline double apply(double x, double y)
+   { return ((x < 1.0) & (y < 1.0)) ? 0.0 : std::min(x, y); }
+};
+
+struct tnorm_fodor_op {
+   static inline double apply(double x, double y)
+   { return (x + y <= 1.0) ? 0.0 : std::min(x, y); }
+};
+
+
+/* ------------------------------------------------------------------------- */
+/* t-conorms                                                                 */
+
+struct tconorm_minimum_op {
+   static inline double apply(double x, double y)
+   { return std::max(x, y); }
+};
+
+struct tconorm_product_op {
+   static inline double apply(double x, double y)
+   { return x + y - x*y; }
+};
+
+struct tconorm_lukasiewicz_op {
+   static inline double apply(double x, double y)
+   { return std::min(x+y, 1.0); }
+};
+
+struct tconorm_drastic_op {
+   static inline double apply(double x, double y)
+   { return ((x > 0.0) & (y > 0.0)) ? 1.0 : std::max(x, y); }
+};
+
+struct tconorm_fodor_op {
+   static inline double apply(double x, double y)
+   { return (x + y >= 1.0) ? 1.0 : std::max(x, y); }
+};
+
+
+/* ------------------------------------------------------------------------- */
+/* fuzzy negations                                                           */
+
+struct fnegation_classic_op {
+   static inline double apply(double x)
+   { return 1.0-x; }
+};
+
+struct fnegation_yager_op {
+   static inline double apply(double x)
+   { return sqrt(1.0-x*x); }
+};
+
+struct fnegation_minimal_op {
+   static inline double apply(double x)
+   { return (x == 0.0) ? 1.0 : 0.0; }
+};
+
+struct fnegation_maximal_op {
+   static inline double apply(double x)
+   { return (x < 1.0) ? 1.0 : 0.0; }
+};
+
+
+/* ------------------------------------------------------------------------- */
+/* fuzzy implications                                                        */
+
+struct fimplication_minimal_op {
+   static inline double apply(double x, double y)
+   { return (double)((x == 0.0) | (y == 1.0)); }
+};
+
+struct fimplication_maximal_op {
+   static inline double apply(double x, double y)
+   { return (double)((x < 1.0) | (y > 0.0)); }
+};
+
+struct fimplication_kleene_op {
+   static inline double apply(double x, double y)
+   { return std::max(1.0-x, y); }
+};
+
+struct fimplication_lukasiewicz_op {
+   static inline double apply(double x, double y)
+   { return std::min(1.0-x+y, 1.0); }
+};
+
+struct fimplication_reichenbach_op {
+   static inline double apply(double x, double y)
+   { return 1.0-x+x*y; }
+};
+
+struct fimplication_fodor_op {
+   static inline double apply(double x, double y)
+   { return (x <= y) ? 1.0 : std::max(1.0-x, y); }
+};
+
+struct fimplication_goguen_op {
+   static inline double apply(double x, double y)
+   { return (x <= y) ? 1.0 : (y/x); }
+};
+
+struct fimplication_goedel_op {
+   static inline double apply(double x, double y)
+   { return (x <= y) ? 1.0 : y; }
+};
+
+struct fimplication_rescher_op {
+   static inline double apply(double x, double y)
+   { return (double)(x <= y); }
+};
+
+struct fimplication_weber_op {
+   static inline double apply(double x, double y)
+   { return (x < 1.0) ? 1.0 : y; }
+};
+
+struct fimplication_yager_op {
+   static inline double apply(double x, double y)
+   { return ((x == 0.0) & (y == 0.0)) ? 1.0 : pow(y, x); }
+};
+
+
+/* ------------------------------------------------------------------------- */
+/* parametric families of t-norms                                            */
+
+/* Each family is a functor constructed from the parameter, lambda,
+ * so that all the constants depending solely on lambda (logarithms,
+ * reciprocals, etc.) are computed once per call, not once per element.
+ *
+ * apply(x, y) gives the t-norm, T(x, y),
+ * whereas residuum(x, y) gives, for x > y, the unique t such that
+ * T(x, t) = y; this generates the corresponding R-implication,
+ * I(x, y) = sup{t: T(x, t) <= y}.
+ *
+ * special(lambda) indicates if the family member is one of the
+ * basic t-norms, for which the dedicated (faster) functors are used.
+ *
+ * lambda_min() is the infimum of the parameter's domain.
+ */
+
+enum fuzzylogic_tnorm_basic {
+   TNORM_OTHER = 0,
+   TNORM_MINIMUM,
+   TNORM_PRODUCT,
+   TNORM_LUKASIEWICZ,
+   TNORM_DRASTIC
+};
+
+
+/** Enforce T(x, 1) = x and T(1, y) = y exactly (no rounding errors) */
+inline double __fuzzylogic_tnorm_boundary(double x, double y, double t)
+{
+   t = (x == 1.0) ? y : t;
+   return (y == 1.0) ? x : t;
+}
+
+
+/** m*(u^l+v^l)^(1/l), where m=max(u,v) -- no overflow/underflow */
+inline double __fuzzylogic_powsum(double u, double v, double l, double linv)
+{
+   double m = std::max(u, v);
+   double r = std::min(u, v)/m;
+   return m*exp(log1p(pow(r, l))*linv);
+}
+
+
+/** Hamacher t-norms, lambda in [0, Inf] */
+struct tnorm_hamacher_op {
+   static double lambda_min() { return 0.0; }
+   static int special(double l) {
+      if (l == 1.0) return TNORM_PRODUCT;
+      if (l == R_PosInf) return TNORM_DRASTIC;
+      return TNORM_OTHER;
+   }
+
+   double l, l1;
+   tnorm_hamacher_op(double lambda) : l(lambda), l1(1.0-lambda) { }
+
+   inline double apply(double x, double y) const {
+      double d = l + l1*(x+y-x*y);
+      double t = x*y/d;
+      t = (d == 0.0) ? 0.0 : t; // d == 0 iff lambda == 0 and x == y == 0
+      return __fuzzylogic_tnorm_boundary(x, y, t);
+   }
+
+   inline double residuum(double x, double y) const {
+      return y*(l + l1*x)/(x - y*l1*(1.0-x));
+   }
+};
+
+
+/** Frank t-norms, lambda in [0, Inf] */
+struct tnorm_frank_op {
+   static double lambda_min() { return 0.0; }
+   static int special(double l) {
+      if (l == 0.0) return TNORM_MINIMUM;
+      if (l == 1.0) return TNORM_PRODUCT;
+      if (l == R_PosInf) return TNORM_LUKASIEWICZ;
+      return TNORM_OTHER;
+   }
+
+   double L, Linv, c;  // log(lambda), 1/log(lambda), lambda-1
+   tnorm_frank_op(double lambda)
+      : L(log(lambda)), Linv(1.0/log(lambda)), c(expm1(log(lambda))) { }
+
+   inline double apply(double x, double y) const {
+      // log_lambda(1+(lambda^x-1)*(lambda^y-1)/(lambda-1)),
+      // (lambda^y-1)/(lambda-1) is in [0,1] -- no overflow
+      double t = log1p(expm1(x*L)*(expm1(y*L)/c))*Linv;
+      return __fuzzylogic_tnorm_boundary(x, y, std::max(0.0, std::min(t, 1.0)));
+   }
+
+   inline double residuum(double x, double y) const {
+      return log1p((expm1(y*L)/expm1(x*L))*c)*Linv;
+   }
+};
+
+
+/** Yager t-norms, lambda in [0, Inf] */
+struct tnorm_yager_op {
+   static double lambda_min() { return 0.0; }
+   static int special(double l) {
+      if (l == 0.0) return TNORM_DRASTIC;
+      if (l == 1.0) return TNORM_LUKASIEWICZ;
+      if (l == R_PosInf) return TNORM_MINIMUM;
+      return TNORM_OTHER;
+   }
+
+   double l, linv;
+   tnorm_yager_op(double lambda) : l(lambda), linv(1.0/lambda) { }
+
+   inline double apply(double x, double y) const {
+      // max(0, 1-((1-x)^l+(1-y)^l)^(1/l))
+      double t = 1.0-__fuzzylogic_powsum(1.0-x, 1.0-y, l, linv);
+      return __fuzzylogic_tnorm_boundary(x, y, std::max(t, 0.0));
+   }
+
+   inline double residuum(double x, double y) const {
+      // 1-((1-y)^l-(1-x)^l)^(1/l), where 1-y > 1-x
+      double v = 1.0-y;
+      return 1.0-v*exp(log1p(-pow((1.0-x)/v, l))*linv);
+   }
+};
+
+
+/** Schweizer-Sklar t-norms, lambda in [-Inf, Inf] */
+struct tnorm_schweizersklar_op {
+   static double lambda_min() { return R_NegInf; }
+   static int special(double l) {
+      if (l == R_NegInf) return TNORM_MINIMUM;
+      if (l == 0.0) return TNORM_PRODUCT;
+      if (l == 1.0) return TNORM_LUKASIEWICZ;
+      if (l == R_PosInf) return TNORM_DRASTIC;
+      return TNORM_OTHER;
+   }
+
+   double l, linv;
+   tnorm_schweizersklar_op(double lambda) : l(lambda), linv(1.0/lambda) { }
+
+   inline double apply(double x, double y) const {
+      // (max(0, x^l+y^l-1))^(1/l) is evaluated as
+      // m*(max(0, 1+(M^l-1)/m^l))^(1/l) for l > 0 and
+      // m*(1+(M/m)^l-m^(-l))^(1/l) for l < 0, m=min(x,y), M=max(x,y),
+      // so that no cancellation, overflow, or underflow occurs
+      double m = std::min(x, y);
+      double M = std::max(x, y);
+      double logm = log(m);
+      double tpos = m*pow(std::max(0.0, 1.0-exp(log(-expm1(l*log(M)))-l*logm)), linv);
+      double tneg = m*pow(1.0+pow(M/m, l)-exp(-l*logm), linv);
+      double t = (l < 0.0) ? tneg : tpos;
+      t = (m == 0.0) ? 0.0 : t;
+      return __fuzzylogic_tnorm_boundary(x, y, t);
+   }
+
+   inline double residuum(double x, double y) const {
+      // (1-x^l+y^l)^(1/l) is evaluated as exp(log(1-x^l+y^l)/l)
+      // using the log-sum-exp trick for l > 0, and as
+      // y*(1+y^(-l)-(x/y)^l)^(1/l) for l < 0;
+      // I(x, 0) = (1-x^l)^(1/l) for l > 0, but 0 for l < 0
+      double la = log(-expm1(l*log(x)));
+      double lb = l*log(y);
+      double lmax = std::max(la, lb);
+      double tpos = exp((lmax+log1p(exp(std::min(la, lb)-lmax)))*linv);
+      tpos = (lmax == R_NegInf) ? 0.0 : tpos;  // x == 1 and y == 0
+      double tneg = y*pow(1.0+pow(y, -l)-pow(x/y, l), linv);
+      tneg = (y == 0.0) ? 0.0 : tneg;
+      return (l < 0.0) ? tneg : tpos;
+   }
+};
+
+
+/** Dombi t-norms, lambda in [0, Inf] */
+struct tnorm_dombi_op {
+   static double lambda_min() { return 0.0; }
+   static int special(double l) {
+      if (l == 0.0) return TNORM_DRASTIC;
+      if (l == R_PosInf) return TNORM_MINIMUM;
+      return TNORM_OTHER;
+   }
+
+   double l, linv;
+   tnorm_dombi_op(double lambda) : l(lambda), linv(1.0/lambda) { }
+
+   inline double apply(double x, double y) const {
+      // 1/(1+(((1-x)/x)^l+((1-y)/y)^l)^(1/l))
+      double t = 1.0/(1.0+__fuzzylogic_powsum((1.0-x)/x, (1.0-y)/y, l, linv));
+      t = ((x == 0.0) | (y == 0.0)) ? 0.0 : t;
+      return __fuzzylogic_tnorm_boundary(x, y, t);
+   }
+
+   inline double residuum(double x, double y) const {
+      // 1/(1+(((1-y)/y)^l-((1-x)/x)^l)^(1/l)), where (1-y)/y > (1-x)/x
+      double c = (1.0-y)/y;
+      double t = 1.0/(1.0+c*exp(log1p(-pow((1.0-x)/x/c, l))*linv));
+      return (y == 0.0) ? 0.0 : t;
+   }
+};
+
+
+/** The dual t-conorm of a t-norm, S(x, y) = 1-T(1-x, 1-y) */
+template<class T>
+struct tconorm_dual_op {
+   T t;
+   tconorm_dual_op(const T& _t) : t(_t) { }
+
+   inline double apply(double x, double y) const {
+      return 1.0-t.apply(1.0-x, 1.0-y);
+   }
+};
+
+
+/** The residual implication (R-implication) of a t-norm */
+template<class T>
+struct fimplication_residual_op {
+   T t;
+   fimplication_residual_op(const T& _t) : t(_t) { }
+
+   inline double apply(double x, double y) const {
+      double r = t.residuum(x, y);  // garbage if x <= y
+      return (x <= y) ? 1.0 : r;
+   }
+};
+
+
+/** Get the parameter of a t-norm family
+ *
+ * @param lambda single numeric value, >= lambda_min
+ * @param lambda_min infimum of the parameter's domain
+ * @return double
+ */
+inline double __fuzzylogic_prepare_lambda(SEXP lambda, double lambda_min)
+{
+   lambda = PROTECT(prepare_arg_double_1(lambda, "lambda"));
+   double lambda_val = REAL(lambda)[0];
+   if (ISNAN(lambda_val))
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "lambda");
+   if (lambda_val < lambda_min)
+      Rf_error(MSG__ARG_NOT_GE_A, "lambda", lambda_min);
+   UNPROTECT(1);
+   return lambda_val;
+}
+
+
+/** Apply a t-norm from a parametric family
+ *
+ * @param x numeric vector with elements in [0,1]
+ * @param y numeric vector with elements in [0,1]
+ * @param lambda single numeric value
+ * @param outer single logical value
+ * @param out NULL or a numeric vector to store the result in
+ * @return numeric vector or matrix
+ */
+template<class T>
+SEXP fuzzylogic_apply_tnorm_family(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   double lambda_val = __fuzzylogic_prepare_lambda(lambda, T::lambda_min());
+   switch (T::special(lambda_val)) {
+      case TNORM_MINIMUM:
+         return fuzzylogic_apply_binary<tnorm_minimum_op>(x, y, outer, out);
+      case TNORM_PRODUCT:
+         return fuzzylogic_apply_binary<tnorm_product_op>(x, y, outer, out);
+      case TNORM_LUKASIEWICZ:
+         return fuzzylogic_apply_binary<tnorm_lukasiewicz_op>(x, y, outer, out);
+      case TNORM_DRASTIC:
+         return fuzzylogic_apply_binary<tnorm_drastic_op>(x, y, outer, out);
+      default:
+         return fuzzylogic_apply_binary(x, y, outer, out, T(lambda_val));
+   }
+}
+
+
+/** Apply the dual of a t-norm from a parametric family
+ *
+ * @param x numeric vector with elements in [0,1]
+ * @param y numeric vector with elements in [0,1]
+ * @param lambda single numeric value
+ * @param outer single logical value
+ * @param out NULL or a numeric vector to store the result in
+ * @return numeric vector or matrix
+ */
+template<class T>
+SEXP fuzzylogic_apply_tconorm_family(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   double lambda_val = __fuzzylogic_prepare_lambda(lambda, T::lambda_min());
+   switch (T::special(lambda_val)) {
+      case TNORM_MINIMUM:
+         return fuzzylogic_apply_binary<tconorm_minimum_op>(x, y, outer, out);
+      case TNORM_PRODUCT:
+         return fuzzylogic_apply_binary<tconorm_product_op>(x, y, outer, out);
+      case TNORM_LUKASIEWICZ:
+         return fuzzylogic_apply_binary<tconorm_lukasiewicz_op>(x, y, outer, out);
+      case TNORM_DRASTIC:
+         return fuzzylogic_apply_binary<tconorm_drastic_op>(x, y, outer, out);
+      default:
+         return fuzzylogic_apply_binary(x, y, outer, out,
+            tconorm_dual_op<T>(T(lambda_val)));
+   }
+}
+
+
+/** Apply the R-implication of a t-norm from a parametric family
+ *
+ * The R-implications of the minimum, product, Lukasiewicz, and
+ * drastic t-norms are the Goedel, Goguen, Lukasiewicz, and Weber
+ * implications, respectively.
+ *
+ * @param x numeric vector with elements in [0,1]
+ * @param y numeric vector with elements in [0,1]
+ * @param lambda single numeric value
+ * @param outer single logical value
+ * @param out NULL or a numeric vector to store the result in
+ * @return numeric vector or matrix
+ */
+template<class T>
+SEXP fuzzylogic_apply_fimplication_family(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   double lambda_val = __fuzzylogic_prepare_lambda(lambda, T::lambda_min());
+   switch (T::special(lambda_val)) {
+      case TNORM_MINIMUM:
+         return fuzzylogic_apply_binary<fimplication_goedel_op>(x, y, outer, out);
+      case TNORM_PRODUCT:
+         return fuzzylogic_apply_binary<fimplication_goguen_op>(x, y, outer, out);
+      case TNORM_LUKASIEWICZ:
+         return fuzzylogic_apply_binary<fimplication_lukasiewicz_op>(x, y, outer, out);
+      case TNORM_DRASTIC:
+         return fuzzylogic_apply_binary<fimplication_weber_op>(x, y, outer, out);
+      default:
+         return fuzzylogic_apply_binary(x, y, outer, out,
+            fimplication_residual_op<T>(T(lambda_val)));
+   }
+}
+
+
+/* ------------------------------------------------------------------------- */
+/* compiled programs, see fuzzylogic_program.cpp                             */
+
+enum fuzzylogic_opcode {
+   FLOP_VAR = 0,
+   FLOP_CONST,
+
+   FLOP_FNEGATION_CLASSIC,
+   FLOP_FNEGATION_YAGER,
+   FLOP_FNEGATION_MINIMAL,
+   FLOP_FNEGATION_MAXIMAL,
+
+   FLOP_TNORM_MINIMUM,
+   FLOP_TNORM_PRODUCT,
+   FLOP_TNORM_LUKASIEWICZ,
+   FLOP_TNORM_DRASTIC,
+   FLOP_TNORM_FODOR,
+
+   FLOP_TCONORM_MINIMUM,
+   FLOP_TCONORM_PRODUCT,
+   FLOP_TCONORM_LUKASIEWICZ,
+   FLOP_TCONORM_DRASTIC,
+   FLOP_TCONORM_FODOR,
+
+   FLOP_FIMPLICATION_MINIMAL,
+   FLOP_FIMPLICATION_MAXIMAL,
+   FLOP_FIMPLICATION_KLEENE,
+   FLOP_FIMPLICATION_LUKASIEWICZ,
+   FLOP_FIMPLICATION_REICHENBACH,
+   FLOP_FIMPLICATION_FODOR,
+   FLOP_FIMPLICATION_GOGUEN,
+   FLOP_FIMPLICATION_GOEDEL,
+   FLOP_FIMPLICATION_RESCHER,
+   FLOP_FIMPLICATION_WEBER,
+   FLOP_FIMPLICATION_YAGER,
+
+   // parametric families: FLOP_FAMILY + kind*FLOP_NFAMILIES + family
+   FLOP_FAMILY,
+   FLOP_COUNT = FLOP_FAMILY + 3*5
+};
+
+#define FLOP_NFAMILIES 5
+
+
+/** Number of arguments an instruction pops from the stack */
+inline int __fuzzylogic_program_nargs(int code)
+{
+   if (code <= FLOP_CONST) return 0;
+   if (code <= FLOP_FNEGATION_MAXIMAL) return 1;
+   return 2;
+}
+
+
+/** An operand: a chunk of a vector or a broadcast scalar */
+struct __fuzzylogic_operand {
+   const double* x;
+   int scalar; // stride 0?
+   int buf;    // index of the buffer owned, -1 if none
+};
+
+
+/** Get the opcode of a connective given its name
+ *
+ * Special members of the parametric families are resolved
+ * to the corresponding basic connectives.
+ *
+ * @param name connective's name, e.g., "tnorm_minimum"
+ * @param param the family's parameter (lambda), if applicable
+ * @return opcode
+ */
+int __fuzzylogic_program_opcode(const char* name, double param);
+
+
+/** Execute a single connective on a chunk of data
+ *
+ * @param code opcode
+ * @param param parameter (lambda), if applicable
+ * @param args nargs operands
+ * @param res [out] m results
+ * @param m chunk length
+ */
+void __fuzzylogic_program_exec(int code, double param,
+   const __fuzzylogic_operand* args, double* res, R_len_t m);
+
+#endif
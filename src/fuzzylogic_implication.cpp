@@ -18,18 +18,20 @@
  * from <http://www.gnu.org/licenses/>.                                      *
  * ************************************************************************* */
 
-#include "agop.h"
+#include "fuzzylogic.h"
 
 
 /** The minimal fuzzy implication
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_minimal(SEXP x, SEXP y)
+SEXP fimplication_minimal(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((double)(x_tab[i] == 0.0 || y_tab[i] == 1.0))
+   return fuzzylogic_apply_binary<fimplication_minimal_op>(x, y, outer, out);
 }
 
 
@@ -37,11 +39,13 @@ SEXP fimplication_minimal(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_maximal(SEXP x, SEXP y)
+SEXP fimplication_maximal(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((double)(x_tab[i] < 1.0 || y_tab[i] > 0.0))
+   return fuzzylogic_apply_binary<fimplication_maximal_op>(x, y, outer, out);
 }
 
 
@@ -49,11 +53,13 @@ SEXP fimplication_maximal(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_kleene(SEXP x, SEXP y)
+SEXP fimplication_kleene(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(std::max(1.0-x_tab[i], y_tab[i]))
+   return fuzzylogic_apply_binary<fimplication_kleene_op>(x, y, outer, out);
 }
 
 
@@ -61,11 +67,13 @@ SEXP fimplication_kleene(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_lukasiewicz(SEXP x, SEXP y)
+SEXP fimplication_lukasiewicz(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(std::min(1.0-x_tab[i]+y_tab[i], 1.0))
+   return fuzzylogic_apply_binary<fimplication_lukasiewicz_op>(x, y, outer, out);
 }
 
 
@@ -73,11 +81,13 @@ SEXP fimplication_lukasiewicz(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_reichenbach(SEXP x, SEXP y)
+SEXP fimplication_reichenbach(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(1.0-x_tab[i]+x_tab[i]*y_tab[i])
+   return fuzzylogic_apply_binary<fimplication_reichenbach_op>(x, y, outer, out);
 }
 
 
@@ -85,11 +95,13 @@ SEXP fimplication_reichenbach(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_fodor(SEXP x, SEXP y)
+SEXP fimplication_fodor(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((x_tab[i] <= y_tab[i])?1.0:std::max(1.0-x_tab[i], y_tab[i]))
+   return fuzzylogic_apply_binary<fimplication_fodor_op>(x, y, outer, out);
 }
 
 
@@ -97,11 +109,13 @@ SEXP fimplication_fodor(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_goguen(SEXP x, SEXP y)
+SEXP fimplication_goguen(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((x_tab[i] <= y_tab[i])?1.0:(y_tab[i]/x_tab[i]))
+   return fuzzylogic_apply_binary<fimplication_goguen_op>(x, y, outer, out);
 }
 
 
@@ -109,11 +123,13 @@ SEXP fimplication_goguen(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_goedel(SEXP x, SEXP y)
+SEXP fimplication_goedel(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((x_tab[i] <= y_tab[i])?1.0:y_tab[i])
+   return fuzzylogic_apply_binary<fimplication_goedel_op>(x, y, outer, out);
 }
 
 
@@ -121,11 +137,13 @@ SEXP fimplication_goedel(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_rescher(SEXP x, SEXP y)
+SEXP fimplication_rescher(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((double)(x_tab[i] <= y_tab[i]))
+   return fuzzylogic_apply_binary<fimplication_rescher_op>(x, y, outer, out);
 }
 
 
@@ -133,11 +151,13 @@ SEXP fimplication_rescher(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_weber(SEXP x, SEXP y)
+SEXP fimplication_weber(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((x_tab[i] < 1.0)?1.0:y_tab[i])
+   return fuzzylogic_apply_binary<fimplication_weber_op>(x, y, outer, out);
 }
 
 
@@ -145,9 +165,86 @@ SEXP fimplication_weber(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fimplication_yager(SEXP x, SEXP y)
+SEXP fimplication_yager(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y((x_tab[i] == 0.0 && y_tab[i] == 0.0)?1.0:pow(y_tab[i], x_tab[i]))
+   return fuzzylogic_apply_binary<fimplication_yager_op>(x, y, outer, out);
+}
+
+
+/** The Hamacher fuzzy implication (R-implication of the Hamacher t-norm)
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP fimplication_r_hamacher(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_fimplication_family<tnorm_hamacher_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Frank fuzzy implication (R-implication of the Frank t-norm)
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP fimplication_r_frank(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_fimplication_family<tnorm_frank_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Yager fuzzy implication (R-implication of the Yager t-norm)
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP fimplication_r_yager(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_fimplication_family<tnorm_yager_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Schweizer-Sklar fuzzy implication (R-implication of the Schweizer-Sklar t-norm)
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP fimplication_r_schweizersklar(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_fimplication_family<tnorm_schweizersklar_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Dombi fuzzy implication (R-implication of the Dombi t-norm)
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP fimplication_r_dombi(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_fimplication_family<tnorm_dombi_op>(x, y, lambda, outer, out);
 }
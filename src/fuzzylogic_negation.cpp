@@ -18,48 +18,52 @@
  * from <http://www.gnu.org/licenses/>.                                      *
  * ************************************************************************* */
 
-#include "agop.h"
+#include "fuzzylogic.h"
 
 
 /** The classic fuzzy negation
  *
  * @param x numeric
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fnegation_classic(SEXP x)
+SEXP fnegation_classic(SEXP x, SEXP out)
 {
-   macro_apply_unaryop_x(1.0-x_tab[i])
+   return fuzzylogic_apply_unary<fnegation_classic_op>(x, out);
 }
 
 
 /** The Yager fuzzy negation
  *
  * @param x numeric
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fnegation_yager(SEXP x)
+SEXP fnegation_yager(SEXP x, SEXP out)
 {
-   macro_apply_unaryop_x(sqrt(1.0-x_tab[i]*x_tab[i]))
+   return fuzzylogic_apply_unary<fnegation_yager_op>(x, out);
 }
 
 
 /** The minimal fuzzy negation
  *
  * @param x numeric
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fnegation_minimal(SEXP x)
+SEXP fnegation_minimal(SEXP x, SEXP out)
 {
-   macro_apply_unaryop_x((x_tab[i]==0.0)?1.0:0.0)
+   return fuzzylogic_apply_unary<fnegation_minimal_op>(x, out);
 }
 
 
 /** The maximal fuzzy negation
  *
  * @param x numeric
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP fnegation_maximal(SEXP x)
+SEXP fnegation_maximal(SEXP x, SEXP out)
 {
-   macro_apply_unaryop_x((x_tab[i]<1.0)?1.0:0.0)
+   return fuzzylogic_apply_unary<fnegation_maximal_op>(x, out);
 }
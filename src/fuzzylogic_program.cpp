@@ -0,0 +1,425 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+#include "fuzzylogic.h"
+#include <cstring>
+
+
+/* A fuzzy logic program is a compiled expression built from
+ * the connectives defined in fuzzylogic.h, stored in the postfix
+ * (reverse Polish) notation: each instruction either pushes an operand
+ * (an input vector or a constant) onto the stack or pops
+ * the connective's arguments and pushes its result.
+ *
+ * The program is executed by a stack machine that processes the inputs
+ * in chunks small enough for all the intermediate results to stay
+ * in the L1 cache; each input is read (and validated) exactly once
+ * and no full-length temporary vectors are allocated.
+ */
+
+
+/** Number of elements processed at once; the intermediate buffers
+ *  (chunk_size doubles each, one per stack level) should fit in L1 */
+#define FUZZYLOGIC_PROGRAM_CHUNK 256
+
+
+/** Names of the connectives, as exported to R; indexed by opcodes */
+static const char* const fuzzylogic_program_opnames[FLOP_COUNT] = {
+   ".var", ".const",
+   "fnegation_classic", "fnegation_yager", "fnegation_minimal",
+   "fnegation_maximal",
+   "tnorm_minimum", "tnorm_product", "tnorm_lukasiewicz", "tnorm_drastic",
+   "tnorm_fodor",
+   "tconorm_minimum", "tconorm_product", "tconorm_lukasiewicz",
+   "tconorm_drastic", "tconorm_fodor",
+   "fimplication_minimal", "fimplication_maximal", "fimplication_kleene",
+   "fimplication_lukasiewicz", "fimplication_reichenbach",
+   "fimplication_fodor", "fimplication_goguen", "fimplication_goedel",
+   "fimplication_rescher", "fimplication_weber", "fimplication_yager",
+   "tnorm_hamacher", "tnorm_frank", "tnorm_yager", "tnorm_schweizersklar",
+   "tnorm_dombi",
+   "tconorm_hamacher", "tconorm_frank", "tconorm_yager",
+   "tconorm_schweizersklar", "tconorm_dombi",
+   "fimplication_r_hamacher", "fimplication_r_frank", "fimplication_r_yager",
+   "fimplication_r_schweizersklar", "fimplication_r_dombi"
+};
+
+
+/** Basic connectives equivalent to special members of the families;
+ *  indexed by kind (t-norm, t-conorm, R-implication) and
+ *  fuzzylogic_tnorm_basic */
+static const int fuzzylogic_program_special[3][5] = {
+   {-1, FLOP_TNORM_MINIMUM, FLOP_TNORM_PRODUCT,
+      FLOP_TNORM_LUKASIEWICZ, FLOP_TNORM_DRASTIC},
+   {-1, FLOP_TCONORM_MINIMUM, FLOP_TCONORM_PRODUCT,
+      FLOP_TCONORM_LUKASIEWICZ, FLOP_TCONORM_DRASTIC},
+   {-1, FLOP_FIMPLICATION_GOEDEL, FLOP_FIMPLICATION_GOGUEN,
+      FLOP_FIMPLICATION_LUKASIEWICZ, FLOP_FIMPLICATION_WEBER}
+};
+
+
+template<class OP>
+void __fuzzylogic_program_unary(const OP& op,
+   const __fuzzylogic_operand& x, double* res, R_len_t m)
+{
+   if (!x.scalar)
+      __fuzzylogic_apply_unary<OP>(op, x.x, res, m);
+   else {
+      __fuzzylogic_apply_unary<OP>(op, x.x, res, 1);
+      std::fill(res+1, res+m, res[0]);
+   }
+}
+
+
+template<class OP>
+void __fuzzylogic_program_binary(const OP& op,
+   const __fuzzylogic_operand& x, const __fuzzylogic_operand& y,
+   double* res, R_len_t m)
+{
+   if (!x.scalar && !y.scalar)
+      __fuzzylogic_apply_binary<OP, 1, 1>(op, x.x, y.x, res, m);
+   else if (!x.scalar)
+      __fuzzylogic_apply_binary<OP, 1, 0>(op, x.x, y.x, res, m);
+   else if (!y.scalar)
+      __fuzzylogic_apply_binary<OP, 0, 1>(op, x.x, y.x, res, m);
+   else {
+      __fuzzylogic_apply_binary<OP, 0, 0>(op, x.x, y.x, res, 1);
+      std::fill(res+1, res+m, res[0]);
+   }
+}
+
+
+/** Apply a (non-special) member of a t-norm family, its dual,
+ *  or its R-implication; the functor is constructed once per chunk */
+template<class T>
+void __fuzzylogic_program_family(int kind, double lambda,
+   const __fuzzylogic_operand* args, double* res, R_len_t m)
+{
+   if (kind == 0)
+      __fuzzylogic_program_binary(T(lambda), args[0], args[1], res, m);
+   else if (kind == 1)
+      __fuzzylogic_program_binary(tconorm_dual_op<T>(T(lambda)),
+         args[0], args[1], res, m);
+   else
+      __fuzzylogic_program_binary(fimplication_residual_op<T>(T(lambda)),
+         args[0], args[1], res, m);
+}
+
+
+/** Resolve the opcode of a member of a t-norm family
+ *
+ * @param kind 0 (t-norm), 1 (t-conorm), or 2 (R-implication)
+ * @param code opcode
+ * @param lambda parameter
+ * @return opcode, possibly of a basic connective
+ */
+template<class T>
+int __fuzzylogic_program_resolve(int kind, int code, double lambda)
+{
+   if (ISNAN(lambda))
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "lambda");
+   if (lambda < T::lambda_min())
+      Rf_error(MSG__ARG_NOT_GE_A, "lambda", T::lambda_min());
+   int s = T::special(lambda);
+   return (s == TNORM_OTHER) ? code : fuzzylogic_program_special[kind][s];
+}
+
+
+int __fuzzylogic_program_opcode(const char* name, double param)
+{
+   int code = 0;
+   while (code < FLOP_COUNT && strcmp(name, fuzzylogic_program_opnames[code]) != 0)
+      ++code;
+   if (code == FLOP_COUNT)
+      Rf_error("unknown fuzzy logic connective `%s`", name);
+
+   if (code >= FLOP_FAMILY) {
+      int kind = (code-FLOP_FAMILY)/FLOP_NFAMILIES;
+      switch ((code-FLOP_FAMILY)%FLOP_NFAMILIES) {
+         case 0: return __fuzzylogic_program_resolve<tnorm_hamacher_op>(kind, code, param);
+         case 1: return __fuzzylogic_program_resolve<tnorm_frank_op>(kind, code, param);
+         case 2: return __fuzzylogic_program_resolve<tnorm_yager_op>(kind, code, param);
+         case 3: return __fuzzylogic_program_resolve<tnorm_schweizersklar_op>(kind, code, param);
+         case 4: return __fuzzylogic_program_resolve<tnorm_dombi_op>(kind, code, param);
+      }
+   }
+   return code;
+}
+
+
+void __fuzzylogic_program_exec(int code, double param,
+   const __fuzzylogic_operand* args, double* res, R_len_t m)
+{
+   const __fuzzylogic_operand& x = args[0];
+   const __fuzzylogic_operand* y = args+1;  // only if nargs == 2
+   switch (code) {
+      case FLOP_FNEGATION_CLASSIC:
+         __fuzzylogic_program_unary(fnegation_classic_op(), x, res, m); break;
+      case FLOP_FNEGATION_YAGER:
+         __fuzzylogic_program_unary(fnegation_yager_op(), x, res, m); break;
+      case FLOP_FNEGATION_MINIMAL:
+         __fuzzylogic_program_unary(fnegation_minimal_op(), x, res, m); break;
+      case FLOP_FNEGATION_MAXIMAL:
+         __fuzzylogic_program_unary(fnegation_maximal_op(), x, res, m); break;
+
+      case FLOP_TNORM_MINIMUM:
+         __fuzzylogic_program_binary(tnorm_minimum_op(), x, *y, res, m); break;
+      case FLOP_TNORM_PRODUCT:
+         __fuzzylogic_program_binary(tnorm_product_op(), x, *y, res, m); break;
+      case FLOP_TNORM_LUKASIEWICZ:
+         __fuzzylogic_program_binary(tnorm_lukasiewicz_op(), x, *y, res, m); break;
+      case FLOP_TNORM_DRASTIC:
+         __fuzzylogic_program_binary(tnorm_drastic_op(), x, *y, res, m); break;
+      case FLOP_TNORM_FODOR:
+         __fuzzylogic_program_binary(tnorm_fodor_op(), x, *y, res, m); break;
+
+      case FLOP_TCONORM_MINIMUM:
+         __fuzzylogic_program_binary(tconorm_minimum_op(), x, *y, res, m); break;
+      case FLOP_TCONORM_PRODUCT:
+         __fuzzylogic_program_binary(tconorm_product_op(), x, *y, res, m); break;
+      case FLOP_TCONORM_LUKASIEWICZ:
+         __fuzzylogic_program_binary(tconorm_lukasiewicz_op(), x, *y, res, m); break;
+      case FLOP_TCONORM_DRASTIC:
+         __fuzzylogic_program_binary(tconorm_drastic_op(), x, *y, res, m); break;
+      case FLOP_TCONORM_FODOR:
+         __fuzzylogic_program_binary(tconorm_fodor_op(), x, *y, res, m); break;
+
+      case FLOP_FIMPLICATION_MINIMAL:
+         __fuzzylogic_program_binary(fimplication_minimal_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_MAXIMAL:
+         __fuzzylogic_program_binary(fimplication_maximal_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_KLEENE:
+         __fuzzylogic_program_binary(fimplication_kleene_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_LUKASIEWICZ:
+         __fuzzylogic_program_binary(fimplication_lukasiewicz_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_REICHENBACH:
+         __fuzzylogic_program_binary(fimplication_reichenbach_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_FODOR:
+         __fuzzylogic_program_binary(fimplication_fodor_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_GOGUEN:
+         __fuzzylogic_program_binary(fimplication_goguen_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_GOEDEL:
+         __fuzzylogic_program_binary(fimplication_goedel_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_RESCHER:
+         __fuzzylogic_program_binary(fimplication_rescher_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_WEBER:
+         __fuzzylogic_program_binary(fimplication_weber_op(), x, *y, res, m); break;
+      case FLOP_FIMPLICATION_YAGER:
+         __fuzzylogic_program_binary(fimplication_yager_op(), x, *y, res, m); break;
+
+      default: {
+         int kind = (code-FLOP_FAMILY)/FLOP_NFAMILIES;
+         switch ((code-FLOP_FAMILY)%FLOP_NFAMILIES) {
+            case 0: __fuzzylogic_program_family<tnorm_hamacher_op>(kind, param, args, res, m); break;
+            case 1: __fuzzylogic_program_family<tnorm_frank_op>(kind, param, args, res, m); break;
+            case 2: __fuzzylogic_program_family<tnorm_yager_op>(kind, param, args, res, m); break;
+            case 3: __fuzzylogic_program_family<tnorm_schweizersklar_op>(kind, param, args, res, m); break;
+            case 4: __fuzzylogic_program_family<tnorm_dombi_op>(kind, param, args, res, m); break;
+         }
+      }
+   }
+}
+
+
+/** Translate the names of the connectives to opcodes
+ *
+ * Special members of the parametric families are replaced
+ * with the corresponding basic connectives.
+ *
+ * @param op character vector, connectives' names in the postfix order;
+ *    ".var" and ".const" denote operands
+ * @param param numeric vector of the same length as op, parameters
+ *    (lambdas) of the connectives from the parametric families
+ * @return integer vector
+ */
+SEXP fuzzylogic_program_compile(SEXP op, SEXP param)
+{
+   op    = PROTECT(prepare_arg_string(op, "op"));
+   param = PROTECT(prepare_arg_double(param, "param"));
+   R_len_t n = LENGTH(op);
+   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, "op");
+   if (LENGTH(param) != n)
+      Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, "op", "param");
+   double* param_tab = REAL(param);
+
+   SEXP res;
+   PROTECT(res = Rf_allocVector(INTSXP, n));
+   int* res_tab = INTEGER(res);
+   for (R_len_t i=0; i<n; ++i) {
+      if (STRING_ELT(op, i) == NA_STRING)
+         Rf_error(MSG__ARG_EXPECTED_NOT_NA, "op");
+      int code = __fuzzylogic_program_opcode(CHAR(STRING_ELT(op, i)), param_tab[i]);
+      if (code == FLOP_CONST) {
+         if (!(param_tab[i] >= 0.0 && param_tab[i] <= 1.0)) // NA too
+            Rf_error(MSG__ARG_NOT_IN_AB, "param", 0.0, 1.0);
+      }
+
+      res_tab[i] = code;
+   }
+
+   UNPROTECT(3);
+   return res;
+}
+
+
+/** Evaluate a compiled fuzzy logic program
+ *
+ * All the inputs should be of the same length, n, or of length 1
+ * (these are broadcast). The result inherits the dim, dimnames, and names
+ * attributes of the first input of length n.
+ *
+ * @param code integer vector, opcodes, see fuzzylogic_program_compile()
+ * @param arg integer vector of the same length as code, 1-based indexes
+ *    of the inputs in data (for ".var")
+ * @param param numeric vector of the same length as code, constants
+ *    (for ".const") or lambdas (for the parametric families)
+ * @param data list of numeric vectors with elements in [0,1]
+ * @param out NULL or a numeric vector of length n to store the result in
+ *    (no attributes are set then)
+ * @return numeric vector of length n
+ */
+SEXP fuzzylogic_program_eval(SEXP code, SEXP arg, SEXP param, SEXP data, SEXP out)
+{
+   code  = PROTECT(prepare_arg_integer(code, "code"));
+   arg   = PROTECT(prepare_arg_integer(arg, "arg"));
+   param = PROTECT(prepare_arg_double(param, "param"));
+   if (!Rf_isVectorList(data))
+      Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   R_len_t ninstr = LENGTH(code);
+   int* code_tab = INTEGER(code);
+   int* arg_tab = INTEGER(arg);
+   double* param_tab = REAL(param);
+   if (ninstr <= 0) Rf_error(MSG_ARG_TOO_SHORT, "code");
+   if (LENGTH(arg) != ninstr || LENGTH(param) != ninstr)
+      Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   // prepare the inputs
+   R_len_t ndata = LENGTH(data);
+   SEXP data_names = Rf_getAttrib(data, R_NamesSymbol);
+   SEXP data_prep;
+   PROTECT(data_prep = Rf_allocVector(VECSXP, ndata));
+   const char** names = (const char**)R_alloc(ndata, sizeof(const char*));
+   const double** data_tab = (const double**)R_alloc(ndata, sizeof(const double*));
+   R_len_t n = 1;
+   R_len_t n_from = -1; // first input of length n
+   for (R_len_t j=0; j<ndata; ++j) {
+      names[j] = (!Rf_isNull(data_names)) ? CHAR(STRING_ELT(data_names, j)) : "data";
+      SEXP xj = prepare_arg_double(VECTOR_ELT(data, j), names[j]);
+      SET_VECTOR_ELT(data_prep, j, xj);
+      data_tab[j] = REAL(xj);
+      R_len_t nj = LENGTH(xj);
+      if (nj <= 0) Rf_error(MSG_ARG_TOO_SHORT, names[j]);
+      // validate all the inputs in full before anything is written to out,
+      // which may be one of the inputs
+      if (!__fuzzylogic_check_range(data_tab[j], nj))
+         Rf_error(MSG__ARG_NOT_IN_AB, names[j], 0.0, 1.0);
+      if (nj > 1 && n == 1) {
+         n = nj;
+         n_from = j;
+      }
+      else if (nj > 1 && nj != n)
+         Rf_error(MSG__ARGS_EXPECTED_EQUAL_SIZE, names[n_from], names[j]);
+   }
+
+   // check the program, determine the stack size needed
+   R_len_t depth = 0, maxdepth = 0;
+   for (R_len_t k=0; k<ninstr; ++k) {
+      if (code_tab[k] < 0 || code_tab[k] >= FLOP_COUNT)
+         Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      if (code_tab[k] == FLOP_VAR && (arg_tab[k] < 1 || arg_tab[k] > ndata))
+         Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      int nargs = __fuzzylogic_program_nargs(code_tab[k]);
+      if (depth < nargs) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      depth = depth - nargs + 1;
+      maxdepth = std::max(maxdepth, depth);
+   }
+   if (depth != 1) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+   SEXP res;
+   PROTECT(res = __fuzzylogic_prepare_out(out, n));
+   double* res_tab = REAL(res);
+
+   // one buffer per live intermediate result plus one for the output
+   // so that no connective is ever evaluated in-place;
+   // R_alloc'd memory is released even if an error occurs
+   const R_len_t chunk = FUZZYLOGIC_PROGRAM_CHUNK;
+   double* buf = (double*)R_alloc((maxdepth+1)*chunk, sizeof(double));
+   int* buf_free = (int*)R_alloc(maxdepth+1, sizeof(int));
+   __fuzzylogic_operand* stack = (__fuzzylogic_operand*)R_alloc(maxdepth, sizeof(__fuzzylogic_operand));
+
+   for (R_len_t i=0; i<n; i+=chunk) {
+      R_len_t m = std::min(chunk, n-i);
+
+      R_len_t nfree = maxdepth+1;
+      for (R_len_t b=0; b<nfree; ++b) buf_free[b] = b;
+
+      R_len_t sp = 0;
+      for (R_len_t k=0; k<ninstr; ++k) {
+         if (code_tab[k] == FLOP_VAR) {
+            R_len_t j = arg_tab[k]-1;
+            int scalar = (LENGTH(VECTOR_ELT(data_prep, j)) == 1);
+            stack[sp].x = scalar ? data_tab[j] : data_tab[j]+i;
+            stack[sp].scalar = scalar;
+            stack[sp].buf = -1;
+            ++sp;
+         }
+         else if (code_tab[k] == FLOP_CONST) {
+            stack[sp].x = param_tab+k;
+            stack[sp].scalar = 1;
+            stack[sp].buf = -1;
+            ++sp;
+         }
+         else {
+            int nargs = __fuzzylogic_program_nargs(code_tab[k]);
+            sp -= nargs;
+            int b = -1;
+            double* out;
+            if (k == ninstr-1)
+               out = res_tab+i; // the last instruction writes the output
+            else {
+               b = buf_free[--nfree];
+               out = buf+(R_xlen_t)b*chunk;
+            }
+            __fuzzylogic_program_exec(code_tab[k], param_tab[k], stack+sp, out, m);
+            for (int a=0; a<nargs; ++a)
+               if (stack[sp+a].buf >= 0) buf_free[nfree++] = stack[sp+a].buf;
+            stack[sp].x = out;
+            stack[sp].scalar = 0;
+            stack[sp].buf = b;
+            ++sp;
+         }
+      }
+
+      if (__fuzzylogic_program_nargs(code_tab[ninstr-1]) == 0) {
+         // the program is a single operand
+         if (stack[0].scalar) std::fill(res_tab+i, res_tab+i+m, stack[0].x[0]);
+         else std::copy(stack[0].x, stack[0].x+m, res_tab+i);
+      }
+   }
+
+   if (n_from >= 0 && Rf_isNull(out))
+      __fuzzylogic_copy_dim(VECTOR_ELT(data_prep, n_from), res);
+
+   UNPROTECT(5);
+   return res;
+}
@@ -0,0 +1,211 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+#include "fuzzylogic.h"
+
+
+/* Quantised inputs: integer codes 0, 1, ..., levels-1 represent
+ * the membership degrees 0, 1/(levels-1), ..., 1. All the possible
+ * results of a unary (binary) connective are precomputed and stored
+ * in a 1-D (2-D) lookup table, so that transcendental functions
+ * (e.g., pow() in the Yager implication) are not called per element.
+ *
+ * The table entries are computed by the very same kernels as in the
+ * non-quantised case, thus the results are identical to applying the
+ * connective on the dequantised inputs, code/(levels-1).
+ */
+
+
+/** Maximal number of levels supported by 2-D lookup tables:
+ *  256*256 doubles = 512 KiB */
+#define FUZZYLOGIC_LUT_MAXLEVELS_BINARY 256
+
+/** Maximal number of levels supported by 1-D lookup tables */
+#define FUZZYLOGIC_LUT_MAXLEVELS_UNARY 65536
+
+
+/** A cached lookup table */
+struct __fuzzylogic_lut {
+   int code;
+   double param;
+   int levels;
+   std::vector<double> table;
+
+   __fuzzylogic_lut() : code(-1), param(0.0), levels(0) { }
+};
+
+
+/** Get the lookup table for a connective
+ *
+ * The most recently used table for each connective is cached.
+ *
+ * @param code opcode
+ * @param param parameter (lambda), if applicable
+ * @param levels number of quantisation levels
+ * @return table, levels or levels*levels elements;
+ *    table[i*levels+j] == op(i/(levels-1), j/(levels-1))
+ */
+const double* __fuzzylogic_lut_get(int code, double param, int levels)
+{
+   static __fuzzylogic_lut cache[FLOP_COUNT];
+   __fuzzylogic_lut& lut = cache[code];
+   if (lut.code == code && lut.levels == levels &&
+         (lut.param == param || code < FLOP_FAMILY))
+      return lut.table.data();
+
+   std::vector<double> grid(levels);
+   for (int i=0; i<levels; ++i)
+      grid[i] = (double)i/(double)(levels-1);
+
+   __fuzzylogic_operand args[2];
+   if (__fuzzylogic_program_nargs(code) == 1) {
+      lut.table.resize(levels);
+      args[0].x = grid.data(); args[0].scalar = 0; args[0].buf = -1;
+      __fuzzylogic_program_exec(code, param, args, lut.table.data(), levels);
+   }
+   else {
+      lut.table.resize((size_t)levels*levels);
+      args[1].x = grid.data(); args[1].scalar = 0; args[1].buf = -1;
+      for (int i=0; i<levels; ++i) {
+         args[0].x = grid.data()+i; args[0].scalar = 1; args[0].buf = -1;
+         __fuzzylogic_program_exec(code, param, args,
+            lut.table.data()+(size_t)i*levels, levels);
+      }
+   }
+
+   lut.code = code;
+   lut.param = param;
+   lut.levels = levels;
+   return lut.table.data();
+}
+
+
+/** Prepare a vector of quantised membership degrees
+ *
+ * @param x raw or integer vector with elements in {0, ..., levels-1}
+ * @param levels number of quantisation levels
+ * @param argname argument name (for error messages)
+ * @return integer vector (NAs allowed)
+ */
+SEXP __fuzzylogic_prepare_codes(SEXP x, int levels, const char* argname)
+{
+   if (TYPEOF(x) != RAWSXP && TYPEOF(x) != INTSXP)
+      Rf_error("argument `%s` should be a raw or integer vector", argname);
+   x = PROTECT(Rf_coerceVector(x, INTSXP));
+   R_len_t n = LENGTH(x);
+   int* xd = INTEGER(x);
+   if (n <= 0) Rf_error(MSG_ARG_TOO_SHORT, argname);
+   for (R_len_t i=0; i<n; ++i) {
+      if (xd[i] != NA_INTEGER && (xd[i] < 0 || xd[i] >= levels))
+         Rf_error(MSG__ARG_NOT_IN_AB, argname, 0.0, (double)(levels-1));
+   }
+   UNPROTECT(1);
+   return x;
+}
+
+
+/** Apply a fuzzy logic connective on quantised membership degrees
+ *
+ * The shorter of x and y is recycled.
+ *
+ * @param connective single string, e.g., "fimplication_yager"
+ * @param x raw or integer vector with elements in {0, ..., levels-1}
+ * @param y raw or integer vector with elements in {0, ..., levels-1}
+ *    or NULL for unary connectives
+ * @param lambda single numeric value or NULL, the family's parameter
+ * @param levels single integer, number of quantisation levels,
+ *    or NULL for the default: 65536 for unary connectives
+ *    and integer codes, 256 otherwise
+ * @return numeric vector
+ */
+SEXP fuzzylogic_quantized(SEXP connective, SEXP x, SEXP y, SEXP lambda, SEXP levels)
+{
+   connective = PROTECT(prepare_arg_string_1(connective, "connective"));
+   double lambda_val = NA_REAL; // required by the parametric families only
+   if (!Rf_isNull(lambda)) {
+      lambda = PROTECT(prepare_arg_double_1(lambda, "lambda"));
+      lambda_val = REAL(lambda)[0];
+      UNPROTECT(1);
+   }
+   if (STRING_ELT(connective, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "connective");
+   int code = __fuzzylogic_program_opcode(CHAR(STRING_ELT(connective, 0)), lambda_val);
+   int nargs = __fuzzylogic_program_nargs(code);
+   if (nargs == 0)
+      Rf_error("unknown fuzzy logic connective `%s`", CHAR(STRING_ELT(connective, 0)));
+
+   int levels_max = (nargs == 1) ? FUZZYLOGIC_LUT_MAXLEVELS_UNARY : FUZZYLOGIC_LUT_MAXLEVELS_BINARY;
+   if (Rf_isNull(levels))
+      levels = PROTECT(Rf_ScalarInteger((TYPEOF(x) == RAWSXP) ? 256 : levels_max));
+   else
+      levels = PROTECT(prepare_arg_integer_1(levels, "levels"));
+   int levels_val = INTEGER(levels)[0];
+   if (levels_val == NA_INTEGER || levels_val < 2 || levels_val > levels_max)
+      Rf_error(MSG__ARG_NOT_IN_AB, "levels", 2.0, (double)levels_max);
+
+   x = PROTECT(__fuzzylogic_prepare_codes(x, levels_val, "x"));
+   R_len_t x_length = LENGTH(x);
+   const int* x_tab = INTEGER(x);
+
+   if (nargs == 1) {
+      if (!Rf_isNull(y)) Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+      const double* lut = __fuzzylogic_lut_get(code, lambda_val, levels_val);
+
+      SEXP res;
+      PROTECT(res = Rf_allocVector(REALSXP, x_length));
+      double* res_tab = REAL(res);
+      for (R_len_t i=0; i<x_length; ++i)
+         res_tab[i] = (x_tab[i] == NA_INTEGER) ? NA_REAL : lut[x_tab[i]];
+      __fuzzylogic_copy_dim(x, res);
+      UNPROTECT(4);
+      return res;
+   }
+
+   if (Rf_isNull(y)) Rf_error(MSG_ARG_TOO_SHORT, "y");
+   y = PROTECT(__fuzzylogic_prepare_codes(y, levels_val, "y"));
+   R_len_t y_length = LENGTH(y);
+   const int* y_tab = INTEGER(y);
+
+   R_len_t n = std::max(x_length, y_length);
+   if (n%x_length != 0 || n%y_length != 0)
+      Rf_warning(MSG__WARN_RECYCLE);
+
+   const double* lut = __fuzzylogic_lut_get(code, lambda_val, levels_val);
+
+   SEXP res;
+   PROTECT(res = Rf_allocVector(REALSXP, n));
+   double* res_tab = REAL(res);
+   R_len_t ix = 0, iy = 0;
+   for (R_len_t i=0; i<n; ++i) {
+      int xi = x_tab[ix], yi = y_tab[iy];
+      res_tab[i] = (xi == NA_INTEGER || yi == NA_INTEGER) ? NA_REAL :
+         lut[(size_t)xi*levels_val+yi];
+      if (++ix == x_length) ix = 0;
+      if (++iy == y_length) iy = 0;
+   }
+   if (x_length == n && (y_length != n || !Rf_isNull(Rf_getAttrib(x, R_DimSymbol))))
+      __fuzzylogic_copy_dim(x, res);
+   else
+      __fuzzylogic_copy_dim(y, res);
+   UNPROTECT(5);
+   return res;
+}
@@ -18,18 +18,20 @@
  * from <http://www.gnu.org/licenses/>.                                      *
  * ************************************************************************* */
 
-#include "agop.h"
+#include "fuzzylogic.h"
 
 
 /** The minimum t-norm
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP tnorm_minimum(SEXP x, SEXP y)
+SEXP tnorm_minimum(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(std::min(x_tab[i], y_tab[i]))
+   return fuzzylogic_apply_binary<tnorm_minimum_op>(x, y, outer, out);
 }
 
 
@@ -37,11 +39,13 @@ SEXP tnorm_minimum(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP tnorm_product(SEXP x, SEXP y)
+SEXP tnorm_product(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(x_tab[i] * y_tab[i])
+   return fuzzylogic_apply_binary<tnorm_product_op>(x, y, outer, out);
 }
 
 
@@ -49,11 +53,13 @@ SEXP tnorm_product(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP tnorm_lukasiewicz(SEXP x, SEXP y)
+SEXP tnorm_lukasiewicz(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(std::max(x_tab[i]+y_tab[i]-1.0, 0.0))
+   return fuzzylogic_apply_binary<tnorm_lukasiewicz_op>(x, y, outer, out);
 }
 
 
@@ -61,13 +67,13 @@ SEXP tnorm_lukasiewicz(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP tnorm_drastic(SEXP x, SEXP y)
+SEXP tnorm_drastic(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(
-      (x_tab[i] < 1.0 && y_tab[i] < 1.0) ? 0.0 : std::min(x_tab[i], y_tab[i])
-   )
+   return fuzzylogic_apply_binary<tnorm_drastic_op>(x, y, outer, out);
 }
 
 
@@ -75,11 +81,86 @@ SEXP tnorm_drastic(SEXP x, SEXP y)
  *
  * @param x numeric
  * @param y numeric
+ * @param outer logical
+ * @param out numeric or NULL
  * @return numeric
  */
-SEXP tnorm_fodor(SEXP x, SEXP y)
+SEXP tnorm_fodor(SEXP x, SEXP y, SEXP outer, SEXP out)
 {
-   macro_apply_binaryop_x_y(
-      (x_tab[i] + y_tab[i] <= 1.0) ? 0.0 : std::min(x_tab[i], y_tab[i])
-   )
+   return fuzzylogic_apply_binary<tnorm_fodor_op>(x, y, outer, out);
+}
+
+
+/** The Hamacher t-norm
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP tnorm_hamacher(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_tnorm_family<tnorm_hamacher_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Frank t-norm
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP tnorm_frank(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_tnorm_family<tnorm_frank_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Yager t-norm
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP tnorm_yager(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_tnorm_family<tnorm_yager_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Schweizer-Sklar t-norm
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP tnorm_schweizersklar(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_tnorm_family<tnorm_schweizersklar_op>(x, y, lambda, outer, out);
+}
+
+
+/** The Dombi t-norm
+ *
+ * @param x numeric
+ * @param y numeric
+ * @param lambda numeric
+ * @param outer logical
+ * @param out numeric or NULL
+ * @return numeric
+ */
+SEXP tnorm_dombi(SEXP x, SEXP y, SEXP lambda, SEXP outer, SEXP out)
+{
+   return fuzzylogic_apply_tnorm_family<tnorm_dombi_op>(x, y, lambda, outer, out);
 }
@@ -0,0 +1,168 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+#ifndef __philox_h
+#define __philox_h
+
+#include "agop.h"
+#include <stdint.h>
+
+
+/** Philox4x32-10 counter-based pseudorandom number generator
+ *
+ * J.K. Salmon, M.A. Moraes, R.O. Dror, D.E. Shaw,
+ * Parallel random numbers: As easy as 1, 2, 3,
+ * In: Proc. SC'11, 2011, doi:10.1145/2063384.2063405
+ *
+ * The i-th block of 4 random 32-bit words is a pure function of
+ * (key, i); hence, any part of a stream can be generated independently
+ * of the others, e.g., by different threads, in any order.
+ *
+ * Does not call R's API; can be used in multithreaded code.
+ */
+class philox4x32
+{
+private:
+   uint32_t key[2];
+   uint32_t stream[2];
+
+   static inline uint32_t __mulhilo(uint32_t a, uint32_t b, uint32_t* hi)
+   {
+      uint64_t p = (uint64_t)a*(uint64_t)b;
+      *hi = (uint32_t)(p >> 32);
+      return (uint32_t)p;
+   }
+
+public:
+   /** Create a generator
+    *
+    * @param key0 first word of the key
+    * @param key1 second word of the key
+    * @param stream0 first word of the stream identifier
+    * @param stream1 second word of the stream identifier
+    */
+   philox4x32(uint32_t key0, uint32_t key1,
+         uint32_t stream0=0, uint32_t stream1=0)
+   {
+      key[0] = key0;          key[1] = key1;
+      stream[0] = stream0;    stream[1] = stream1;
+   }
+
+
+   /** Create a generator whose key is drawn using R's RNG
+    *
+    * Must be called between GetRNGstate() and PutRNGstate()
+    * and from the main thread; the result is thus reproducible
+    * with set.seed().
+    */
+   static philox4x32 from_R_rng()
+   {
+      uint32_t key0 = (uint32_t)(unif_rand()*4294967296.0);
+      uint32_t key1 = (uint32_t)(unif_rand()*4294967296.0);
+      return philox4x32(key0, key1);
+   }
+
+
+   /** Get a generator with the same key, but for a different stream
+    *
+    * Streams with different identifiers are independent; e.g.,
+    * each replicate in a Monte Carlo study may use its own stream.
+    *
+    * @param stream0 first word of the stream identifier
+    * @param stream1 second word of the stream identifier
+    */
+   inline philox4x32 substream(uint32_t stream0, uint32_t stream1=0) const
+   {
+      return philox4x32(key[0], key[1], stream0, stream1);
+   }
+
+
+   /** Generate the i-th block of random words
+    *
+    * @param i block index (counter)
+    * @param out [out] array of length 4
+    */
+   inline void generate(uint64_t i, uint32_t* out) const
+   {
+      uint32_t c0 = (uint32_t)i, c1 = (uint32_t)(i >> 32);
+      uint32_t c2 = stream[0],   c3 = stream[1];
+      uint32_t k0 = key[0],      k1 = key[1];
+      for (int r=0; r<10; ++r) {
+         uint32_t hi0, hi1;
+         uint32_t lo0 = __mulhilo(0xD2511F53u, c0, &hi0);
+         uint32_t lo1 = __mulhilo(0xCD9E8D57u, c2, &hi1);
+         c0 = hi1^c1^k0;  c1 = lo1;
+         c2 = hi0^c3^k1;  c3 = lo0;
+         k0 += 0x9E3779B9u;
+         k1 += 0xBB67AE85u;
+      }
+      out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+   }
+
+
+   /** Convert two random words to a double uniform on (0, 1)
+    *
+    * Uses 52 random bits, k, and returns (k+0.5)/2^52, which is exact;
+    * hence, the result is in [2^-53, 1-2^-53] and never 0 or 1.
+    */
+   static inline double to_unif(uint32_t a, uint32_t b)
+   {
+      uint64_t k = ((uint64_t)(a >> 6) << 26) | (uint64_t)(b >> 6);
+      return ((double)k + 0.5)*(1.0/4503599627370496.0);
+   }
+
+
+   /** Generate the i-th and the (i+1)-th uniform deviate, i even
+    *
+    * @param i block index (each block yields 2 deviates)
+    * @param u [out] array of length 2
+    */
+   inline void unif2(uint64_t i, double* u) const
+   {
+      uint32_t w[4];
+      generate(i, w);
+      u[0] = to_unif(w[0], w[1]);
+      u[1] = to_unif(w[2], w[3]);
+   }
+
+
+   /** Generate n standard exponential deviates, by inversion
+    *
+    * @param out [out] array of length n
+    * @param n number of deviates
+    */
+   inline void exp(double* out, R_len_t n) const
+   {
+      double u[2];
+      for (R_len_t i=0; i+1<n; i+=2) {
+         unif2((uint64_t)(i/2), u);
+         out[i]   = -log(u[0]);
+         out[i+1] = -log(u[1]);
+      }
+      if (n%2 == 1) {
+         unif2((uint64_t)(n/2), u);
+         out[n-1] = -log(u[0]);
+      }
+   }
+};
+
+#endif
@@ -110,22 +110,16 @@ SEXP __prepare_arg_sort(SEXP x, bool decreasing)
    if (decreasing) comparer = __comparer_greater;
    else            comparer = __comparer_less;
 
-   bool sorted = true;
-   for (R_len_t i=1; i<n; ++i) {
-      if (sorted && (i > 0) && !comparer(xd[i-1], xd[i]))
-         sorted = false;
-   }
-
-   if (sorted) return x; // it's sorted - return as-is
-
-   std::vector<double> myvector(xd, xd+n);
-   std::sort(myvector.begin(), myvector.end(), comparer);
+   // already sorted (ties allowed, NaNs not)? O(n), and no copy is needed
+   R_len_t i = ISNAN(xd[0]) ? 0 : 1;
+   while (i > 0 && i < n && !ISNAN(xd[i]) && !comparer(xd[i], xd[i-1])) ++i;
+   if (i == n) return x; // it's sorted - return as-is
 
    SEXP ret;
    PROTECT(ret = Rf_allocVector(REALSXP, n));
-   R_len_t i = 0;
-   for (std::vector<double>::iterator it=myvector.begin(); it!=myvector.end(); ++it)
-      REAL(ret)[i++] = *it;
+   double* retd = REAL(ret);
+   for (R_len_t j=0; j<n; ++j) retd[j] = xd[j];
+   std::sort(retd, retd+n, comparer);
    UNPROTECT(1);
    return ret;
 }
@@ -171,6 +165,51 @@ SEXP prepare_arg_numeric_sorted_inc(SEXP x, const char* argname)
 
 
 
+/**
+ * Prepare numeric vector that is partially sorted non-decreasingly
+ *
+ * The elements at positions from, ..., to are the same
+ * as if x was sorted; those before (after) them are not greater
+ * (not less) than them, but are in no particular order.
+ * This takes O(n + (n-from) log(to-from+1)) time.
+ *
+ * If x contains missing values, it is returned as-is.
+ *
+ * @param x numeric vector
+ * @param from 0-based index
+ * @param to 0-based index, from <= to < length(x)
+ * @param argname argument name (message formatting)
+ * @return numeric vector
+ */
+SEXP prepare_arg_numeric_partially_sorted_inc(SEXP x, R_len_t from, R_len_t to, const char* argname)
+{
+   PROTECT(x = prepare_arg_double(x, argname));
+   R_len_t n = LENGTH(x);
+   if (from < 0 || to >= n || from > to || (from == 0 && to == n-1)) {
+      PROTECT(x = __prepare_arg_sort(x, false));
+      UNPROTECT(2);
+      return x;
+   }
+
+   double* xd = REAL(x);
+   for (R_len_t i=0; i<n; ++i) {
+      if (ISNAN(xd[i])) {
+         UNPROTECT(1);
+         return x; // to be dealt with by the caller
+      }
+   }
+
+   SEXP ret;
+   PROTECT(ret = Rf_allocVector(REALSXP, n));
+   double* retd = REAL(ret);
+   for (R_len_t i=0; i<n; ++i) retd[i] = xd[i];
+   if (from > 0) std::nth_element(retd, retd+from, retd+n);
+   std::partial_sort(retd+from, retd+to+1, retd+n);
+   UNPROTECT(2);
+   return ret;
+}
+
+
 
 /* The functions below are borrowed from our `stringi` package for R
    Thanks to Bartek Tartanus :)
@@ -0,0 +1,44 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "summation.h"
+#include <cstring>
+
+
+summation_mode summation_mode_get()
+{
+   SEXP opt = Rf_GetOption1(Rf_install("agop.summation"));
+   if (Rf_isNull(opt))
+      return SUMMATION_PAIRWISE;
+
+   if (Rf_isString(opt) && LENGTH(opt) == 1 && STRING_ELT(opt, 0) != NA_STRING) {
+      const char* mode = CHAR(STRING_ELT(opt, 0));
+      if (!strcmp(mode, "pairwise"))    return SUMMATION_PAIRWISE;
+      if (!strcmp(mode, "fast"))        return SUMMATION_FAST;
+      if (!strcmp(mode, "compensated")) return SUMMATION_COMPENSATED;
+   }
+
+   Rf_error("option `agop.summation` should be one of "
+      "\"pairwise\", \"fast\", or \"compensated\"");
+   return SUMMATION_PAIRWISE; // avoid compiler warning
+}
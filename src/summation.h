@@ -0,0 +1,290 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+#ifndef __summation_h
+#define __summation_h
+
+#include "agop.h"
+
+
+/* Summation kernels: the terms are given by functors with
+ * `double operator()(R_len_t i) const`, so that, e.g., sum(x) and
+ * sum(w*x) share the same code and no temporary vectors are needed.
+ *
+ * SUMMATION_FAST uses 8 independent accumulators, which breaks
+ * the serial dependency and lets the compiler vectorise the loop;
+ * SUMMATION_PAIRWISE (the default) combines such blocks pairwise,
+ * which reduces the rounding error from O(n eps) to O(log(n) eps)
+ * at almost no cost; SUMMATION_COMPENSATED is the Kahan-Babuska
+ * (Neumaier) algorithm, whose error does not depend on n.
+ * All are deterministic, i.e., give reproducible results.
+ */
+enum summation_mode {
+   SUMMATION_FAST,
+   SUMMATION_PAIRWISE,
+   SUMMATION_COMPENSATED
+};
+
+#define SUMMATION_BLOCK 128
+
+
+/** Get the summation mode from getOption("agop.summation")
+ *
+ * Not thread-safe: call it outside of parallel regions.
+ *
+ * @return summation mode (SUMMATION_PAIRWISE if the option is not set)
+ */
+summation_mode summation_mode_get();
+
+
+struct summation_term_x {
+   const double* x;
+   summation_term_x(const double* _x) : x(_x) { }
+   inline double operator()(R_len_t i) const { return x[i]; }
+};
+
+
+struct summation_term_wx {
+   const double* w;
+   const double* x;
+   summation_term_wx(const double* _w, const double* _x) : w(_w), x(_x) { }
+   inline double operator()(R_len_t i) const { return w[i]*x[i]; }
+};
+
+
+/** Sum term(from), ..., term(to-1) using 8 accumulators
+ *
+ * @param term functor
+ * @param from index
+ * @param to index
+ * @return sum
+ */
+template<class TERM>
+inline double __sum_fast(const TERM& term, R_len_t from, R_len_t to)
+{
+   double acc[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   R_len_t i = from;
+   for (; i+8 <= to; i += 8) {
+      for (int j=0; j<8; ++j)
+         acc[j] += term(i+j);
+   }
+   double s = ((acc[0]+acc[1])+(acc[2]+acc[3]))+((acc[4]+acc[5])+(acc[6]+acc[7]));
+   for (; i<to; ++i)
+      s += term(i);
+   return s;
+}
+
+
+/** Sum term(from), ..., term(to-1) pairwise
+ *
+ * @param term functor
+ * @param from index
+ * @param to index
+ * @return sum
+ */
+template<class TERM>
+double __sum_pairwise(const TERM& term, R_len_t from, R_len_t to)
+{
+   if (to-from <= SUMMATION_BLOCK)
+      return __sum_fast(term, from, to);
+   R_len_t mid = from+((to-from)/(2*SUMMATION_BLOCK))*SUMMATION_BLOCK;
+   if (mid == from) mid += SUMMATION_BLOCK;
+   return __sum_pairwise(term, from, mid)+__sum_pairwise(term, mid, to);
+}
+
+
+/** Sum term(from), ..., term(to-1) with Neumaier's compensation
+ *
+ * @param term functor
+ * @param from index
+ * @param to index
+ * @return sum
+ */
+template<class TERM>
+double __sum_compensated(const TERM& term, R_len_t from, R_len_t to)
+{
+   double s = 0.0, c = 0.0;
+   for (R_len_t i=from; i<to; ++i) {
+      double t = term(i);
+      double u = s+t;
+      c += (fabs(s) >= fabs(t)) ? ((s-u)+t) : ((t-u)+s);
+      s = u;
+   }
+   return s+c;
+}
+
+
+/** Sum term(0), ..., term(n-1)
+ *
+ * @param term functor
+ * @param n number of terms
+ * @param mode summation mode
+ * @return sum
+ */
+template<class TERM>
+double sum_terms(const TERM& term, R_len_t n, summation_mode mode)
+{
+   switch (mode) {
+      case SUMMATION_FAST:        return __sum_fast(term, 0, n);
+      case SUMMATION_COMPENSATED: return __sum_compensated(term, 0, n);
+      default:                    return __sum_pairwise(term, 0, n);
+   }
+}
+
+
+/* Two-output terms, with
+ * `void operator()(R_len_t i, double& t1, double& t2) const`:
+ * both sums are accumulated in a single pass over the data.
+ */
+struct summation_term2_x_ix {
+   const double* x;
+   summation_term2_x_ix(const double* _x) : x(_x) { }
+   inline void operator()(R_len_t i, double& t1, double& t2) const {
+      t1 = x[i];
+      t2 = (double)i*x[i];
+   }
+};
+
+
+/** Sum two-output terms from, ..., to-1 using 8+8 accumulators
+ *
+ * @param term functor
+ * @param from index
+ * @param to index
+ * @return both sums
+ */
+template<class TERM2>
+inline double2 __sum2_fast(const TERM2& term, R_len_t from, R_len_t to)
+{
+   double acc1[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   double acc2[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+   double t1, t2;
+   R_len_t i = from;
+   for (; i+8 <= to; i += 8) {
+      for (int j=0; j<8; ++j) {
+         term(i+j, t1, t2);
+         acc1[j] += t1;
+         acc2[j] += t2;
+      }
+   }
+   double s1 = ((acc1[0]+acc1[1])+(acc1[2]+acc1[3]))+((acc1[4]+acc1[5])+(acc1[6]+acc1[7]));
+   double s2 = ((acc2[0]+acc2[1])+(acc2[2]+acc2[3]))+((acc2[4]+acc2[5])+(acc2[6]+acc2[7]));
+   for (; i<to; ++i) {
+      term(i, t1, t2);
+      s1 += t1;
+      s2 += t2;
+   }
+   return double2(s1, s2);
+}
+
+
+/** Sum two-output terms from, ..., to-1 pairwise
+ *
+ * @param term functor
+ * @param from index
+ * @param to index
+ * @return both sums
+ */
+template<class TERM2>
+double2 __sum2_pairwise(const TERM2& term, R_len_t from, R_len_t to)
+{
+   if (to-from <= SUMMATION_BLOCK)
+      return __sum2_fast(term, from, to);
+   R_len_t mid = from+((to-from)/(2*SUMMATION_BLOCK))*SUMMATION_BLOCK;
+   if (mid == from) mid += SUMMATION_BLOCK;
+   double2 a = __sum2_pairwise(term, from, mid);
+   double2 b = __sum2_pairwise(term, mid, to);
+   return double2(a.v1+b.v1, a.v2+b.v2);
+}
+
+
+/** Sum two-output terms from, ..., to-1 with Neumaier's compensation
+ *
+ * @param term functor
+ * @param from index
+ * @param to index
+ * @return both sums
+ */
+template<class TERM2>
+double2 __sum2_compensated(const TERM2& term, R_len_t from, R_len_t to)
+{
+   double s1 = 0.0, c1 = 0.0, s2 = 0.0, c2 = 0.0, t1, t2, u;
+   for (R_len_t i=from; i<to; ++i) {
+      term(i, t1, t2);
+      u = s1+t1;
+      c1 += (fabs(s1) >= fabs(t1)) ? ((s1-u)+t1) : ((t1-u)+s1);
+      s1 = u;
+      u = s2+t2;
+      c2 += (fabs(s2) >= fabs(t2)) ? ((s2-u)+t2) : ((t2-u)+s2);
+      s2 = u;
+   }
+   return double2(s1+c1, s2+c2);
+}
+
+
+/** Sum two-output terms 0, ..., n-1 in a single pass
+ *
+ * Gives the same results as two calls to sum_terms().
+ *
+ * @param term functor
+ * @param n number of terms
+ * @param mode summation mode
+ * @return both sums
+ */
+template<class TERM2>
+double2 sum_terms2(const TERM2& term, R_len_t n, summation_mode mode)
+{
+   switch (mode) {
+      case SUMMATION_FAST:        return __sum2_fast(term, 0, n);
+      case SUMMATION_COMPENSATED: return __sum2_compensated(term, 0, n);
+      default:                    return __sum2_pairwise(term, 0, n);
+   }
+}
+
+
+/** Running sum, term(0)+...+term(i), with optional compensation
+ *
+ * Used where the partial sums are needed, e.g., in the g-index.
+ */
+struct summation_running {
+   double s;
+   double c;
+   bool compensated;
+
+   summation_running(summation_mode mode)
+      : s(0.0), c(0.0), compensated(mode == SUMMATION_COMPENSATED) { }
+
+   inline void add(double t)
+   {
+      if (compensated) {
+         double u = s+t;
+         c += (fabs(s) >= fabs(t)) ? ((s-u)+t) : ((t-u)+s);
+         s = u;
+      }
+      else
+         s += t;
+   }
+
+   inline double get() const { return s+c; }
+};
+
+#endif
@@ -0,0 +1,195 @@
+/* ************************************************************************* *
+ * This file is part of the 'agop' library.                                  *
+ *                                                                           *
+ * Copyleft (c) 2013-2023, Marek Gagolewski <https://www.gagolewski.com/>    *
+ *                                                                           *
+ *                                                                           *
+ * 'agop' is free software: you can redistribute it and/or modify it under   *
+ * the terms of the GNU Lesser General Public License as published by        *
+ * the Free Software Foundation, either version 3 of the License, or         *
+ * (at your option) any later version.                                       *
+ *                                                                           *
+ * 'agop' is distributed in the hope that it will be useful,                 *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              *
+ * GNU Lesser General Public License for more details.                       *
+ *                                                                           *
+ * A copy of the GNU Lesser General Public License can be downloaded         *
+ * from <http://www.gnu.org/licenses/>.                                      *
+ * ************************************************************************* */
+
+
+
+
+#include "adtest.h"
+#include "philox.h"
+#include <climits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+/* Monte Carlo simulation of test statistics' null distributions.
+ *
+ * Each replicate r uses its own Philox stream (with the key drawn
+ * from R's RNG), so the results are reproducible with set.seed()
+ * and do not depend on the number of threads used.
+ */
+
+
+/** AD exponentiality test statistic for an Exp(1) sample of size n */
+struct __simulate_ad {
+   R_len_t n;
+   summation_mode mode;
+
+   R_len_t bufsize() const { return n; }
+
+   double operator()(const philox4x32& gen, double* buf) const
+   {
+      gen.exp(buf, n);
+      std::sort(buf, buf+n);
+      return __exp_test_statistic(buf, n, mode);
+   }
+};
+
+
+/** Pareto2 F-test statistic for samples of sizes nx and ny
+ *
+ * Under H0, log(1+X/s) and log(1+Y/s) are i.i.d. exponential,
+ * hence it suffices to simulate Exp(1) samples.
+ */
+struct __simulate_f {
+   R_len_t nx;
+   R_len_t ny;
+
+   R_len_t bufsize() const { return nx+ny; }
+
+   double operator()(const philox4x32& gen, double* buf) const
+   {
+      gen.exp(buf, nx+ny);
+      double sx = 0.0, sy = 0.0;
+      for (R_len_t i=0; i<nx; ++i) sx += buf[i];
+      for (R_len_t i=nx; i<nx+ny; ++i) sy += buf[i];
+      return ((double)nx/(double)ny)*(sy/sx);
+   }
+};
+
+
+/** Run the simulation
+ *
+ * @param stat replicate functor
+ * @param R number of replicates
+ * @param nthreads number of threads
+ * @return numeric vector of length R
+ */
+template<class STAT>
+SEXP __test_simulate(const STAT& stat, R_len_t R, int nthreads)
+{
+#ifndef _OPENMP
+   nthreads = 1;
+#endif
+   // per-thread buffers
+   double* buf = (double*)R_alloc((size_t)nthreads*stat.bufsize(), sizeof(double));
+
+   SEXP ret;
+   PROTECT(ret = Rf_allocVector(REALSXP, R));
+   double* pret = REAL(ret);
+
+   GetRNGstate();
+   philox4x32 gen = philox4x32::from_R_rng();
+   PutRNGstate();
+
+   #ifdef _OPENMP
+   #pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+   #endif
+   for (R_len_t r=0; r<R; ++r) {
+#ifdef _OPENMP
+      int t = omp_get_thread_num();
+#else
+      int t = 0;
+#endif
+      pret[r] = stat(gen.substream((uint32_t)r), buf+(size_t)t*stat.bufsize());
+   }
+
+   UNPROTECT(1);
+   return ret;
+}
+
+
+/** Prepare the number of replicates and threads
+ *
+ * @param R single numeric value
+ * @param nthreads single integer value
+ * @param R_val [out]
+ * @param nthreads_val [out]
+ */
+static void __test_simulate_args(SEXP R, SEXP nthreads, R_len_t* R_val, int* nthreads_val)
+{
+   R = PROTECT(prepare_arg_double_1(R, "R"));
+   nthreads = PROTECT(prepare_arg_integer_1(nthreads, "nthreads"));
+   double R_dbl = REAL(R)[0];
+   *nthreads_val = INTEGER(nthreads)[0];
+   UNPROTECT(2);
+
+   if (!(R_dbl >= 0.0 && R_dbl <= (double)INT_MAX)) // NA too
+      Rf_error(MSG__ARG_NOT_IN_AB, "R", 0.0, (double)INT_MAX);
+   if (*nthreads_val == NA_INTEGER || *nthreads_val < 1)
+      Rf_error(MSG__ARG_NOT_GE_A, "nthreads", 1.0);
+   *R_val = (R_len_t)R_dbl;
+}
+
+
+/** Simulate the null distribution of the AD exponentiality test statistic
+ *
+ * @param n single integer, sample size
+ * @param R single numeric value, number of replicates
+ * @param nthreads single integer
+ * @return numeric vector of length R
+ */
+SEXP exp_test_ad_simulate(SEXP n, SEXP R, SEXP nthreads)
+{
+   n = PROTECT(prepare_arg_integer_1(n, "n"));
+   int n_val = INTEGER(n)[0];
+   UNPROTECT(1);
+   if (n_val == NA_INTEGER || n_val < EXP_TEST_AD_CDF_NMIN)
+      Rf_error(MSG__ARG_NOT_GE_A, "n", (double)EXP_TEST_AD_CDF_NMIN);
+
+   R_len_t R_val;
+   int nthreads_val;
+   __test_simulate_args(R, nthreads, &R_val, &nthreads_val);
+
+   __simulate_ad stat;
+   stat.n = n_val;
+   stat.mode = summation_mode_get(); // not in the parallel region
+   return __test_simulate(stat, R_val, nthreads_val);
+}
+
+
+/** Simulate the null distribution of the Pareto2 F-test statistic
+ *
+ * @param nx single integer, size of the first sample
+ * @param ny single integer, size of the second sample
+ * @param R single numeric value, number of replicates
+ * @param nthreads single integer
+ * @return numeric vector of length R
+ */
+SEXP pareto2_test_f_simulate(SEXP nx, SEXP ny, SEXP R, SEXP nthreads)
+{
+   nx = PROTECT(prepare_arg_integer_1(nx, "nx"));
+   ny = PROTECT(prepare_arg_integer_1(ny, "ny"));
+   int nx_val = INTEGER(nx)[0];
+   int ny_val = INTEGER(ny)[0];
+   UNPROTECT(2);
+   if (nx_val == NA_INTEGER || nx_val < 1) Rf_error(MSG__ARG_NOT_GE_A, "nx", 1.0);
+   if (ny_val == NA_INTEGER || ny_val < 1) Rf_error(MSG__ARG_NOT_GE_A, "ny", 1.0);
+
+   R_len_t R_val;
+   int nthreads_val;
+   __test_simulate_args(R, nthreads, &R_val, &nthreads_val);
+
+   __simulate_f stat;
+   stat.nx = nx_val;
+   stat.ny = ny_val;
+   return __test_simulate(stat, R_val, nthreads_val);
+}